@@ -0,0 +1,53 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+#include "CinCharSet.h"
+
+namespace PIME {
+
+static const CinCharSet charSetOfClass[CIN_CHAR_CLASS_COUNT] = {
+	CIN_CHARSET_CJK_OTHER,
+	CIN_CHARSET_BOPOMOFO,
+	CIN_CHARSET_CJK,
+	CIN_CHARSET_BIG5_F,
+	CIN_CHARSET_BIG5_LF,
+	CIN_CHARSET_BIG5_LF,  // Cin.getCharSet() returns "big5LF" for the symbols of Big5
+	CIN_CHARSET_BIG5_OTHER,
+	CIN_CHARSET_CJK_EXT_A,
+	CIN_CHARSET_CJK_EXT_B,
+	CIN_CHARSET_CJK_EXT_C,
+	CIN_CHARSET_CJK_EXT_D,
+	CIN_CHARSET_CJK_EXT_E,
+	CIN_CHARSET_CJK_EXT_F,
+	CIN_CHARSET_CJK_CI_IBM,
+	CIN_CHARSET_PUA,
+	CIN_CHARSET_PUA,
+	CIN_CHARSET_PUA
+};
+
+CinCharSet cinCharSetOf(uint32_t codepoint) {
+	return charSetOfClass[cinCharClassOf(codepoint)];
+}
+
+bool isPrivateUseClass(CinCharClass charClass) {
+	return charClass == CIN_CHAR_PRIVATE_USE || charClass == CIN_CHAR_CJK_CI || charClass == CIN_CHAR_CJK_CIS;
+}
+
+} // namespace PIME
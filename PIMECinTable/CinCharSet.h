@@ -0,0 +1,66 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+#ifndef _PIME_CIN_CHARSET_H_
+#define _PIME_CIN_CHARSET_H_
+
+#include <cstdint>
+
+#include "CinTableFormat.h"
+
+namespace PIME {
+
+// classes of the characters of CinToJson.getCharSet() in python/cinbase/tools/cintojson.py,
+// which decide the order of the values of the tables sorted by character sets and the cincount
+enum CinCharClass : uint8_t {
+	CIN_CHAR_OTHER = 0,  // cjkOther
+	CIN_CHAR_BOPOMOFO,
+	CIN_CHAR_CJK,
+	CIN_CHAR_BIG5_F,
+	CIN_CHAR_BIG5_LF,
+	CIN_CHAR_BIG5_S,  // symbols of Big5
+	CIN_CHAR_BIG5_OTHER,
+	CIN_CHAR_CJK_EXT_A,
+	CIN_CHAR_CJK_EXT_B,
+	CIN_CHAR_CJK_EXT_C,
+	CIN_CHAR_CJK_EXT_D,
+	CIN_CHAR_CJK_EXT_E,
+	CIN_CHAR_CJK_EXT_F,
+	CIN_CHAR_CJK_CI_IBM,
+	CIN_CHAR_PRIVATE_USE,
+	CIN_CHAR_CJK_CI,  // other CJK compatibility ideographs
+	CIN_CHAR_CJK_CIS,  // CJK compatibility ideographs supplement
+	CIN_CHAR_CLASS_COUNT
+};
+
+// Class of a code point, a lookup of the two-level table in CinCharSetTable.cpp instead of
+// checking the ranges and encoding to Big5. The table is generated by
+// python/cinbase/tools/gencharset.py.
+CinCharClass cinCharClassOf(uint32_t codepoint);
+
+// character set of a code point, the same as Cin.getCharSet() in python/cinbase/cin.py
+CinCharSet cinCharSetOf(uint32_t codepoint);
+
+// whether the characters of the class are in the privateuse list of the tables
+bool isPrivateUseClass(CinCharClass charClass);
+
+} // namespace PIME
+
+#endif // _PIME_CIN_CHARSET_H_
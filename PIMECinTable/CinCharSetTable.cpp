@@ -0,0 +1,1178 @@
+// Generated by python/cinbase/tools/gencharset.py, do not edit.
+// CinCharClass of all code points, classified the same as CinToJson.getCharSet() in
+// python/cinbase/tools/cintojson.py.
+
+#include "CinCharSet.h"
+
+namespace PIME {
+
+static const uint8_t charClassBlocks[102][256] = {
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	},
+	{
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		3, 3, 2, 3, 2, 2, 2, 4, 3, 3, 3, 3, 4, 3, 4, 4, 3, 3, 2, 2, 3, 3, 3, 2, 3, 3, 2, 2, 2, 2, 3, 3,
+		2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 2, 3, 4, 2, 3, 4, 3, 4, 2, 2, 2, 2, 3, 3, 2, 3, 4, 2, 2, 2,
+		2, 2, 4, 3, 2, 3, 2, 4, 3, 2, 2, 3, 2, 3, 3, 3, 2, 2, 3, 3, 2, 2, 3, 2, 3, 3, 2, 2, 4, 3, 3, 3,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4,
+		2, 2, 3, 4, 4, 2, 3, 2, 3, 2, 2, 3, 3, 4, 3, 2, 2, 3, 3, 4, 3, 3, 2, 2, 2, 3, 2, 3, 2, 2, 3, 3,
+		2, 3, 3, 2, 3, 3, 3, 2, 3, 2, 2, 3, 3, 3, 3, 2, 2, 2, 2, 3, 2, 2, 4, 2, 2, 4, 3, 2, 2, 2, 2, 2,
+		3, 3, 4, 3, 3, 2, 3, 3, 4, 4, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 2, 4, 4, 3, 3,
+		2, 4, 2, 3, 3, 3, 2, 2, 4, 4, 2, 2, 2, 2, 2, 2, 3, 4, 3, 3, 4, 4, 3, 4, 2, 2, 2, 3, 2, 3, 2, 3,
+	},
+	{
+		4, 3, 4, 2, 4, 4, 2, 2, 4, 3, 3, 3, 2, 3, 4, 3, 3, 3, 4, 4, 4, 3, 2, 2, 4, 3, 2, 2, 2, 4, 2, 2,
+		2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 2, 3, 3, 2, 2, 4, 3, 2, 3, 2, 3, 2, 3, 4, 3, 3, 4, 4,
+		2, 4, 2, 3, 2, 2, 3, 3, 3, 4, 2, 2, 4, 3, 3, 3, 3, 3, 4, 4, 3, 3, 4, 3, 4, 3, 3, 3, 3, 3, 3, 4,
+		3, 4, 4, 3, 4, 2, 2, 4, 2, 3, 4, 4, 3, 2, 4, 3, 3, 2, 2, 3, 4, 3, 4, 4, 4, 4, 3, 3, 4, 4, 3, 3,
+		4, 4, 4, 3, 4, 4, 3, 4, 3, 4, 2, 3, 2, 3, 2, 3, 4, 3, 4, 2, 4, 4, 3, 4, 4, 2, 4, 3, 4, 3, 4, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 4, 4, 2, 3, 3, 3, 2, 4, 4, 4, 2, 2, 2, 3,
+		4, 4, 3, 3, 3, 4, 2, 4, 2, 4, 3, 4, 2, 4, 3, 3, 3, 3, 2, 4, 4, 2, 4, 3, 3, 4, 3, 4, 4, 3, 3, 3,
+		3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 3, 3, 2, 3, 2, 3, 4, 4, 4, 4, 3, 2, 3, 2, 2, 2, 3, 2,
+	},
+	{
+		3, 2, 2, 2, 2, 4, 3, 4, 2, 3, 2, 3, 3, 3, 4, 3, 2, 3, 3, 4, 3, 4, 3, 4, 3, 3, 3, 4, 4, 2, 4, 3,
+		4, 3, 4, 3, 2, 3, 3, 4, 3, 3, 3, 3, 4, 3, 2, 4, 4, 4, 2, 4, 2, 4, 2, 4, 2, 2, 2, 2, 3, 2, 2, 2,
+		4, 4, 2, 3, 2, 4, 4, 3, 4, 3, 4, 4, 3, 4, 3, 3, 2, 4, 2, 4, 2, 3, 2, 4, 2, 2, 3, 4, 3, 4, 4, 4,
+		4, 4, 4, 4, 4, 3, 2, 2, 4, 4, 4, 4, 2, 3, 4, 3, 4, 2, 4, 4, 3, 3, 3, 3, 2, 2, 3, 2, 2, 3, 2, 2,
+		3, 2, 4, 4, 2, 3, 2, 4, 2, 2, 2, 4, 4, 3, 4, 2, 2, 3, 4, 2, 4, 4, 3, 2, 3, 3, 3, 4, 4, 4, 4, 2,
+		2, 2, 3, 4, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 4, 3, 4, 4, 3, 3, 4, 3, 4, 3, 4, 2, 4, 3, 2, 4, 3, 4,
+		2, 4, 4, 2, 4, 3, 4, 3, 4, 4, 4, 4, 2, 2, 3, 3, 2, 3, 2, 4, 4, 3, 3, 4, 2, 2, 3, 4, 2, 4, 2, 2,
+		4, 2, 2, 4, 4, 3, 4, 3, 4, 3, 4, 2, 4, 3, 3, 4, 4, 3, 2, 4, 2, 3, 4, 2, 4, 3, 2, 3, 2, 4, 4, 4,
+	},
+	{
+		3, 2, 3, 4, 3, 3, 4, 4, 3, 3, 4, 4, 4, 2, 2, 2, 3, 4, 3, 4, 3, 3, 2, 4, 3, 2, 4, 2, 4, 2, 2, 3,
+		4, 3, 4, 2, 4, 4, 4, 2, 2, 4, 3, 2, 2, 4, 4, 2, 4, 4, 3, 3, 4, 4, 2, 3, 3, 4, 4, 3, 3, 4, 2, 3,
+		3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 3, 2, 3, 3, 2, 3, 2, 5, 4, 5, 3, 5, 5, 4,
+		2, 5, 3, 5, 2, 3, 2, 3, 3, 3, 2, 3, 3, 3, 3, 2, 2, 3, 2, 2, 2, 3, 3, 3, 3, 2, 2, 2, 3, 2, 2, 2,
+		3, 2, 2, 2, 2, 2, 2, 4, 2, 3, 3, 2, 2, 3, 2, 4, 2, 3, 3, 4, 4, 3, 2, 3, 4, 2, 2, 2, 2, 2, 4, 2,
+		3, 2, 3, 2, 3, 3, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 3, 4, 2, 2, 2, 2, 3, 3, 2, 4, 2, 2, 4, 3, 4, 2,
+		2, 2, 2, 2, 4, 4, 3, 2, 4, 2, 4, 3, 3, 3, 4, 2, 4, 2, 2, 2, 4, 2, 2, 4, 4, 2, 2, 2, 3, 3, 4, 2,
+		3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 3, 2, 4, 3, 2, 3, 3, 3, 2, 2, 3, 2, 2,
+	},
+	{
+		3, 3, 2, 3, 2, 2, 3, 3, 3, 4, 3, 2, 4, 2, 3, 2, 4, 3, 3, 4, 2, 2, 3, 3, 2, 2, 2, 2, 4, 3, 4, 2,
+		2, 4, 2, 2, 3, 3, 2, 2, 3, 3, 3, 2, 2, 2, 3, 2, 3, 4, 4, 4, 2, 4, 3, 3, 3, 2, 3, 3, 2, 2, 2, 2,
+		2, 3, 2, 3, 4, 2, 4, 3, 2, 4, 3, 3, 3, 3, 3, 2, 2, 2, 4, 2, 3, 4, 3, 2, 2, 2, 4, 3, 3, 3, 4, 4,
+		2, 4, 4, 2, 2, 2, 2, 2, 2, 3, 3, 4, 4, 4, 4, 3, 2, 2, 3, 2, 3, 3, 2, 3, 4, 2, 4, 4, 4, 3, 2, 3,
+		4, 4, 3, 3, 4, 2, 2, 3, 3, 3, 3, 4, 4, 3, 2, 2, 2, 3, 2, 3, 2, 2, 4, 4, 4, 4, 2, 3, 2, 2, 2, 3,
+		3, 2, 2, 3, 2, 2, 4, 2, 2, 3, 3, 3, 3, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 2, 3, 2,
+		4, 3, 4, 3, 2, 2, 2, 3, 2, 3, 2, 2, 2, 4, 2, 2, 2, 2, 3, 4, 2, 3, 4, 3, 3, 3, 2, 3, 2, 3, 3, 3,
+		2, 2, 3, 3, 3, 2, 3, 2, 2, 4, 2, 4, 2, 2, 2, 4, 3, 4, 2, 3, 4, 3, 2, 4, 3, 2, 3, 3, 4, 2, 3, 3,
+	},
+	{
+		2, 2, 2, 2, 2, 3, 3, 2, 3, 4, 4, 4, 2, 3, 4, 3, 3, 4, 4, 2, 2, 3, 3, 3, 2, 3, 4, 2, 4, 3, 2, 4,
+		3, 3, 4, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2, 4, 2, 3, 4, 3, 2, 2, 4, 2, 2, 4, 2, 3, 2, 2, 4, 4, 3, 3,
+		3, 3, 2, 3, 5, 3, 2, 3, 3, 3, 3, 2, 4, 4, 2, 2, 2, 3, 3, 3, 3, 2, 2, 3, 2, 2, 3, 2, 3, 2, 3, 2,
+		3, 3, 2, 4, 2, 2, 3, 2, 2, 2, 2, 2, 4, 2, 3, 3, 3, 3, 4, 3, 2, 3, 2, 3, 3, 3, 2, 3, 4, 2, 2, 3,
+		2, 2, 4, 2, 3, 2, 2, 2, 2, 2, 4, 2, 2, 2, 4, 4, 2, 2, 4, 2, 4, 2, 4, 4, 4, 4, 3, 2, 4, 3, 4, 3,
+		2, 2, 2, 2, 4, 3, 2, 4, 2, 2, 2, 2, 4, 3, 2, 2, 2, 2, 3, 2, 4, 2, 2, 2, 2, 4, 2, 3, 2, 2, 2, 2,
+		2, 2, 2, 3, 2, 2, 2, 2, 3, 3, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 2, 2, 2, 3, 2, 2, 2, 3,
+		2, 4, 3, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 2, 2, 3, 2, 2, 3, 3, 2, 2, 2,
+	},
+	{
+		2, 3, 2, 3, 3, 2, 3, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 4, 4, 2, 3, 4, 3, 3, 3,
+		3, 2, 2, 2, 4, 4, 3, 3, 4, 3, 4, 3, 3, 3, 3, 2, 4, 3, 2, 3, 2, 3, 3, 4, 3, 3, 2, 3, 3, 4, 3, 2,
+		3, 4, 3, 3, 2, 4, 3, 4, 3, 2, 3, 2, 2, 2, 3, 4, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		4, 4, 3, 4, 4, 4, 4, 4, 3, 2, 2, 4, 4, 2, 2, 4, 4, 3, 4, 3, 4, 3, 3, 3, 3, 2, 4, 3, 3, 3, 4, 4,
+		3, 4, 4, 2, 3, 2, 3, 4, 4, 2, 2, 3, 3, 4, 3, 2, 3, 4, 3, 2, 2, 3, 3, 2, 4, 2, 3, 2, 2, 2, 2, 2,
+		4, 4, 4, 2, 2, 4, 3, 3, 3, 3, 3, 3, 3, 4, 4, 3, 4, 3, 2, 3, 2, 2, 4, 4, 3, 2, 4, 3, 4, 3, 4, 3,
+		3, 3, 3, 4, 3, 4, 4, 3, 3, 3, 2, 2, 2, 2, 3, 4, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 4, 2,
+		4, 3, 4, 2, 4, 3, 3, 4, 3, 3, 3, 4, 2, 3, 3, 2, 2, 4, 3, 4, 2, 2, 2, 4, 4, 2, 3, 4, 3, 3, 2, 4,
+	},
+	{
+		2, 3, 2, 4, 4, 4, 3, 3, 4, 3, 4, 4, 4, 2, 4, 3, 3, 4, 4, 2, 3, 2, 2, 4, 2, 2, 4, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 4, 3, 2, 2, 4, 2, 3, 4, 3, 3, 4, 3, 4, 3, 4, 4, 4, 3, 3, 4, 2, 4, 4, 2, 3, 2,
+		4, 3, 2, 3, 3, 4, 3, 2, 4, 2, 3, 4, 2, 4, 4, 3, 4, 4, 4, 2, 2, 3, 3, 3, 2, 2, 2, 2, 3, 2, 3, 3,
+		2, 3, 4, 3, 3, 4, 3, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 2, 2, 2, 3, 3, 4, 3, 4,
+		3, 4, 3, 3, 3, 2, 2, 3, 4, 3, 3, 3, 4, 4, 4, 4, 2, 4, 4, 4, 3, 4, 2, 2, 3, 3, 3, 2, 3, 3, 2, 3,
+		2, 4, 4, 4, 4, 4, 4, 3, 4, 2, 3, 3, 3, 4, 3, 2, 2, 3, 3, 3, 2, 4, 2, 2, 2, 2, 2, 3, 2, 2, 2, 4,
+		4, 2, 4, 4, 4, 3, 3, 3, 4, 3, 4, 4, 4, 4, 3, 4, 4, 3, 4, 3, 4, 4, 4, 2, 2, 4, 3, 4, 3, 4, 2, 3,
+		2, 3, 4, 3, 3, 3, 3, 5, 3, 4, 2, 2, 2, 2, 2, 3, 2, 2, 4, 2, 2, 2, 3, 3, 2, 4, 4, 2, 4, 3, 3, 4,
+	},
+	{
+		3, 4, 4, 2, 4, 2, 3, 2, 3, 3, 2, 2, 4, 3, 3, 4, 3, 2, 4, 4, 3, 4, 3, 3, 2, 2, 2, 3, 4, 4, 2, 3,
+		2, 2, 2, 2, 2, 2, 2, 4, 2, 3, 4, 2, 4, 2, 3, 3, 3, 2, 3, 4, 3, 4, 3, 2, 4, 3, 4, 3, 2, 4, 4, 3,
+		4, 4, 4, 2, 2, 4, 4, 2, 4, 4, 4, 2, 4, 2, 3, 2, 2, 2, 2, 3, 2, 2, 2, 3, 4, 3, 4, 2, 2, 2, 4, 2,
+		4, 2, 3, 4, 3, 3, 4, 2, 3, 3, 3, 3, 3, 4, 4, 3, 4, 3, 4, 4, 3, 2, 3, 4, 3, 3, 2, 2, 2, 2, 4, 4,
+		3, 4, 4, 4, 4, 3, 4, 3, 2, 2, 2, 2, 4, 4, 3, 3, 3, 2, 2, 4, 2, 3, 2, 4, 4, 4, 4, 2, 4, 4, 2, 2,
+		2, 2, 2, 2, 2, 3, 4, 4, 3, 2, 4, 4, 4, 4, 3, 2, 2, 2, 4, 4, 3, 4, 3, 3, 2, 2, 2, 2, 3, 4, 4, 2,
+		3, 3, 3, 4, 2, 4, 4, 2, 3, 3, 3, 4, 3, 4, 2, 2, 2, 3, 2, 4, 4, 2, 2, 4, 2, 2, 3, 3, 2, 3, 3, 4,
+		3, 4, 2, 2, 3, 4, 2, 4, 2, 2, 3, 3, 2, 2, 4, 2, 3, 2, 2, 2, 2, 2, 2, 4, 2, 4, 3, 2, 2, 2, 2, 3,
+	},
+	{
+		2, 4, 4, 3, 3, 2, 2, 4, 3, 3, 4, 3, 4, 3, 2, 2, 2, 2, 3, 3, 4, 2, 3, 2, 3, 2, 4, 4, 4, 2, 4, 3,
+		4, 2, 4, 4, 2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 4, 3, 3, 2, 2, 3, 4, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2,
+		3, 4, 2, 2, 2, 4, 2, 3, 2, 4, 3, 4, 4, 3, 3, 3, 3, 3, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 3, 4, 2, 3, 2, 3, 2, 4, 3, 3, 4, 2, 4, 2, 4, 4, 4, 4, 4, 4, 4, 4, 3, 2, 2, 2, 4, 3, 4, 2, 2,
+		4, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 4, 2, 2, 4, 2, 2, 2, 3, 4, 4, 2, 4, 4, 4, 4, 4, 2, 4, 4, 4,
+		3, 2, 3, 3, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 4, 4, 2, 4, 4, 4, 2, 4, 4, 2, 4,
+		2, 4, 3, 3, 2, 2, 4, 4, 2, 2, 2, 3, 4, 2, 3, 4, 4, 2, 4, 2, 3, 4, 2, 2, 2, 2, 2, 2, 4, 2, 2, 3,
+		3, 4, 4, 4, 3, 4, 2, 4, 2, 4, 2, 2, 4, 4, 4, 2, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 3, 4, 4, 4, 2, 2,
+	},
+	{
+		4, 4, 3, 2, 4, 3, 3, 4, 4, 3, 3, 4, 4, 4, 4, 2, 4, 2, 2, 2, 4, 2, 2, 2, 2, 4, 2, 4, 4, 3, 4, 2,
+		3, 3, 2, 4, 3, 4, 2, 4, 4, 4, 3, 2, 4, 4, 4, 3, 3, 3, 4, 4, 3, 3, 4, 4, 4, 4, 2, 4, 2, 4, 2, 4,
+		2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 3, 3, 3, 4, 4, 4, 2, 3, 3, 4, 3, 4, 2, 3, 3, 4, 3, 4, 2, 4, 3, 2,
+		2, 2, 3, 4, 4, 4, 2, 2, 4, 2, 2, 3, 2, 3, 2, 4, 2, 4, 2, 2, 4, 3, 4, 2, 2, 3, 4, 4, 4, 3, 3, 4,
+		3, 4, 4, 3, 2, 3, 4, 4, 4, 4, 3, 4, 2, 2, 4, 4, 4, 4, 2, 3, 4, 2, 2, 2, 4, 2, 2, 2, 3, 4, 3, 3,
+		4, 4, 2, 4, 2, 4, 3, 2, 3, 3, 2, 4, 4, 2, 3, 4, 2, 4, 2, 3, 2, 2, 2, 2, 2, 2, 4, 2, 4, 4, 3, 4,
+		2, 3, 4, 2, 2, 3, 4, 3, 4, 4, 2, 2, 2, 2, 3, 4, 2, 3, 4, 3, 4, 3, 4, 2, 3, 3, 4, 4, 2, 4, 3, 3,
+		2, 2, 3, 4, 3, 2, 2, 4, 4, 3, 2, 3, 3, 2, 2, 3, 2, 2, 2, 2, 4, 2, 2, 2, 2, 3, 3, 2, 4, 3, 4, 4,
+	},
+	{
+		2, 2, 2, 4, 2, 2, 4, 2, 2, 2, 2, 2, 4, 4, 4, 3, 2, 2, 4, 2, 3, 3, 3, 4, 2, 3, 3, 2, 3, 2, 2, 2,
+		3, 2, 3, 2, 3, 3, 2, 3, 2, 3, 3, 3, 4, 3, 3, 4, 2, 3, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 4, 2, 3, 2,
+		4, 2, 2, 2, 3, 4, 2, 3, 3, 3, 4, 2, 2, 2, 3, 3, 3, 3, 2, 4, 3, 3, 2, 3, 3, 2, 3, 2, 4, 2, 2, 2,
+		3, 4, 3, 2, 2, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 2, 4, 4, 4, 3, 3, 2, 3, 4, 3, 3, 2, 4, 4, 3, 4, 4,
+		4, 3, 3, 3, 3, 4, 2, 2, 2, 2, 3, 2, 2, 3, 4, 4, 4, 2, 3, 3, 2, 2, 3, 4, 4, 3, 2, 2, 2, 3, 3, 2,
+		4, 4, 4, 3, 3, 3, 4, 4, 3, 2, 2, 2, 2, 2, 3, 3, 2, 4, 4, 3, 4, 4, 4, 2, 2, 3, 4, 3, 4, 4, 3, 2,
+		4, 4, 2, 4, 2, 3, 3, 4, 4, 2, 3, 3, 4, 3, 4, 4, 3, 3, 3, 3, 3, 2, 4, 2, 3, 2, 3, 4, 3, 4, 4, 2,
+		4, 4, 2, 3, 4, 3, 3, 2, 3, 4, 3, 2, 3, 4, 4, 2, 2, 4, 4, 4, 4, 4, 4, 4, 2, 2, 4, 3, 4, 4, 4, 3,
+	},
+	{
+		4, 3, 2, 3, 2, 2, 2, 2, 2, 3, 4, 2, 3, 2, 2, 4, 2, 3, 2, 3, 2, 4, 4, 4, 3, 4, 2, 3, 3, 2, 4, 3,
+		3, 2, 2, 3, 2, 3, 2, 2, 2, 3, 2, 2, 2, 4, 4, 2, 2, 2, 2, 4, 2, 4, 3, 4, 4, 4, 2, 2, 3, 2, 4, 2,
+		3, 3, 4, 4, 4, 2, 3, 4, 4, 3, 3, 2, 4, 4, 2, 2, 4, 4, 4, 4, 2, 4, 4, 4, 4, 2, 3, 4, 4, 4, 4, 4,
+		4, 2, 3, 2, 4, 4, 3, 4, 2, 4, 3, 2, 4, 4, 2, 2, 4, 2, 2, 2, 2, 2, 2, 3, 4, 2, 4, 4, 4, 4, 2, 3,
+		2, 2, 2, 4, 4, 2, 2, 2, 2, 2, 4, 4, 4, 2, 4, 4, 4, 2, 3, 4, 4, 4, 2, 4, 2, 2, 3, 3, 4, 4, 4, 4,
+		2, 2, 4, 2, 2, 4, 4, 3, 2, 4, 2, 2, 4, 2, 4, 4, 4, 4, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 4,
+		4, 3, 3, 2, 4, 2, 4, 4, 4, 3, 4, 4, 3, 4, 2, 2, 2, 2, 2, 2, 2, 4, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4,
+		4, 3, 4, 3, 2, 4, 3, 2, 4, 3, 4, 4, 4, 4, 4, 2, 2, 2, 2, 4, 4, 3, 4, 4, 4, 4, 2, 3, 2, 4, 2, 4,
+	},
+	{
+		2, 4, 4, 4, 2, 4, 2, 4, 3, 3, 2, 3, 3, 2, 2, 4, 4, 2, 2, 4, 4, 2, 4, 4, 2, 4, 4, 4, 2, 3, 4, 2,
+		4, 4, 2, 4, 3, 4, 4, 4, 4, 2, 3, 2, 4, 4, 4, 4, 3, 2, 4, 2, 3, 2, 2, 2, 3, 2, 2, 2, 4, 4, 4, 4,
+		3, 2, 2, 3, 2, 4, 2, 4, 4, 2, 2, 4, 4, 4, 4, 2, 3, 3, 2, 3, 3, 3, 4, 3, 3, 2, 3, 3, 3, 3, 2, 3,
+		2, 2, 4, 3, 3, 4, 2, 2, 2, 3, 2, 3, 4, 2, 4, 2, 3, 3, 4, 3, 2, 3, 2, 4, 3, 2, 3, 4, 2, 3, 2, 3,
+		2, 4, 2, 3, 4, 3, 2, 3, 3, 3, 2, 3, 3, 2, 4, 3, 2, 2, 4, 4, 2, 4, 2, 3, 3, 3, 3, 3, 3, 2, 2, 2,
+		2, 2, 3, 3, 3, 3, 3, 4, 4, 2, 2, 2, 4, 4, 3, 2, 3, 2, 2, 3, 3, 3, 3, 2, 3, 3, 2, 2, 2, 2, 2, 3,
+		4, 4, 3, 2, 3, 3, 3, 3, 2, 2, 4, 4, 3, 4, 4, 2, 3, 4, 3, 3, 4, 2, 4, 2, 4, 4, 2, 2, 2, 2, 3, 3,
+		4, 3, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 3, 2, 3, 4, 3, 4, 4, 2, 2, 3, 3, 2, 3, 2, 3, 2, 2, 2, 2, 2,
+	},
+	{
+		2, 3, 2, 4, 3, 2, 2, 3, 3, 3, 3, 3, 4, 3, 3, 3, 4, 3, 4, 2, 2, 4, 3, 2, 2, 2, 3, 2, 2, 2, 2, 4,
+		2, 2, 3, 2, 3, 4, 2, 2, 4, 2, 4, 2, 3, 2, 2, 2, 4, 3, 2, 4, 2, 2, 2, 3, 3, 3, 3, 4, 3, 2, 3, 3,
+		3, 3, 2, 2, 4, 3, 3, 4, 3, 2, 2, 3, 4, 3, 3, 3, 3, 3, 2, 2, 4, 3, 4, 2, 3, 4, 2, 2, 3, 3, 2, 2,
+		3, 2, 3, 4, 3, 3, 2, 4, 3, 4, 4, 2, 3, 4, 4, 3, 2, 3, 2, 4, 4, 2, 2, 2, 2, 3, 4, 4, 4, 2, 4, 2,
+		2, 2, 2, 2, 2, 2, 4, 2, 4, 4, 4, 4, 3, 4, 2, 4, 3, 3, 4, 4, 3, 4, 2, 2, 2, 2, 2, 2, 2, 4, 2, 4,
+		4, 3, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 4, 4, 4, 4, 4, 3, 2, 3, 2, 4, 4, 3, 3, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 2, 4, 4, 4, 2, 3, 4, 4, 2, 4, 4, 4, 3, 4, 4, 2, 2, 4, 4,
+		2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 4, 3, 4, 2, 3, 4, 2, 2, 3, 2, 3, 4, 4, 4, 2, 3, 2, 3, 2, 4,
+	},
+	{
+		4, 3, 2, 2, 2, 2, 3, 3, 2, 2, 2, 4, 4, 4, 3, 4, 2, 3, 4, 2, 3, 2, 3, 3, 2, 3, 4, 3, 2, 4, 4, 4,
+		4, 2, 3, 4, 3, 4, 4, 3, 4, 3, 2, 2, 2, 2, 4, 2, 4, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 2, 4, 4, 2, 4,
+		4, 4, 4, 4, 2, 4, 2, 3, 2, 4, 4, 4, 3, 2, 4, 2, 3, 4, 4, 2, 2, 4, 2, 2, 2, 4, 2, 2, 2, 2, 4, 2,
+		2, 2, 4, 4, 2, 4, 2, 4, 4, 3, 2, 4, 4, 2, 2, 3, 2, 4, 4, 2, 2, 2, 2, 4, 2, 4, 4, 2, 4, 4, 4, 4,
+		4, 4, 4, 2, 3, 2, 4, 3, 4, 4, 4, 2, 2, 4, 2, 2, 2, 2, 4, 4, 3, 4, 2, 4, 2, 4, 4, 2, 4, 3, 4, 4,
+		4, 4, 4, 2, 2, 2, 2, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 4, 4, 2, 4, 4, 2, 4, 3, 2, 3, 2, 3, 3, 2, 2,
+		4, 2, 4, 4, 2, 2, 4, 4, 2, 3, 2, 4, 2, 3, 2, 4, 2, 4, 3, 2, 3, 4, 3, 2, 4, 2, 2, 2, 2, 3, 3, 4,
+		4, 3, 3, 2, 2, 3, 3, 3, 3, 2, 2, 3, 2, 2, 3, 2, 4, 3, 3, 3, 3, 2, 2, 3, 2, 4, 2, 2, 2, 3, 3, 4,
+	},
+	{
+		2, 2, 3, 3, 4, 2, 3, 2, 2, 2, 4, 2, 3, 2, 4, 2, 2, 3, 2, 2, 4, 3, 3, 4, 3, 4, 3, 3, 2, 3, 2, 3,
+		4, 4, 4, 4, 4, 3, 2, 2, 4, 4, 2, 3, 2, 3, 2, 2, 2, 2, 2, 3, 4, 2, 3, 3, 3, 2, 2, 2, 2, 3, 4, 2,
+		3, 4, 2, 3, 4, 3, 2, 2, 2, 2, 4, 4, 3, 4, 4, 4, 2, 2, 2, 4, 3, 3, 2, 3, 4, 4, 2, 3, 4, 4, 2, 3,
+		4, 3, 3, 3, 2, 2, 4, 4, 4, 4, 4, 3, 4, 4, 4, 4, 4, 2, 3, 3, 3, 4, 3, 2, 3, 3, 2, 3, 3, 3, 3, 2,
+		4, 2, 4, 2, 4, 2, 2, 3, 4, 4, 3, 4, 4, 4, 2, 3, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 3, 4, 3, 2, 2, 2,
+		3, 2, 4, 4, 4, 4, 3, 3, 4, 2, 4, 3, 4, 3, 4, 2, 4, 4, 4, 4, 4, 3, 3, 3, 3, 4, 2, 2, 2, 2, 3, 2,
+		2, 3, 3, 2, 3, 4, 4, 4, 3, 3, 3, 4, 4, 2, 4, 2, 2, 4, 4, 3, 4, 4, 3, 4, 4, 4, 3, 4, 4, 3, 4, 3,
+		3, 4, 3, 3, 2, 4, 4, 4, 4, 4, 2, 2, 3, 2, 4, 4, 2, 4, 4, 3, 2, 2, 3, 3, 2, 2, 3, 2, 2, 2, 3, 3,
+	},
+	{
+		2, 3, 4, 2, 3, 4, 2, 4, 3, 2, 3, 3, 2, 2, 2, 3, 2, 2, 3, 3, 3, 3, 2, 3, 3, 2, 4, 3, 2, 4, 2, 3,
+		2, 2, 4, 4, 4, 2, 3, 3, 4, 3, 2, 2, 2, 3, 4, 2, 4, 3, 2, 4, 2, 3, 4, 3, 4, 2, 2, 2, 3, 2, 2, 2,
+		4, 2, 2, 4, 4, 2, 3, 2, 3, 4, 3, 4, 3, 2, 3, 4, 2, 2, 2, 2, 4, 2, 4, 3, 4, 3, 2, 2, 2, 3, 2, 2,
+		2, 2, 3, 2, 3, 3, 2, 4, 2, 3, 3, 3, 3, 3, 2, 4, 3, 3, 2, 4, 4, 2, 4, 3, 4, 3, 2, 2, 3, 4, 4, 3,
+		3, 3, 4, 2, 2, 3, 4, 3, 3, 3, 3, 3, 3, 2, 2, 2, 3, 3, 3, 2, 2, 2, 4, 3, 3, 3, 2, 4, 3, 2, 3, 4,
+		3, 3, 2, 2, 2, 4, 4, 2, 3, 3, 3, 4, 3, 4, 3, 4, 2, 2, 4, 2, 2, 3, 4, 3, 2, 3, 2, 4, 4, 3, 4, 4,
+		4, 4, 2, 3, 2, 3, 2, 2, 2, 4, 2, 2, 3, 3, 2, 4, 4, 4, 4, 2, 4, 4, 3, 3, 3, 3, 2, 2, 2, 3, 4, 2,
+		3, 4, 2, 4, 4, 4, 2, 2, 4, 2, 3, 3, 2, 4, 4, 4, 2, 3, 2, 4, 4, 3, 2, 4, 3, 2, 4, 4, 2, 3, 2, 3,
+	},
+	{
+		4, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 3, 3, 4, 4, 3, 4, 3, 3, 3, 4, 2, 4, 4, 3, 4, 3, 4, 2,
+		3, 3, 4, 2, 4, 3, 4, 3, 3, 3, 3, 3, 4, 4, 4, 3, 2, 2, 4, 4, 4, 3, 2, 4, 2, 4, 2, 2, 2, 2, 2, 2,
+		4, 4, 4, 3, 4, 4, 3, 4, 2, 4, 2, 2, 4, 3, 2, 2, 3, 2, 2, 4, 4, 3, 2, 2, 4, 3, 4, 4, 2, 4, 4, 4,
+		2, 2, 3, 3, 3, 3, 4, 4, 3, 3, 3, 3, 3, 3, 4, 3, 3, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+		4, 4, 2, 4, 3, 3, 4, 4, 4, 3, 4, 2, 3, 3, 4, 2, 4, 2, 4, 2, 3, 4, 3, 4, 2, 2, 3, 4, 4, 4, 2, 3,
+		3, 2, 4, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 4, 4, 3, 2, 3, 3, 3, 4, 3, 4, 4, 3, 3, 3, 4, 4,
+		4, 4, 2, 4, 4, 3, 3, 3, 4, 4, 4, 3, 4, 4, 4, 4, 2, 3, 2, 4, 4, 3, 2, 2, 3, 4, 3, 4, 3, 4, 2, 3,
+		3, 3, 4, 2, 4, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 4, 3, 3, 4, 3, 4, 4, 3, 3, 3, 4, 2, 4, 4,
+	},
+	{
+		3, 3, 2, 4, 4, 4, 3, 2, 3, 3, 4, 4, 2, 3, 3, 3, 4, 2, 3, 4, 4, 3, 4, 2, 4, 2, 3, 3, 3, 4, 2, 3,
+		2, 2, 2, 3, 2, 2, 2, 3, 4, 4, 2, 4, 4, 2, 4, 4, 2, 2, 4, 2, 3, 2, 4, 3, 2, 2, 2, 4, 2, 2, 3, 3,
+		4, 4, 2, 2, 3, 4, 4, 3, 3, 4, 4, 3, 3, 3, 3, 4, 2, 2, 4, 4, 4, 3, 4, 2, 3, 2, 3, 4, 2, 3, 4, 3,
+		2, 4, 3, 3, 2, 4, 4, 3, 3, 2, 4, 3, 4, 2, 3, 2, 3, 4, 4, 4, 4, 3, 3, 3, 2, 4, 4, 2, 3, 2, 3, 2,
+		4, 2, 3, 4, 2, 2, 2, 2, 2, 4, 3, 4, 4, 4, 3, 2, 3, 3, 4, 4, 3, 2, 4, 2, 2, 2, 3, 4, 2, 4, 2, 4,
+		2, 4, 4, 2, 3, 2, 2, 3, 4, 3, 4, 3, 3, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 2, 4, 2, 4, 2, 4, 2, 3, 4,
+		2, 4, 3, 4, 2, 4, 4, 3, 3, 3, 3, 3, 4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 4, 2, 2, 2, 2, 2, 4, 4,
+		4, 2, 2, 3, 4, 4, 3, 4, 4, 4, 4, 4, 2, 4, 4, 2, 4, 4, 3, 2, 2, 3, 3, 3, 3, 4, 3, 4, 3, 4, 3, 3,
+	},
+	{
+		3, 4, 2, 4, 4, 2, 2, 4, 3, 4, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 4, 3, 3, 2, 2, 4, 3, 3, 2, 2, 2, 3,
+		4, 3, 3, 4, 4, 4, 2, 4, 2, 4, 3, 4, 2, 4, 3, 2, 3, 2, 3, 3, 3, 2, 3, 2, 2, 2, 4, 2, 2, 4, 3, 3,
+		3, 3, 4, 4, 2, 2, 4, 3, 3, 3, 4, 3, 2, 3, 3, 2, 4, 3, 3, 3, 3, 2, 2, 2, 3, 4, 4, 3, 4, 2, 4, 2,
+		4, 4, 4, 3, 4, 4, 4, 2, 2, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 3, 4, 2, 3, 4, 2, 3, 4, 4, 3, 4, 3, 3,
+		3, 4, 2, 4, 3, 2, 3, 4, 4, 3, 3, 2, 4, 2, 4, 4, 2, 3, 3, 3, 4, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 4, 3, 3, 4, 4, 4, 4, 3, 2, 4, 4, 3, 4, 2, 4, 3, 2, 4, 3, 3, 4, 3,
+		2, 2, 3, 2, 3, 2, 3, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 4, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 3, 3, 3, 3, 4, 3, 4, 3, 3, 4, 4, 3, 4, 4, 4, 4, 3, 3, 3, 3,
+	},
+	{
+		4, 3, 3, 4, 2, 2, 2, 3, 3, 3, 2, 4, 4, 4, 4, 4, 4, 3, 2, 4, 4, 4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 3, 3, 4, 4, 2, 3, 2, 2, 4, 4, 4, 2, 4, 2, 4, 4, 3, 4, 4, 3, 3, 2,
+		4, 4, 3, 4, 4, 4, 3, 4, 4, 3, 4, 4, 3, 3, 3, 3, 3, 4, 2, 2, 4, 3, 4, 4, 4, 4, 4, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 4, 2, 3, 3, 3, 2, 3, 2, 4, 4, 4, 4, 3, 3, 2, 2, 4, 3, 3, 4, 2, 3, 3, 4, 4, 2, 2,
+		3, 4, 4, 3, 3, 4, 2, 4, 3, 3, 4, 2, 3, 4, 4, 3, 4, 4, 3, 2, 4, 2, 3, 4, 3, 3, 2, 3, 4, 4, 4, 4,
+		3, 3, 3, 3, 4, 3, 2, 3, 3, 3, 3, 4, 3, 4, 4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 2,
+		3, 2, 4, 4, 4, 4, 3, 4, 4, 3, 4, 4, 4, 3, 4, 3, 3, 2, 3, 4, 2, 4, 3, 4, 4, 4, 3, 3, 4, 4, 2, 4,
+		4, 3, 2, 3, 4, 4, 2, 4, 4, 3, 3, 4, 2, 3, 3, 4, 4, 4, 4, 4, 3, 4, 4, 2, 2, 3, 2, 2, 2, 2, 2, 2,
+	},
+	{
+		2, 2, 2, 2, 2, 2, 3, 2, 2, 4, 4, 4, 4, 3, 4, 3, 4, 2, 4, 3, 3, 4, 3, 3, 4, 2, 4, 4, 3, 2, 3, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 3, 4, 3, 3, 4, 4, 4, 2, 2, 4, 3, 4, 3, 4, 2, 4, 2, 2, 2, 3, 3, 4,
+		4, 4, 2, 4, 2, 2, 2, 2, 2, 2, 2, 4, 2, 4, 4, 2, 4, 3, 3, 4, 3, 2, 2, 2, 3, 4, 2, 4, 4, 4, 4, 3,
+		4, 4, 2, 2, 2, 4, 4, 3, 4, 3, 2, 4, 4, 3, 4, 3, 4, 2, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 2, 4, 2, 4,
+		2, 2, 4, 2, 2, 4, 2, 3, 3, 4, 4, 4, 4, 2, 2, 4, 3, 2, 3, 3, 2, 3, 4, 4, 4, 3, 3, 2, 4, 4, 3, 4,
+		4, 2, 3, 4, 3, 3, 4, 2, 2, 3, 2, 3, 3, 3, 3, 2, 3, 4, 3, 3, 2, 2, 2, 2, 2, 2, 2, 3, 3, 4, 3, 3,
+		2, 3, 3, 4, 3, 3, 2, 3, 2, 4, 3, 3, 2, 3, 3, 4, 4, 2, 3, 2, 3, 2, 4, 4, 3, 4, 3, 4, 2, 2, 2, 2,
+		3, 2, 3, 4, 4, 2, 3, 2, 4, 4, 2, 4, 3, 3, 2, 4, 3, 3, 3, 4, 3, 2, 2, 3, 4, 2, 3, 3, 4, 4, 3, 4,
+	},
+	{
+		3, 4, 2, 4, 4, 2, 3, 4, 2, 4, 2, 2, 4, 4, 4, 3, 4, 2, 2, 4, 3, 4, 4, 4, 3, 3, 2, 4, 3, 3, 2, 2,
+		4, 4, 4, 3, 3, 4, 4, 2, 2, 4, 3, 3, 3, 4, 4, 3, 2, 2, 4, 4, 2, 2, 3, 4, 3, 3, 2, 3, 2, 4, 3, 3,
+		2, 4, 2, 4, 2, 3, 4, 2, 3, 3, 4, 2, 2, 2, 2, 3, 2, 3, 2, 4, 3, 3, 3, 3, 3, 3, 2, 2, 4, 3, 3, 2,
+		2, 2, 3, 3, 4, 4, 3, 4, 4, 2, 4, 2, 3, 2, 2, 4, 2, 2, 3, 4, 3, 3, 4, 3, 3, 4, 4, 4, 4, 2, 2, 4,
+		4, 4, 3, 3, 4, 2, 2, 3, 2, 2, 2, 2, 4, 2, 2, 2, 3, 3, 4, 2, 4, 3, 4, 3, 2, 3, 2, 3, 3, 4, 4, 3,
+		4, 3, 4, 2, 3, 3, 2, 3, 4, 2, 4, 3, 3, 2, 4, 3, 3, 2, 4, 4, 2, 2, 4, 3, 4, 3, 2, 4, 3, 3, 2, 4,
+		2, 3, 4, 4, 4, 3, 4, 2, 2, 2, 2, 3, 3, 4, 3, 3, 4, 2, 4, 4, 2, 2, 3, 3, 2, 2, 4, 4, 2, 4, 4, 4,
+		2, 4, 3, 2, 2, 3, 3, 2, 3, 3, 2, 2, 3, 3, 4, 4, 4, 3, 4, 4, 4, 4, 2, 2, 2, 2, 3, 4, 4, 4, 2, 2,
+	},
+	{
+		3, 2, 3, 4, 4, 4, 3, 3, 4, 4, 3, 4, 3, 4, 3, 3, 4, 4, 4, 3, 3, 3, 2, 2, 2, 2, 2, 2, 4, 4, 2, 3,
+		3, 4, 4, 2, 3, 3, 4, 3, 3, 2, 2, 4, 2, 3, 4, 3, 2, 3, 4, 4, 4, 4, 4, 2, 2, 4, 4, 2, 2, 2, 2, 2,
+		2, 3, 3, 3, 2, 3, 2, 4, 2, 3, 4, 2, 3, 2, 2, 3, 2, 4, 3, 2, 2, 2, 2, 2, 2, 4, 3, 4, 4, 3, 3, 4,
+		2, 4, 4, 2, 3, 4, 3, 2, 3, 2, 4, 2, 4, 2, 3, 3, 3, 4, 4, 2, 3, 2, 3, 3, 4, 4, 3, 4, 4, 2, 3, 2,
+		4, 2, 2, 2, 3, 2, 4, 3, 3, 3, 4, 4, 4, 3, 2, 2, 4, 3, 2, 2, 4, 4, 3, 3, 3, 4, 2, 2, 2, 3, 2, 4,
+		4, 4, 3, 2, 2, 2, 2, 2, 3, 4, 4, 3, 2, 2, 3, 4, 4, 3, 4, 2, 3, 4, 2, 4, 3, 3, 4, 4, 2, 4, 4, 2,
+		4, 2, 2, 2, 3, 2, 3, 3, 4, 3, 4, 4, 4, 2, 2, 4, 2, 2, 4, 2, 2, 2, 3, 2, 4, 3, 4, 4, 3, 3, 4, 2,
+		3, 2, 2, 4, 4, 2, 3, 2, 4, 3, 2, 4, 3, 4, 4, 2, 3, 2, 3, 3, 3, 2, 4, 3, 3, 3, 2, 2, 3, 2, 3, 3,
+	},
+	{
+		3, 4, 2, 3, 4, 4, 2, 2, 3, 3, 4, 3, 2, 3, 2, 4, 4, 2, 4, 4, 3, 3, 2, 3, 4, 2, 2, 3, 2, 3, 2, 3,
+		4, 4, 4, 4, 2, 2, 3, 3, 3, 2, 3, 3, 3, 3, 3, 2, 2, 3, 2, 4, 3, 3, 2, 2, 4, 4, 4, 4, 4, 3, 4, 4,
+		2, 2, 2, 2, 2, 4, 3, 4, 4, 3, 2, 4, 4, 4, 3, 3, 3, 3, 2, 3, 2, 4, 3, 3, 2, 4, 4, 2, 3, 4, 3, 3,
+		3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 4, 3, 2, 3, 3, 3, 3, 3, 4, 3, 4, 3, 4, 4, 4, 4, 3, 4, 3, 3,
+		2, 4, 2, 4, 4, 4, 4, 3, 2, 3, 2, 3, 4, 4, 4, 2, 3, 4, 4, 3, 4, 3, 2, 3, 4, 4, 3, 2, 3, 3, 2, 4,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 3, 3, 2, 4, 4, 3, 4, 3, 4, 3, 4, 4, 4, 2, 2, 2, 2,
+		4, 4, 4, 4, 3, 4, 4, 2, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 2, 2, 2, 4, 3, 3, 4, 4, 3, 3, 4,
+		2, 2, 3, 4, 4, 3, 4, 4, 2, 3, 4, 4, 3, 4, 4, 3, 4, 3, 4, 3, 3, 3, 4, 4, 4, 2, 4, 2, 4, 2, 2, 3,
+	},
+	{
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 3, 4, 2, 4, 3, 3, 2, 4, 2, 4, 4, 2, 4,
+		4, 3, 2, 2, 2, 4, 4, 2, 4, 3, 3, 4, 2, 4, 4, 4, 2, 4, 4, 4, 4, 4, 2, 2, 3, 3, 4, 4, 3, 3, 2, 2,
+		3, 3, 3, 3, 4, 3, 3, 2, 3, 4, 2, 4, 3, 4, 4, 4, 3, 3, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 4, 4, 4, 2, 4, 4, 2, 4, 4, 3, 4, 4, 4, 2, 4, 4, 4, 4, 3,
+		4, 3, 3, 3, 2, 3, 3, 4, 2, 4, 4, 4, 4, 2, 2, 4, 4, 4, 4, 3, 3, 2, 4, 3, 2, 2, 2, 4, 4, 3, 2, 3,
+		4, 3, 3, 4, 4, 2, 2, 3, 3, 4, 4, 4, 4, 3, 4, 3, 3, 3, 4, 3, 4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 3, 2, 4, 4, 4, 3, 2, 3, 4, 3, 4, 2, 4, 4, 3, 4, 4, 3, 4, 3, 3, 2, 3, 2, 4, 4, 4, 3,
+		3, 4, 2, 3, 4, 2, 4, 3, 4, 4, 4, 4, 4, 2, 3, 4, 4, 4, 3, 4, 4, 3, 4, 4, 4, 3, 3, 3, 4, 4, 2, 2,
+	},
+	{
+		2, 2, 2, 2, 4, 3, 4, 4, 4, 2, 4, 4, 4, 3, 3, 4, 4, 4, 3, 4, 4, 4, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 4, 2, 2, 2, 2, 4, 3, 2, 4, 4, 4, 4, 2, 4, 4, 4, 2, 4, 4, 4, 2, 4,
+		4, 4, 4, 2, 4, 4, 2, 2, 4, 4, 3, 4, 4, 2, 4, 4, 2, 4, 4, 3, 3, 2, 4, 4, 4, 4, 3, 3, 4, 3, 3, 4,
+		3, 2, 4, 3, 2, 4, 4, 2, 3, 4, 4, 3, 4, 3, 3, 4, 4, 4, 2, 2, 4, 3, 4, 3, 4, 3, 4, 4, 2, 2, 2, 2,
+		2, 2, 3, 4, 2, 2, 3, 2, 2, 2, 2, 2, 2, 4, 4, 2, 4, 4, 2, 4, 3, 3, 4, 4, 2, 4, 4, 3, 3, 2, 4, 2,
+		4, 4, 2, 3, 4, 4, 3, 4, 3, 4, 4, 3, 4, 3, 3, 4, 4, 4, 2, 4, 3, 4, 4, 3, 2, 4, 2, 3, 4, 4, 4, 4,
+		2, 3, 4, 3, 4, 2, 4, 2, 2, 4, 4, 3, 3, 3, 4, 4, 3, 2, 2, 3, 4, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2,
+		2, 2, 4, 2, 4, 4, 4, 4, 3, 2, 2, 4, 4, 3, 4, 2, 2, 4, 4, 3, 4, 2, 4, 4, 4, 2, 2, 4, 4, 3, 4, 4,
+	},
+	{
+		4, 3, 3, 2, 4, 3, 4, 4, 4, 4, 3, 2, 2, 4, 2, 4, 2, 3, 2, 3, 4, 4, 4, 4, 4, 3, 2, 4, 2, 4, 3, 3,
+		4, 3, 2, 3, 2, 4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 4, 3, 2, 2, 3, 3, 3, 4, 4, 3, 4, 4,
+		4, 4, 2, 2, 3, 2, 4, 3, 3, 4, 2, 3, 2, 4, 4, 4, 4, 4, 2, 2, 4, 4, 4, 2, 3, 3, 4, 4, 2, 4, 4, 3,
+		4, 3, 3, 2, 4, 2, 4, 4, 4, 4, 4, 3, 2, 4, 2, 4, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 3, 4,
+		3, 4, 2, 4, 3, 4, 2, 4, 2, 4, 2, 2, 4, 4, 4, 2, 3, 4, 4, 4, 3, 4, 4, 3, 2, 2, 4, 4, 3, 2, 4, 4,
+		3, 4, 3, 3, 4, 4, 4, 2, 4, 2, 2, 2, 3, 4, 3, 3, 2, 2, 2, 3, 4, 2, 4, 4, 3, 4, 4, 3, 2, 4, 2, 2,
+		2, 2, 3, 3, 2, 4, 4, 4, 2, 2, 2, 4, 4, 4, 2, 4, 4, 4, 2, 3, 2, 2, 2, 2, 2, 4, 3, 3, 4, 3, 4, 4,
+		4, 4, 2, 2, 2, 3, 2, 4, 4, 2, 4, 4, 3, 2, 4, 4, 4, 4, 2, 4, 2, 2, 2, 2, 4, 4, 3, 3, 4, 2, 2, 2,
+	},
+	{
+		4, 2, 4, 4, 3, 2, 2, 2, 4, 4, 3, 4, 2, 2, 2, 4, 3, 4, 4, 4, 2, 2, 3, 4, 4, 4, 4, 2, 2, 2, 4, 2,
+		3, 3, 2, 3, 2, 4, 2, 2, 4, 2, 2, 2, 4, 4, 2, 4, 2, 4, 3, 4, 4, 2, 4, 4, 4, 4, 3, 4, 4, 3, 3, 4,
+		2, 4, 4, 4, 2, 4, 4, 3, 4, 3, 4, 4, 3, 4, 3, 2, 3, 4, 2, 2, 4, 4, 4, 2, 2, 3, 2, 4, 3, 2, 4, 3,
+		4, 3, 3, 3, 3, 3, 3, 3, 2, 2, 3, 2, 2, 4, 2, 2, 2, 2, 3, 2, 2, 2, 4, 3, 3, 3, 2, 3, 2, 2, 4, 3,
+		4, 2, 4, 3, 4, 2, 3, 2, 4, 3, 3, 2, 4, 4, 4, 4, 2, 4, 2, 2, 4, 4, 3, 4, 3, 4, 2, 4, 2, 2, 4, 4,
+		4, 2, 4, 4, 3, 4, 4, 4, 2, 2, 4, 4, 2, 4, 3, 3, 4, 2, 3, 4, 2, 3, 4, 3, 2, 2, 3, 2, 3, 4, 2, 3,
+		3, 2, 2, 4, 4, 3, 3, 4, 4, 4, 4, 3, 4, 3, 2, 3, 4, 2, 3, 3, 3, 2, 4, 3, 4, 2, 3, 3, 2, 2, 4, 2,
+		4, 2, 4, 4, 4, 2, 4, 4, 4, 2, 2, 3, 3, 2, 2, 3, 4, 2, 4, 4, 2, 2, 2, 4, 4, 4, 2, 4, 4, 3, 4, 4,
+	},
+	{
+		4, 4, 4, 4, 4, 3, 4, 2, 3, 4, 2, 4, 4, 4, 2, 3, 3, 3, 2, 3, 4, 4, 3, 2, 4, 4, 4, 3, 2, 4, 2, 3,
+		4, 4, 2, 3, 3, 4, 3, 3, 3, 2, 4, 3, 3, 2, 3, 3, 4, 2, 2, 3, 3, 2, 4, 2, 3, 2, 2, 4, 2, 2, 3, 4,
+		3, 3, 3, 4, 2, 2, 4, 2, 2, 2, 4, 4, 4, 3, 3, 4, 3, 2, 4, 2, 4, 3, 2, 3, 2, 3, 2, 3, 4, 3, 3, 3,
+		3, 3, 2, 2, 2, 4, 4, 4, 3, 4, 3, 4, 2, 4, 2, 4, 3, 4, 3, 4, 3, 2, 3, 2, 4, 2, 3, 4, 2, 3, 3, 2,
+		4, 3, 3, 3, 4, 3, 3, 4, 3, 3, 4, 4, 3, 3, 4, 4, 3, 2, 3, 4, 3, 4, 3, 2, 3, 3, 4, 3, 4, 4, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 4, 3, 2, 4, 3, 2, 3, 4, 2, 4, 4, 3, 3, 4, 3, 3, 3, 3, 3,
+		4, 3, 4, 4, 3, 3, 4, 4, 2, 3, 3, 2, 3, 4, 2, 4, 4, 4, 4, 3, 4, 3, 3, 3, 2, 4, 4, 3, 3, 4, 4, 2,
+		3, 3, 3, 3, 2, 3, 2, 4, 3, 4, 2, 4, 4, 4, 4, 3, 3, 3, 4, 3, 2, 3, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2,
+	},
+	{
+		4, 4, 2, 4, 4, 2, 2, 4, 4, 4, 4, 3, 3, 4, 3, 4, 4, 4, 4, 2, 2, 2, 4, 3, 4, 4, 4, 3, 2, 4, 3, 4,
+		4, 2, 4, 2, 2, 3, 2, 3, 4, 3, 3, 3, 4, 4, 3, 4, 4, 3, 3, 4, 4, 3, 3, 4, 3, 3, 4, 3, 4, 3, 3, 4,
+		4, 3, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 3, 3, 2, 2, 2, 4, 4,
+		4, 4, 4, 4, 4, 3, 3, 4, 4, 3, 3, 2, 3, 4, 3, 4, 4, 2, 2, 2, 3, 4, 4, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+		4, 2, 4, 4, 4, 3, 4, 3, 3, 3, 3, 4, 3, 4, 3, 2, 4, 4, 4, 3, 3, 3, 2, 4, 4, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 4, 2, 3, 3, 2, 2, 3, 4, 4, 3, 2, 4, 3, 2, 4, 4, 3, 4, 4, 3,
+		4, 2, 4, 2, 3, 3, 3, 3, 4, 4, 4, 3, 3, 4, 2, 4, 4, 3, 3, 4, 4, 4, 4, 4, 3, 3, 3, 4, 4, 4, 3, 4,
+		4, 3, 4, 4, 3, 4, 3, 2, 3, 4, 3, 3, 3, 4, 3, 4, 4, 3, 4, 3, 4, 3, 4, 3, 2, 3, 3, 3, 4, 4, 2, 2,
+	},
+	{
+		4, 2, 2, 4, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 4, 3, 2, 4,
+		3, 3, 4, 3, 3, 3, 3, 4, 4, 2, 2, 4, 3, 3, 4, 3, 4, 4, 3, 4, 3, 4, 4, 2, 3, 4, 3, 4, 4, 4, 3, 4,
+		4, 4, 2, 3, 3, 4, 4, 4, 2, 4, 3, 4, 2, 3, 3, 2, 2, 4, 4, 4, 3, 4, 3, 2, 3, 2, 4, 3, 4, 4, 4, 3,
+		4, 4, 4, 3, 4, 4, 4, 3, 4, 3, 2, 4, 2, 2, 3, 3, 2, 4, 3, 4, 4, 2, 2, 4, 4, 4, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 4, 3, 2, 2, 2, 4, 4, 4, 3, 2, 4, 4, 4, 2, 3, 4, 3, 4, 2, 4, 3, 3, 4, 4,
+		4, 4, 3, 4, 4, 3, 4, 3, 2, 2, 3, 3, 2, 2, 4, 3, 4, 4, 4, 4, 3, 2, 3, 4, 2, 4, 3, 2, 3, 4, 4, 4,
+		4, 4, 3, 4, 3, 3, 4, 3, 4, 4, 4, 3, 3, 4, 4, 4, 4, 3, 4, 3, 3, 3, 4, 2, 4, 2, 2, 2, 4, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 3, 4, 4, 3, 2, 4, 3, 2, 3, 4, 4, 3, 4, 4, 2, 4, 4, 4, 3, 3,
+	},
+	{
+		4, 3, 3, 4, 2, 4, 3, 4, 4, 4, 4, 2, 2, 4, 4, 3, 2, 2, 4, 3, 3, 3, 2, 2, 4, 4, 4, 2, 4, 2, 4, 4,
+		3, 4, 3, 3, 2, 4, 4, 4, 2, 3, 3, 3, 3, 4, 4, 3, 4, 3, 3, 3, 2, 4, 4, 4, 3, 4, 4, 4, 4, 2, 3, 3,
+		4, 4, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 3, 4, 4, 3, 4, 2, 4, 3, 2, 4, 3, 2, 4, 4, 3,
+		3, 4, 4, 4, 3, 2, 3, 4, 2, 4, 4, 4, 4, 3, 3, 3, 3, 2, 4, 4, 2, 2, 4, 4, 3, 2, 3, 4, 3, 4, 4, 4,
+		3, 2, 4, 2, 3, 4, 3, 4, 3, 4, 2, 4, 4, 4, 3, 2, 4, 2, 4, 4, 4, 4, 4, 3, 2, 2, 2, 2, 2, 2, 4, 2,
+		3, 3, 4, 4, 3, 4, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 3, 2, 3, 2, 4, 3, 4, 2, 4, 4, 2, 4,
+		3, 3, 3, 3, 4, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 2, 2, 4, 3, 2, 2, 3, 2, 2, 3, 4, 4, 4, 3,
+		3, 3, 4, 4, 3, 2, 4, 4, 4, 3, 2, 3, 3, 4, 3, 3, 3, 3, 4, 2, 4, 2, 2, 4, 2, 2, 3, 4, 4, 2, 3, 4,
+	},
+	{
+		4, 4, 2, 2, 4, 4, 3, 4, 2, 3, 4, 3, 4, 4, 4, 3, 2, 3, 2, 2, 4, 3, 4, 4, 3, 4, 3, 3, 4, 3, 2, 3,
+		4, 4, 4, 4, 4, 2, 4, 4, 3, 4, 4, 4, 2, 2, 2, 4, 3, 4, 3, 4, 4, 4, 2, 4, 4, 4, 4, 4, 4, 2, 3, 4,
+		4, 4, 4, 4, 4, 4, 4, 2, 4, 4, 4, 2, 3, 2, 2, 2, 2, 3, 4, 2, 2, 4, 4, 4, 3, 2, 4, 4, 2, 4, 3, 4,
+		4, 4, 4, 3, 3, 4, 4, 2, 4, 4, 4, 3, 2, 2, 2, 2, 3, 4, 2, 2, 4, 2, 3, 2, 3, 2, 4, 2, 3, 3, 2, 2,
+		2, 2, 4, 4, 4, 4, 4, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 4, 3, 4, 4, 3, 4, 2, 4, 3, 4, 2, 2, 2, 2, 4,
+		2, 4, 2, 2, 3, 2, 2, 2, 2, 4, 2, 3, 3, 3, 3, 3, 4, 4, 2, 3, 4, 4, 2, 4, 3, 2, 3, 2, 2, 2, 4, 2,
+		2, 2, 2, 2, 2, 4, 4, 4, 3, 2, 3, 4, 2, 4, 4, 3, 2, 4, 4, 4, 4, 2, 2, 4, 3, 3, 4, 2, 4, 4, 4, 2,
+		4, 4, 4, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 2, 2, 4, 4, 2, 4, 4, 4, 3, 4, 4, 4, 3, 2, 4,
+	},
+	{
+		4, 2, 4, 2, 4, 2, 4, 2, 2, 3, 3, 4, 4, 4, 4, 2, 4, 2, 2, 4, 2, 2, 2, 4, 2, 3, 3, 4, 3, 2, 4, 4,
+		4, 3, 4, 4, 2, 4, 3, 2, 4, 2, 2, 2, 2, 2, 4, 4, 3, 4, 4, 2, 2, 2, 3, 2, 2, 2, 4, 2, 2, 2, 2, 2,
+		2, 4, 4, 4, 4, 2, 3, 4, 2, 3, 2, 4, 3, 4, 3, 2, 4, 2, 4, 4, 4, 2, 3, 2, 4, 3, 4, 2, 3, 4, 3, 4,
+		4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 4, 2, 3, 2, 3, 2, 4, 2, 4, 2, 2, 2, 2, 2, 4, 2, 2, 4, 2, 3, 2, 2,
+		4, 4, 4, 2, 3, 4, 4, 4, 2, 4, 3, 2, 2, 2, 2, 4, 4, 2, 3, 2, 3, 2, 2, 4, 2, 3, 4, 4, 4, 4, 4, 3,
+		4, 4, 2, 2, 4, 4, 2, 4, 3, 4, 4, 2, 3, 2, 2, 4, 4, 3, 4, 4, 2, 4, 2, 2, 4, 3, 2, 2, 4, 4, 3, 4,
+		4, 4, 4, 3, 3, 4, 4, 4, 3, 3, 4, 4, 2, 2, 3, 4, 3, 2, 3, 2, 4, 3, 4, 2, 4, 3, 4, 4, 3, 2, 2, 3,
+		3, 4, 4, 2, 4, 3, 3, 3, 4, 2, 2, 2, 3, 3, 3, 2, 4, 4, 4, 2, 3, 2, 2, 2, 3, 4, 2, 3, 3, 4, 3, 4,
+	},
+	{
+		2, 4, 4, 4, 2, 4, 3, 4, 2, 2, 4, 2, 4, 3, 2, 2, 3, 2, 2, 4, 4, 2, 2, 2, 2, 4, 4, 3, 2, 4, 4, 4,
+		2, 2, 4, 4, 2, 2, 4, 4, 3, 4, 3, 2, 3, 3, 2, 2, 3, 2, 2, 2, 2, 3, 3, 2, 3, 3, 3, 3, 2, 3, 3, 4,
+		2, 4, 4, 2, 4, 2, 3, 3, 3, 4, 4, 4, 3, 2, 2, 4, 2, 2, 3, 4, 2, 2, 3, 2, 3, 3, 4, 3, 2, 3, 4, 3,
+		3, 3, 3, 4, 2, 2, 2, 3, 2, 3, 4, 2, 4, 2, 4, 3, 4, 2, 3, 4, 3, 2, 4, 4, 4, 3, 2, 4, 4, 3, 4, 4,
+		3, 3, 2, 2, 3, 4, 4, 2, 4, 4, 2, 4, 4, 4, 4, 2, 4, 4, 3, 4, 2, 4, 3, 4, 4, 2, 4, 3, 2, 4, 4, 2,
+		2, 4, 3, 4, 4, 4, 4, 3, 4, 4, 4, 2, 3, 2, 4, 3, 4, 2, 2, 2, 4, 4, 2, 2, 2, 2, 4, 2, 2, 4, 2, 4,
+		3, 4, 3, 4, 3, 4, 4, 2, 2, 4, 4, 4, 4, 2, 3, 2, 3, 4, 4, 2, 4, 2, 4, 3, 4, 3, 4, 2, 4, 2, 2, 4,
+		3, 3, 2, 4, 4, 2, 4, 2, 4, 3, 4, 4, 2, 2, 2, 2, 2, 2, 2, 4, 4, 2, 4, 3, 3, 3, 4, 4, 3, 3, 4, 4,
+	},
+	{
+		4, 4, 2, 2, 2, 2, 2, 4, 4, 2, 4, 4, 4, 2, 2, 4, 2, 4, 4, 3, 2, 2, 3, 4, 4, 3, 2, 3, 3, 4, 4, 2,
+		2, 2, 4, 4, 2, 3, 4, 4, 2, 3, 2, 2, 2, 4, 2, 2, 4, 4, 4, 4, 3, 4, 3, 3, 2, 2, 4, 4, 4, 2, 3, 3,
+		4, 2, 4, 4, 3, 3, 2, 2, 2, 4, 4, 2, 4, 4, 3, 2, 3, 4, 4, 2, 2, 2, 2, 3, 4, 4, 4, 4, 2, 4, 4, 4,
+		4, 4, 4, 2, 2, 4, 4, 4, 3, 4, 4, 4, 4, 2, 4, 4, 3, 2, 3, 4, 2, 3, 4, 3, 3, 2, 3, 3, 4, 4, 4, 4,
+		3, 4, 4, 4, 3, 4, 3, 3, 4, 3, 4, 3, 2, 2, 4, 2, 2, 2, 4, 4, 4, 4, 3, 4, 2, 2, 2, 2, 2, 4, 2, 3,
+		4, 4, 4, 2, 4, 3, 4, 2, 3, 3, 2, 3, 4, 4, 2, 2, 2, 2, 3, 3, 4, 4, 4, 3, 4, 4, 2, 3, 4, 2, 4, 4,
+		3, 2, 4, 4, 2, 4, 4, 4, 4, 2, 3, 4, 4, 3, 2, 2, 2, 2, 4, 4, 4, 2, 4, 4, 4, 4, 4, 4, 4, 4, 3, 2,
+		3, 2, 2, 4, 2, 4, 2, 4, 4, 4, 3, 4, 2, 3, 3, 2, 2, 2, 2, 2, 4, 4, 4, 2, 4, 2, 4, 2, 4, 4, 3, 4,
+	},
+	{
+		4, 4, 2, 3, 4, 3, 3, 4, 4, 3, 3, 4, 4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 4, 3, 2, 4, 2, 2,
+		4, 4, 3, 4, 4, 3, 3, 2, 3, 4, 3, 4, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 3, 2, 2, 2, 2, 3,
+		4, 3, 4, 2, 4, 2, 4, 2, 2, 2, 4, 4, 2, 4, 4, 4, 4, 4, 4, 2, 4, 3, 2, 4, 2, 3, 3, 3, 3, 2, 3, 3,
+		2, 2, 4, 3, 3, 2, 2, 4, 2, 3, 3, 2, 2, 3, 4, 3, 3, 4, 4, 4, 2, 4, 2, 2, 2, 4, 2, 2, 4, 4, 3, 4,
+		3, 4, 2, 3, 2, 4, 4, 4, 4, 4, 4, 3, 2, 2, 2, 2, 4, 2, 4, 2, 4, 4, 2, 4, 3, 2, 4, 2, 3, 2, 3, 3,
+		4, 4, 2, 3, 2, 4, 3, 3, 3, 3, 4, 4, 2, 4, 2, 4, 3, 4, 4, 2, 2, 4, 4, 4, 4, 2, 4, 4, 2, 3, 4, 3,
+		4, 4, 4, 4, 2, 4, 2, 2, 2, 2, 3, 4, 2, 2, 2, 3, 2, 2, 2, 2, 3, 4, 3, 4, 4, 4, 3, 4, 3, 4, 4, 4,
+		3, 4, 3, 3, 3, 4, 3, 2, 4, 5, 2, 2, 4, 2, 4, 2, 2, 2, 2, 2, 4, 4, 3, 3, 2, 2, 2, 4, 2, 4, 4, 4,
+	},
+	{
+		4, 2, 4, 4, 3, 2, 2, 4, 4, 2, 2, 4, 3, 3, 2, 4, 4, 4, 4, 4, 4, 3, 4, 4, 3, 2, 3, 2, 3, 4, 2, 3,
+		2, 4, 3, 2, 2, 3, 3, 2, 3, 3, 4, 3, 3, 3, 4, 4, 3, 3, 3, 3, 2, 2, 2, 3, 3, 4, 4, 2, 2, 3, 4, 4,
+		4, 2, 2, 2, 2, 2, 2, 4, 4, 2, 2, 3, 3, 2, 3, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 3, 3, 4, 3, 3, 2, 4,
+		2, 2, 3, 4, 4, 3, 3, 2, 2, 2, 3, 3, 4, 2, 2, 4, 3, 2, 2, 2, 2, 2, 3, 4, 3, 4, 2, 2, 2, 4, 4, 3,
+		4, 2, 2, 2, 4, 2, 3, 3, 2, 2, 3, 3, 4, 2, 2, 3, 4, 3, 2, 2, 4, 4, 2, 2, 4, 3, 3, 2, 2, 3, 2, 2,
+		2, 2, 3, 3, 3, 3, 2, 4, 2, 2, 4, 3, 2, 2, 2, 2, 4, 2, 3, 3, 2, 3, 4, 2, 3, 3, 4, 4, 3, 3, 3, 4,
+		4, 4, 3, 2, 4, 3, 2, 3, 2, 2, 3, 4, 4, 3, 4, 4, 4, 4, 4, 2, 3, 3, 2, 4, 3, 3, 4, 3, 2, 4, 3, 4,
+		3, 4, 3, 3, 4, 2, 4, 4, 2, 2, 2, 2, 2, 4, 2, 4, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 3, 4, 4, 4, 4, 3,
+	},
+	{
+		3, 3, 2, 4, 2, 2, 2, 2, 4, 3, 4, 3, 4, 3, 2, 4, 4, 4, 2, 3, 4, 4, 4, 2, 2, 4, 4, 4, 4, 4, 4, 3,
+		3, 3, 3, 4, 3, 4, 3, 3, 4, 3, 2, 2, 2, 4, 2, 4, 4, 4, 4, 4, 3, 4, 2, 2, 3, 2, 3, 2, 4, 4, 2, 2,
+		2, 2, 3, 4, 2, 2, 3, 4, 4, 4, 2, 2, 3, 2, 2, 2, 4, 2, 3, 4, 2, 2, 3, 4, 3, 4, 4, 2, 4, 2, 2, 3,
+		4, 3, 3, 2, 4, 3, 2, 2, 2, 3, 4, 2, 3, 4, 3, 2, 4, 3, 3, 2, 2, 4, 2, 2, 3, 4, 2, 3, 3, 3, 3, 4,
+		2, 4, 3, 2, 3, 2, 3, 3, 3, 4, 4, 3, 2, 2, 3, 4, 2, 2, 4, 3, 2, 4, 3, 2, 2, 4, 3, 4, 4, 4, 4, 2,
+		2, 2, 2, 2, 4, 2, 4, 2, 2, 2, 4, 4, 2, 4, 3, 4, 3, 2, 2, 2, 3, 4, 2, 2, 4, 2, 3, 4, 2, 4, 4, 3,
+		2, 2, 3, 3, 4, 3, 3, 2, 3, 4, 3, 2, 2, 3, 3, 2, 2, 2, 3, 4, 3, 2, 2, 2, 2, 2, 4, 3, 3, 4, 3, 3,
+		2, 3, 2, 3, 3, 3, 4, 3, 2, 4, 3, 2, 4, 4, 3, 3, 4, 4, 3, 4, 3, 4, 2, 4, 3, 3, 4, 4, 3, 2, 3, 2,
+	},
+	{
+		2, 3, 2, 4, 4, 4, 2, 3, 4, 3, 4, 3, 2, 2, 2, 2, 4, 4, 4, 4, 2, 4, 2, 2, 2, 4, 4, 4, 2, 4, 2, 3,
+		3, 2, 4, 4, 2, 4, 2, 4, 3, 3, 2, 2, 2, 4, 2, 4, 2, 4, 4, 4, 4, 4, 3, 3, 3, 4, 3, 4, 3, 4, 3, 2,
+		2, 2, 2, 2, 4, 4, 4, 4, 2, 2, 4, 4, 4, 4, 4, 3, 2, 2, 4, 2, 4, 4, 4, 2, 2, 4, 4, 3, 3, 2, 3, 4,
+		4, 3, 3, 3, 2, 3, 3, 4, 3, 4, 3, 3, 3, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 4, 3, 4, 3,
+		4, 4, 4, 4, 3, 4, 2, 3, 4, 4, 2, 3, 3, 4, 3, 4, 2, 3, 2, 2, 2, 4, 2, 4, 2, 4, 4, 4, 4, 4, 3, 3,
+		3, 4, 4, 4, 2, 3, 2, 3, 4, 2, 3, 4, 3, 3, 2, 2, 3, 4, 4, 3, 4, 4, 4, 4, 2, 2, 4, 3, 3, 3, 2, 3,
+		2, 2, 4, 2, 4, 2, 2, 3, 2, 4, 4, 2, 4, 4, 4, 4, 4, 2, 2, 3, 4, 4, 2, 3, 4, 4, 3, 3, 3, 2, 4, 2,
+		4, 2, 3, 3, 2, 3, 2, 4, 4, 3, 2, 2, 4, 3, 3, 3, 4, 4, 4, 3, 2, 2, 2, 4, 4, 4, 4, 4, 4, 3, 2, 2,
+	},
+	{
+		2, 2, 3, 4, 2, 4, 4, 2, 2, 4, 2, 2, 3, 3, 4, 4, 4, 4, 4, 4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3,
+		3, 4, 4, 4, 2, 3, 4, 3, 4, 4, 4, 4, 4, 3, 4, 4, 3, 4, 3, 4, 3, 4, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 3, 2, 4, 2, 2, 4, 4, 4, 2, 4, 4, 3, 2, 4, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 3, 4, 2,
+		4, 2, 4, 2, 4, 4, 2, 2, 4, 4, 4, 3, 3, 4, 4, 3, 4, 4, 2, 2, 2, 2, 2, 2, 2, 4, 2, 4, 3, 2, 4, 3,
+		4, 2, 2, 4, 4, 4, 4, 4, 2, 3, 2, 2, 3, 2, 3, 4, 2, 3, 2, 3, 4, 4, 4, 3, 3, 4, 4, 2, 2, 2, 4, 3,
+		4, 4, 4, 3, 4, 4, 2, 3, 4, 3, 4, 4, 4, 4, 2, 2, 3, 2, 4, 3, 4, 2, 2, 2, 2, 2, 3, 4, 3, 2, 3, 2,
+		2, 3, 2, 4, 4, 3, 2, 2, 4, 4, 3, 3, 4, 4, 4, 4, 3, 4, 2, 2, 4, 3, 2, 2, 2, 2, 3, 4, 2, 4, 4, 4,
+		4, 4, 4, 4, 2, 4, 2, 3, 3, 4, 4, 2, 3, 4, 2, 3, 2, 2, 4, 4, 3, 2, 2, 3, 2, 4, 3, 4, 4, 4, 4, 4,
+	},
+	{
+		2, 3, 4, 2, 4, 4, 2, 2, 2, 4, 2, 2, 4, 2, 3, 2, 4, 4, 4, 4, 4, 2, 2, 4, 2, 3, 2, 4, 4, 4, 4, 2,
+		2, 4, 2, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 4, 2, 4, 2, 4, 2, 2, 2, 4, 2, 2, 4, 4, 3, 2, 2, 4, 3, 4,
+		3, 3, 4, 2, 4, 4, 3, 3, 3, 3, 4, 4, 4, 2, 2, 4, 3, 4, 4, 4, 4, 3, 3, 3, 2, 2, 3, 4, 4, 3, 3, 3,
+		3, 4, 2, 4, 4, 3, 2, 4, 3, 4, 4, 4, 2, 3, 2, 2, 4, 2, 4, 4, 4, 2, 2, 2, 2, 4, 3, 2, 4, 4, 2, 3,
+		2, 3, 4, 2, 2, 2, 2, 2, 4, 2, 4, 4, 2, 3, 3, 3, 4, 2, 4, 4, 4, 4, 4, 4, 4, 2, 4, 4, 4, 2, 2, 2,
+		4, 4, 4, 2, 4, 2, 3, 3, 4, 2, 3, 4, 4, 4, 3, 2, 4, 3, 4, 3, 4, 2, 4, 4, 4, 3, 3, 4, 2, 3, 3, 3,
+		3, 3, 2, 2, 2, 4, 2, 2, 3, 3, 2, 3, 2, 4, 4, 4, 2, 3, 3, 2, 2, 4, 4, 2, 3, 2, 2, 2, 4, 4, 4, 3,
+		4, 2, 2, 3, 3, 2, 3, 3, 2, 3, 4, 4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 2, 4, 3, 2, 2, 2, 2,
+	},
+	{
+		3, 2, 4, 4, 4, 3, 2, 2, 3, 2, 4, 3, 4, 3, 2, 2, 4, 4, 4, 4, 3, 4, 2, 4, 4, 4, 3, 4, 3, 2, 3, 3,
+		3, 2, 4, 2, 2, 2, 4, 2, 4, 2, 2, 4, 2, 2, 3, 4, 4, 3, 2, 2, 2, 2, 2, 3, 2, 4, 2, 3, 3, 3, 2, 3,
+		3, 2, 2, 2, 4, 2, 3, 4, 4, 2, 4, 3, 3, 3, 3, 2, 2, 2, 2, 2, 4, 2, 4, 3, 4, 2, 4, 4, 4, 2, 2, 4,
+		3, 3, 3, 2, 2, 2, 2, 4, 4, 3, 2, 3, 4, 4, 4, 2, 4, 4, 2, 2, 3, 4, 3, 2, 4, 3, 3, 4, 2, 2, 4, 3,
+		4, 3, 2, 2, 3, 4, 4, 4, 3, 4, 4, 4, 4, 2, 2, 4, 4, 2, 3, 2, 4, 3, 3, 3, 3, 4, 2, 2, 2, 2, 4, 3,
+		3, 2, 4, 4, 2, 2, 2, 2, 4, 3, 3, 4, 4, 2, 3, 3, 2, 4, 4, 4, 4, 4, 4, 4, 4, 2, 3, 2, 2, 2, 4, 3,
+		4, 4, 2, 2, 3, 3, 2, 3, 2, 2, 3, 3, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 4, 3, 2, 2, 2, 2, 2, 3,
+		3, 2, 2, 3, 4, 3, 4, 2, 2, 2, 2, 4, 2, 3, 4, 3, 2, 2, 2, 2, 2, 2, 3, 4, 2, 3, 3, 4, 2, 3, 2, 3,
+	},
+	{
+		4, 4, 2, 2, 4, 4, 3, 2, 4, 4, 4, 2, 2, 2, 4, 4, 4, 3, 4, 4, 2, 2, 2, 2, 4, 3, 4, 3, 2, 4, 3, 2,
+		3, 2, 4, 4, 4, 4, 3, 2, 3, 2, 4, 4, 3, 4, 3, 4, 4, 4, 4, 4, 4, 4, 2, 2, 4, 2, 2, 4, 2, 2, 2, 2,
+		4, 2, 2, 2, 4, 4, 3, 4, 4, 3, 4, 3, 4, 3, 4, 3, 3, 3, 3, 2, 3, 2, 3, 2, 4, 2, 2, 2, 2, 2, 2, 2,
+		3, 4, 2, 4, 4, 4, 4, 3, 2, 4, 2, 2, 2, 4, 3, 2, 4, 4, 4, 4, 4, 3, 4, 3, 4, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 4, 2, 3, 4, 2, 3, 4, 2, 4, 3, 4, 4, 4, 3, 4, 4, 2, 2, 3, 3, 4, 3, 4, 4, 2, 4, 4, 3, 2, 2,
+		3, 3, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 4, 3, 2, 4, 2, 3, 2, 2, 3, 4, 2, 4, 3, 4, 2, 2, 2, 2, 4, 2,
+		3, 3, 2, 2, 3, 2, 3, 3, 2, 3, 4, 4, 3, 2, 4, 2, 2, 2, 2, 2, 4, 4, 2, 2, 4, 3, 4, 3, 4, 4, 4, 4,
+		3, 3, 4, 4, 3, 4, 3, 4, 4, 3, 4, 4, 2, 2, 2, 2, 4, 4, 4, 4, 4, 2, 2, 3, 4, 4, 2, 4, 2, 4, 3, 4,
+	},
+	{
+		4, 4, 4, 4, 2, 4, 4, 3, 2, 4, 4, 4, 3, 3, 4, 4, 4, 3, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 4, 4, 3, 4,
+		4, 3, 4, 3, 2, 4, 4, 3, 4, 4, 3, 3, 4, 4, 2, 2, 4, 2, 2, 4, 2, 2, 2, 3, 3, 4, 2, 4, 4, 3, 3, 3,
+		3, 2, 2, 3, 2, 4, 2, 4, 4, 4, 4, 2, 3, 3, 2, 2, 3, 2, 2, 4, 4, 2, 2, 4, 2, 4, 4, 4, 4, 2, 2, 3,
+		3, 2, 2, 3, 3, 3, 4, 4, 2, 4, 4, 4, 3, 2, 3, 4, 2, 2, 3, 3, 2, 4, 2, 2, 4, 4, 4, 2, 2, 3, 2, 4,
+		4, 4, 2, 2, 4, 4, 2, 2, 4, 3, 4, 2, 4, 4, 2, 2, 2, 4, 3, 2, 4, 3, 4, 3, 4, 2, 2, 2, 2, 2, 4, 3,
+		2, 4, 4, 4, 2, 3, 2, 2, 4, 2, 2, 2, 2, 2, 2, 4, 2, 3, 4, 3, 4, 3, 2, 2, 2, 3, 4, 4, 4, 3, 3, 4,
+		2, 2, 2, 2, 2, 4, 2, 2, 4, 2, 3, 4, 4, 2, 5, 2, 4, 4, 4, 2, 4, 3, 3, 4, 2, 3, 2, 2, 3, 3, 3, 3,
+		3, 2, 3, 2, 2, 2, 2, 3, 4, 2, 4, 2, 4, 2, 4, 3, 3, 4, 4, 2, 4, 2, 4, 4, 3, 2, 2, 3, 2, 4, 3, 2,
+	},
+	{
+		3, 4, 3, 4, 3, 3, 3, 3, 4, 3, 3, 3, 4, 3, 4, 4, 3, 4, 4, 4, 3, 3, 4, 3, 4, 3, 3, 3, 3, 4, 4, 4,
+		3, 3, 3, 2, 2, 2, 2, 2, 4, 4, 2, 3, 4, 2, 3, 3, 3, 3, 3, 3, 2, 4, 4, 2, 4, 3, 4, 4, 3, 4, 4, 4,
+		3, 4, 3, 3, 3, 4, 3, 4, 2, 2, 4, 2, 2, 2, 4, 4, 3, 4, 4, 4, 4, 3, 4, 2, 4, 2, 2, 3, 4, 2, 3, 4,
+		2, 3, 3, 4, 2, 2, 3, 4, 3, 4, 4, 4, 2, 4, 3, 4, 3, 3, 3, 3, 2, 2, 2, 2, 2, 3, 4, 4, 4, 4, 2, 4,
+		4, 3, 2, 4, 4, 4, 4, 2, 4, 2, 2, 2, 4, 4, 4, 3, 2, 3, 4, 3, 4, 2, 4, 2, 2, 2, 2, 2, 3, 4, 3, 4,
+		3, 4, 3, 4, 2, 2, 4, 4, 2, 4, 4, 2, 3, 3, 4, 4, 3, 3, 3, 2, 3, 3, 2, 4, 3, 4, 3, 3, 4, 3, 3, 3,
+		4, 4, 4, 2, 4, 4, 4, 3, 2, 4, 3, 4, 4, 2, 4, 2, 2, 2, 3, 2, 2, 2, 2, 4, 3, 3, 3, 4, 2, 3, 3, 4,
+		3, 4, 2, 3, 2, 2, 4, 4, 3, 3, 4, 2, 3, 2, 4, 3, 4, 4, 3, 4, 3, 2, 4, 4, 2, 3, 4, 3, 2, 2, 2, 2,
+	},
+	{
+		2, 2, 2, 4, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4, 4, 3, 3, 4, 4, 4, 4, 4, 4, 2, 2, 4, 3, 4, 3, 3, 4,
+		4, 4, 4, 3, 4, 4, 2, 2, 2, 4, 4, 3, 2, 4, 3, 3, 4, 3, 3, 4, 3, 3, 4, 3, 4, 3, 4, 4, 4, 3, 3, 3,
+		4, 3, 4, 3, 4, 3, 3, 4, 3, 4, 2, 2, 4, 2, 2, 2, 4, 4, 3, 4, 3, 3, 4, 4, 4, 3, 3, 2, 4, 2, 3, 4,
+		4, 3, 4, 4, 2, 2, 2, 2, 4, 3, 3, 3, 2, 3, 2, 4, 4, 2, 4, 3, 4, 4, 4, 4, 4, 3, 4, 4, 3, 3, 4, 2,
+		4, 4, 3, 2, 2, 2, 4, 4, 4, 2, 4, 4, 3, 4, 2, 3, 2, 4, 2, 3, 3, 4, 3, 4, 4, 4, 4, 4, 3, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	},
+	{
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 4, 3, 2, 2, 3, 4, 4,
+		2, 2, 2, 4, 3, 4, 2, 2, 3, 2, 4, 4, 3, 4, 2, 4, 3, 4, 2, 2, 3, 3, 2, 2, 4, 2, 2, 4, 4, 4, 4, 3,
+		4, 4, 2, 4, 2, 4, 4, 4, 4, 3, 3, 4, 4, 4, 3, 2, 3, 2, 3, 4, 2, 3, 4, 3, 2, 3, 4, 4, 4, 4, 4, 4,
+		2, 2, 2, 4, 2, 3, 4, 4, 3, 4, 3, 3, 3, 4, 3, 2, 2, 4, 4, 2, 3, 4, 4, 2, 2, 2, 3, 4, 4, 4, 3, 2,
+		4, 4, 4, 2, 3, 4, 4, 4, 3, 3, 2, 2, 4, 4, 2, 3, 4, 4, 3, 4, 2, 4, 3, 4, 3, 3, 4, 4, 3, 3, 4, 3,
+		4, 3, 4, 4, 2, 3, 2, 4, 2, 4, 4, 4, 3, 4, 3, 4, 4, 4, 3, 2, 3, 3, 2, 4, 2, 2, 2, 4, 4, 2, 4, 3,
+		3, 3, 4, 4, 2, 4, 4, 2, 4, 3, 4, 4, 4, 4, 3, 4, 3, 3, 4, 3, 4, 4, 2, 4, 4, 3, 2, 3, 3, 4, 4, 4,
+	},
+	{
+		3, 3, 2, 3, 3, 3, 3, 4, 2, 2, 2, 3, 3, 3, 4, 4, 3, 3, 3, 2, 4, 3, 4, 3, 3, 3, 2, 4, 3, 2, 4, 4,
+		2, 4, 2, 2, 4, 2, 3, 2, 3, 4, 4, 2, 4, 2, 2, 2, 4, 2, 2, 3, 4, 4, 3, 4, 2, 4, 2, 2, 2, 3, 4, 3,
+		2, 2, 2, 4, 2, 2, 3, 4, 4, 2, 3, 2, 2, 2, 2, 4, 4, 4, 3, 2, 2, 2, 3, 2, 3, 2, 3, 2, 4, 4, 3, 2,
+		2, 2, 2, 2, 4, 2, 2, 4, 2, 2, 2, 2, 4, 2, 2, 3, 3, 3, 3, 3, 2, 4, 3, 3, 4, 4, 2, 2, 2, 3, 3, 3,
+		2, 2, 4, 2, 3, 3, 3, 3, 2, 3, 4, 3, 3, 2, 2, 4, 4, 2, 4, 3, 2, 4, 3, 2, 3, 4, 3, 3, 4, 3, 2, 2,
+		2, 3, 3, 4, 2, 3, 2, 2, 2, 3, 3, 3, 2, 4, 4, 3, 2, 3, 3, 2, 3, 4, 2, 2, 4, 2, 3, 2, 2, 2, 2, 2,
+		2, 2, 4, 3, 3, 4, 2, 4, 4, 4, 4, 2, 3, 4, 3, 4, 4, 4, 2, 2, 4, 4, 3, 4, 4, 4, 3, 3, 4, 3, 3, 2,
+		4, 3, 2, 4, 3, 3, 4, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 3, 4, 3, 3, 4, 2, 2, 3, 4, 4, 4, 3, 3, 4, 2,
+	},
+	{
+		4, 4, 3, 2, 2, 3, 3, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 3, 2, 4, 4, 2, 4, 2, 4, 4, 4,
+		2, 4, 4, 3, 3, 4, 2, 4, 2, 3, 2, 3, 4, 4, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 2, 2, 4, 3, 2,
+		2, 2, 2, 4, 4, 2, 3, 4, 2, 2, 4, 3, 3, 4, 3, 4, 3, 3, 4, 3, 3, 3, 2, 2, 2, 2, 2, 4, 4, 2, 4, 2,
+		4, 4, 4, 2, 4, 3, 3, 4, 2, 4, 2, 3, 2, 2, 3, 4, 3, 3, 4, 3, 3, 2, 4, 4, 3, 3, 3, 2, 2, 2, 2, 3,
+		3, 2, 3, 4, 2, 2, 4, 4, 3, 4, 3, 4, 4, 4, 2, 3, 2, 2, 2, 2, 2, 4, 2, 4, 3, 4, 3, 3, 3, 3, 4, 4,
+		3, 2, 4, 4, 2, 2, 4, 4, 3, 3, 2, 4, 4, 2, 4, 2, 4, 4, 4, 3, 4, 4, 2, 4, 2, 4, 3, 4, 4, 3, 3, 3,
+		3, 2, 3, 3, 4, 4, 3, 4, 2, 3, 4, 2, 4, 3, 2, 3, 4, 4, 4, 2, 2, 4, 2, 4, 3, 4, 3, 4, 2, 4, 4, 3,
+		4, 4, 3, 3, 2, 3, 4, 3, 3, 4, 3, 2, 3, 3, 4, 2, 2, 2, 4, 3, 3, 2, 2, 4, 4, 4, 3, 3, 3, 2, 3, 4,
+	},
+	{
+		3, 4, 3, 2, 4, 3, 2, 3, 3, 3, 3, 4, 3, 3, 2, 2, 3, 4, 3, 2, 3, 4, 4, 2, 2, 2, 2, 3, 3, 4, 3, 3,
+		4, 4, 3, 2, 2, 4, 2, 2, 3, 2, 3, 3, 3, 2, 2, 4, 2, 2, 4, 4, 4, 3, 3, 3, 4, 3, 4, 2, 4, 4, 2, 4,
+		4, 2, 4, 2, 4, 4, 2, 3, 2, 4, 2, 3, 2, 2, 4, 4, 4, 4, 4, 4, 2, 4, 4, 4, 3, 3, 4, 4, 4, 2, 4, 4,
+		2, 4, 2, 4, 4, 2, 3, 2, 4, 4, 2, 4, 4, 4, 3, 3, 2, 3, 3, 2, 4, 4, 2, 3, 4, 2, 2, 2, 4, 4, 3, 4,
+		4, 2, 2, 4, 4, 4, 2, 2, 2, 2, 4, 3, 2, 3, 4, 4, 4, 4, 3, 4, 4, 2, 2, 2, 4, 3, 4, 4, 2, 3, 4, 3,
+		4, 4, 4, 3, 4, 3, 2, 4, 4, 4, 2, 4, 3, 3, 4, 3, 3, 3, 2, 3, 4, 4, 4, 3, 3, 3, 4, 3, 4, 3, 3, 2,
+		4, 2, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 3, 2, 4, 2, 3, 3, 2, 3, 3,
+		4, 4, 2, 3, 4, 3, 3, 3, 4, 2, 4, 4, 4, 4, 2, 3, 4, 3, 4, 4, 4, 4, 4, 2, 2, 4, 4, 4, 2, 2, 4, 2,
+	},
+	{
+		4, 3, 3, 3, 3, 3, 3, 4, 4, 3, 2, 2, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 4, 3, 2, 4, 2, 4, 4, 2, 4, 2,
+		4, 2, 4, 2, 4, 4, 4, 4, 3, 4, 4, 3, 4, 4, 2, 4, 2, 3, 3, 4, 3, 3, 3, 4, 3, 3, 4, 4, 4, 2, 2, 4,
+		3, 4, 4, 3, 4, 4, 2, 4, 4, 3, 3, 4, 4, 4, 4, 3, 3, 4, 3, 4, 3, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 3, 3, 2, 4, 3, 3, 4, 4, 4,
+		2, 4, 2, 4, 2, 2, 3, 4, 4, 3, 3, 4, 4, 4, 3, 4, 4, 2, 3, 3, 4, 4, 3, 4, 3, 4, 4, 4, 2, 4, 3, 2,
+		3, 2, 3, 4, 4, 4, 4, 3, 4, 4, 4, 3, 2, 2, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 4,
+		4, 3, 4, 4, 4, 3, 4, 4, 4, 4, 3, 4, 3, 2, 4, 4, 2, 4, 2, 2, 3, 4, 4, 4, 4, 4, 2, 4, 3, 4, 4, 3,
+		3, 4, 4, 4, 4, 4, 2, 4, 4, 3, 4, 4, 4, 2, 4, 3, 3, 3, 3, 4, 3, 4, 4, 2, 3, 4, 4, 4, 4, 3, 4, 4,
+	},
+	{
+		2, 4, 2, 3, 3, 2, 4, 3, 2, 4, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2,
+		2, 2, 2, 4, 2, 2, 2, 2, 2, 4, 2, 4, 3, 4, 2, 4, 4, 3, 4, 4, 4, 3, 4, 4, 3, 4, 4, 4, 3, 3, 2, 4,
+		4, 2, 4, 4, 4, 4, 3, 4, 2, 3, 2, 4, 4, 4, 4, 2, 4, 4, 4, 2, 4, 2, 4, 3, 2, 4, 4, 3, 2, 4, 4, 4,
+		4, 3, 2, 3, 2, 4, 3, 4, 4, 3, 2, 3, 3, 3, 4, 4, 4, 2, 2, 4, 4, 3, 4, 3, 4, 4, 4, 2, 2, 4, 4, 2,
+		2, 2, 3, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 4, 4, 4, 3, 4, 2, 2, 4, 2, 2, 4, 4, 3, 4, 4, 3, 4, 3, 4,
+		4, 4, 4, 2, 4, 2, 2, 4, 4, 4, 4, 4, 4, 2, 4, 4, 4, 4, 3, 2, 4, 2, 4, 2, 3, 4, 4, 4, 3, 2, 2, 3,
+		3, 4, 4, 2, 3, 4, 3, 4, 2, 3, 3, 3, 4, 4, 4, 4, 4, 3, 4, 3, 4, 2, 4, 4, 2, 2, 2, 4, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 3, 2, 3, 4, 4, 4, 4, 4, 4, 2, 4, 4, 2, 4, 4, 4, 4, 4, 4, 3,
+	},
+	{
+		4, 2, 4, 2, 2, 2, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 3, 4, 3, 3, 4, 4, 3, 4, 4, 3, 2, 4, 4, 4, 4,
+		4, 3, 2, 3, 4, 3, 4, 4, 4, 4, 4, 4, 3, 3, 4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 3, 4, 2,
+		4, 4, 2, 3, 4, 4, 4, 4, 3, 3, 3, 2, 2, 4, 4, 2, 2, 4, 2, 4, 4, 4, 4, 4, 4, 3, 2, 4, 2, 4, 3, 2,
+		4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 4, 4, 3, 4, 2, 2, 4, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 2, 3, 2,
+		4, 4, 4, 4, 3, 4, 4, 3, 4, 4, 3, 4, 4, 4, 4, 4, 4, 3, 2, 2, 3, 4, 4, 2, 4, 4, 4, 3, 3, 4, 4, 4,
+		4, 4, 4, 4, 4, 2, 3, 4, 3, 3, 3, 2, 2, 2, 2, 3, 3, 4, 2, 4, 4, 4, 4, 4, 4, 3, 3, 2, 2, 4, 4, 4,
+		4, 2, 4, 4, 4, 4, 4, 4, 4, 3, 2, 4, 2, 3, 4, 3, 3, 4, 4, 2, 2, 3, 2, 4, 4, 4, 4, 2, 4, 3, 4, 4,
+		2, 4, 4, 4, 3, 3, 4, 2, 4, 3, 3, 4, 4, 4, 2, 4, 4, 4, 4, 2, 2, 2, 4, 3, 4, 3, 3, 3, 2, 4, 4, 4,
+	},
+	{
+		4, 4, 2, 2, 4, 4, 3, 3, 2, 4, 3, 3, 4, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 3, 4, 4, 3, 4, 4, 2, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 4, 2, 4, 3, 4, 2, 2, 4, 4, 4, 4, 4, 4, 2, 3, 4, 4, 4, 4, 2, 4, 3,
+		4, 2, 2, 4, 2, 2, 4, 4, 4, 2, 2, 4, 4, 4, 3, 2, 3, 2, 4, 4, 3, 3, 4, 2, 2, 4, 2, 3, 3, 2, 3, 3,
+		2, 4, 4, 4, 4, 4, 2, 3, 4, 4, 4, 3, 2, 4, 4, 4, 4, 3, 2, 4, 4, 2, 2, 4, 2, 3, 3, 3, 4, 2, 2, 2,
+		2, 2, 2, 2, 2, 4, 4, 4, 2, 2, 3, 4, 3, 4, 4, 2, 4, 4, 2, 3, 4, 4, 4, 4, 4, 4, 4, 2, 3, 4, 4, 2,
+		2, 4, 4, 3, 3, 4, 2, 4, 4, 3, 3, 2, 2, 2, 2, 3, 4, 3, 2, 4, 4, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		3, 4, 4, 4, 3, 4, 3, 3, 4, 3, 2, 3, 4, 2, 2, 2, 3, 4, 2, 4, 3, 2, 4, 4, 4, 3, 4, 3, 4, 4, 3, 3,
+		2, 2, 4, 4, 3, 2, 4, 2, 4, 4, 4, 4, 4, 3, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 3, 4, 3, 2, 2, 3, 2,
+	},
+	{
+		3, 4, 3, 3, 4, 4, 3, 3, 3, 4, 3, 4, 4, 4, 4, 2, 2, 4, 4, 3, 2, 2, 2, 2, 3, 4, 4, 4, 3, 2, 4, 2,
+		4, 4, 3, 4, 4, 3, 4, 4, 4, 3, 4, 2, 4, 4, 4, 2, 4, 4, 4, 4, 3, 4, 2, 3, 4, 2, 4, 3, 4, 2, 4, 3,
+		4, 4, 4, 4, 2, 2, 4, 2, 2, 2, 2, 2, 3, 4, 4, 4, 4, 4, 4, 3, 4, 3, 4, 3, 4, 3, 4, 4, 4, 4, 4, 4,
+		3, 4, 4, 4, 4, 4, 3, 4, 3, 4, 4, 4, 4, 4, 4, 4, 2, 2, 2, 4, 3, 4, 3, 4, 3, 4, 4, 4, 2, 2, 2, 2,
+		2, 4, 3, 3, 4, 4, 2, 4, 4, 4, 2, 2, 2, 3, 2, 4, 4, 4, 4, 4, 4, 2, 4, 4, 4, 2, 4, 4, 4, 4, 3, 3,
+		2, 2, 3, 4, 4, 2, 2, 2, 2, 2, 4, 3, 4, 4, 4, 4, 4, 2, 4, 3, 4, 4, 4, 4, 4, 4, 3, 3, 4, 4, 4, 4,
+		3, 2, 4, 4, 4, 4, 3, 2, 3, 4, 4, 3, 4, 2, 2, 2, 2, 3, 3, 4, 4, 2, 2, 4, 4, 4, 2, 4, 4, 4, 4, 4,
+		3, 4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 4, 3, 4, 2, 3, 2, 2, 3, 4, 4, 2, 4, 4, 2, 3, 4, 3, 4, 2, 3, 4,
+	},
+	{
+		4, 4, 4, 4, 2, 3, 4, 2, 4, 4, 4, 4, 4, 3, 2, 2, 4, 4, 2, 4, 3, 3, 4, 4, 2, 4, 2, 4, 4, 4, 2, 3,
+		4, 3, 3, 3, 4, 4, 4, 2, 4, 4, 4, 4, 4, 2, 4, 4, 4, 3, 4, 4, 2, 4, 3, 4, 4, 3, 2, 3, 4, 4, 4, 4,
+		3, 4, 2, 4, 4, 2, 2, 2, 4, 2, 4, 4, 3, 3, 4, 2, 2, 2, 4, 3, 2, 4, 4, 3, 2, 3, 4, 3, 2, 3, 2, 2,
+		2, 3, 3, 3, 2, 2, 2, 4, 3, 4, 4, 3, 2, 4, 2, 4, 3, 4, 4, 2, 4, 4, 4, 3, 2, 3, 2, 2, 4, 3, 4, 4,
+		4, 3, 3, 4, 2, 2, 2, 2, 3, 4, 2, 3, 4, 3, 4, 2, 2, 4, 3, 4, 2, 4, 3, 4, 4, 4, 4, 4, 2, 2, 3, 4,
+		2, 4, 4, 2, 4, 2, 2, 4, 4, 2, 4, 3, 4, 2, 2, 2, 2, 3, 4, 2, 2, 2, 4, 4, 4, 4, 4, 2, 4, 4, 4, 2,
+		4, 3, 3, 2, 2, 2, 2, 2, 2, 4, 3, 4, 4, 4, 4, 2, 4, 2, 3, 2, 3, 3, 4, 4, 3, 3, 4, 4, 3, 3, 4, 3,
+		2, 3, 2, 2, 2, 2, 2, 4, 3, 2, 2, 4, 4, 2, 4, 3, 4, 4, 4, 3, 3, 2, 4, 4, 3, 3, 4, 4, 4, 3, 4, 2,
+	},
+	{
+		2, 4, 3, 2, 2, 4, 4, 3, 2, 4, 3, 4, 4, 2, 4, 2, 3, 4, 3, 3, 4, 3, 4, 4, 4, 4, 3, 2, 2, 2, 4, 4,
+		2, 3, 4, 4, 2, 3, 4, 4, 2, 4, 3, 3, 4, 4, 4, 4, 4, 4, 3, 4, 2, 4, 3, 4, 3, 2, 2, 3, 4, 3, 4, 2,
+		2, 4, 4, 2, 3, 2, 4, 2, 2, 4, 2, 4, 4, 2, 2, 4, 4, 4, 4, 4, 2, 2, 3, 4, 4, 4, 4, 4, 4, 4, 3, 3,
+		3, 4, 4, 4, 3, 2, 4, 2, 2, 4, 3, 4, 3, 4, 4, 3, 2, 4, 3, 4, 4, 2, 4, 2, 2, 4, 4, 4, 4, 2, 4, 3,
+		2, 3, 4, 3, 2, 4, 3, 2, 4, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 3, 2, 4, 3, 4, 4, 2, 2, 4, 3, 4, 4, 4,
+		2, 4, 4, 4, 4, 2, 3, 2, 2, 2, 3, 2, 3, 4, 4, 4, 2, 2, 3, 2, 2, 2, 4, 4, 2, 4, 3, 2, 2, 3, 4, 4,
+		3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 3, 4, 4, 2, 2, 4, 4, 4, 4, 4, 2, 4,
+		4, 4, 4, 3, 4, 4, 4, 2, 4, 4, 2, 4, 4, 4, 2, 2, 4, 4, 4, 4, 3, 2, 4, 4, 3, 2, 4, 4, 3, 2, 4, 4,
+	},
+	{
+		3, 2, 3, 3, 4, 2, 2, 4, 3, 2, 3, 2, 3, 2, 3, 3, 3, 3, 4, 3, 2, 3, 3, 3, 3, 2, 2, 3, 2, 3, 4, 3,
+		2, 2, 3, 3, 2, 3, 2, 4, 2, 2, 3, 2, 4, 3, 2, 2, 4, 3, 2, 2, 3, 2, 3, 2, 2, 4, 3, 3, 3, 2, 3, 4,
+		4, 3, 2, 2, 4, 4, 3, 2, 4, 2, 4, 2, 4, 4, 4, 4, 3, 4, 4, 2, 3, 3, 3, 4, 4, 4, 2, 3, 2, 2, 3, 2,
+		3, 4, 3, 3, 2, 2, 3, 2, 3, 3, 2, 3, 3, 3, 3, 2, 3, 3, 3, 3, 4, 4, 4, 4, 2, 3, 4, 3, 3, 2, 2, 4,
+		2, 4, 4, 4, 4, 3, 4, 3, 2, 2, 2, 4, 3, 3, 2, 4, 2, 3, 4, 3, 2, 3, 4, 2, 3, 4, 3, 2, 2, 2, 3, 2,
+		3, 3, 2, 3, 3, 3, 3, 3, 3, 2, 3, 4, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 3, 2, 4, 3, 4, 4, 3, 4, 4, 3,
+		4, 2, 3, 4, 3, 4, 4, 3, 4, 3, 2, 3, 2, 3, 2, 4, 2, 4, 3, 4, 4, 4, 3, 4, 4, 4, 2, 3, 3, 4, 4, 4,
+		4, 4, 4, 2, 4, 2, 3, 3, 4, 2, 2, 3, 2, 3, 3, 4, 4, 3, 4, 3, 4, 4, 3, 3, 3, 2, 3, 4, 3, 2, 3, 4,
+	},
+	{
+		3, 3, 3, 2, 3, 4, 4, 4, 4, 2, 3, 4, 2, 4, 3, 4, 3, 4, 4, 4, 4, 4, 4, 3, 4, 3, 4, 3, 4, 3, 4, 2,
+		3, 2, 4, 4, 4, 4, 4, 4, 3, 2, 4, 3, 3, 2, 4, 4, 4, 4, 2, 4, 2, 4, 4, 4, 2, 3, 4, 4, 4, 4, 4, 2,
+		4, 3, 4, 2, 2, 4, 3, 4, 4, 3, 4, 4, 2, 2, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 2, 3, 4, 2, 3,
+		4, 2, 2, 4, 2, 4, 3, 4, 4, 2, 4, 3, 3, 4, 2, 3, 3, 2, 2, 2, 3, 2, 2, 3, 4, 4, 4, 4, 2, 3, 4, 4,
+		3, 2, 4, 2, 4, 4, 4, 2, 4, 2, 3, 4, 4, 2, 4, 2, 2, 2, 3, 3, 4, 4, 3, 2, 4, 4, 3, 2, 3, 2, 4, 4,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	},
+	{
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 4, 2, 4, 4, 4, 4, 3,
+		2, 3, 4, 4, 2, 4, 3, 4, 3, 3, 4, 4, 3, 4, 3, 4, 3, 2, 2, 2, 3, 3, 4, 4, 2, 2, 3, 2, 4, 4, 2, 4,
+		2, 3, 3, 2, 4, 4, 4, 2, 4, 4, 3, 3, 3, 3, 2, 4, 4, 4, 4, 3, 2, 4, 4, 4, 4, 3, 3, 4, 2, 4, 2, 2,
+		4, 4, 3, 2, 4, 4, 4, 2, 2, 3, 3, 2, 3, 3, 2, 4, 4, 4, 4, 3, 4, 4, 2, 4, 4, 4, 4, 2, 4, 3, 3, 2,
+		3, 3, 3, 4, 4, 4, 2, 3, 3, 3, 3, 3, 3, 2, 2, 3, 4, 2, 3, 3, 3, 4, 3, 3, 3, 4, 4, 3, 3, 3, 4, 3,
+		3, 3, 3, 3, 3, 3, 2, 3, 3, 2, 3, 2, 4, 2, 2, 4, 2, 3, 3, 3, 2, 4, 2, 4, 2, 4, 4, 2, 3, 4, 3, 4,
+		3, 3, 3, 3, 3, 4, 3, 4, 4, 2, 3, 2, 3, 3, 4, 2, 4, 4, 2, 4, 3, 4, 2, 2, 3, 4, 3, 3, 3, 3, 4, 2,
+	},
+	{
+		4, 2, 4, 2, 4, 3, 4, 4, 3, 4, 3, 2, 2, 3, 2, 3, 4, 2, 2, 3, 4, 4, 3, 3, 2, 4, 2, 3, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 3, 2, 3, 3, 4, 4, 2, 3, 4, 3, 4, 4, 3, 2, 4, 3, 3, 2, 4, 3, 4, 4, 2, 4, 2, 4, 2, 2,
+		4, 3, 2, 2, 4, 3, 2, 2, 2, 4, 3, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 2, 2, 3, 2, 4, 4, 2, 2, 3,
+		4, 4, 2, 3, 2, 4, 2, 4, 3, 2, 4, 4, 4, 4, 4, 4, 2, 2, 4, 3, 3, 4, 4, 4, 2, 4, 3, 2, 4, 2, 3, 4,
+		2, 4, 4, 2, 2, 4, 3, 4, 4, 2, 2, 3, 3, 4, 3, 4, 4, 3, 2, 4, 2, 4, 4, 4, 4, 4, 3, 3, 4, 3, 2, 3,
+		4, 3, 4, 4, 3, 2, 3, 4, 3, 4, 3, 4, 4, 2, 4, 3, 4, 4, 4, 3, 4, 2, 2, 2, 2, 2, 3, 2, 3, 4, 4, 4,
+	},
+	{
+		4, 2, 4, 4, 4, 4, 4, 4, 2, 4, 4, 2, 2, 4, 2, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3,
+		4, 3, 3, 4, 4, 4, 4, 4, 2, 3, 2, 3, 2, 2, 4, 2, 4, 3, 2, 4, 3, 3, 4, 2, 4, 3, 2, 2, 4, 4, 4, 4,
+		4, 4, 3, 2, 3, 4, 2, 4, 3, 3, 3, 3, 4, 4, 4, 2, 4, 2, 2, 4, 4, 3, 4, 4, 2, 3, 4, 4, 4, 4, 4, 3,
+		4, 4, 4, 3, 3, 4, 3, 4, 2, 4, 4, 2, 3, 4, 2, 4, 2, 2, 3, 4, 3, 2, 3, 2, 4, 2, 3, 4, 3, 2, 2, 2,
+		2, 3, 3, 2, 4, 3, 4, 3, 4, 3, 3, 3, 4, 3, 4, 2, 4, 3, 4, 3, 4, 4, 4, 4, 4, 2, 4, 2, 2, 4, 4, 4,
+		4, 3, 2, 4, 4, 4, 4, 2, 4, 4, 3, 3, 3, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 4, 2, 2,
+		3, 2, 4, 2, 2, 2, 2, 2, 2, 4, 3, 3, 3, 3, 2, 3, 2, 4, 3, 4, 3, 2, 2, 4, 4, 2, 2, 3, 4, 4, 4, 3,
+		4, 4, 2, 2, 2, 4, 4, 4, 4, 4, 2, 4, 4, 2, 4, 4, 2, 4, 2, 2, 4, 4, 4, 4, 3, 4, 4, 3, 3, 2, 3, 4,
+	},
+	{
+		4, 4, 4, 3, 2, 4, 4, 4, 4, 3, 3, 4, 2, 4, 4, 2, 4, 4, 3, 3, 3, 3, 4, 4, 4, 2, 4, 3, 3, 3, 3, 3,
+		4, 2, 2, 4, 4, 3, 3, 2, 2, 3, 3, 2, 4, 2, 4, 3, 2, 2, 4, 3, 4, 4, 4, 4, 3, 4, 2, 3, 2, 2, 3, 3,
+		4, 2, 3, 4, 3, 3, 4, 4, 4, 3, 2, 4, 2, 3, 3, 4, 4, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 2, 4, 4, 3,
+		4, 3, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 3,
+		2, 2, 2, 3, 2, 2, 3, 2, 3, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4,
+		2, 2, 3, 2, 3, 3, 3, 2, 2, 4, 2, 4, 2, 4, 3, 2, 2, 3, 4, 4, 3, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2,
+		4, 4, 3, 4, 3, 3, 3, 2, 3, 2, 3, 3, 2, 3, 4, 2, 3, 2, 2, 2, 3, 4, 4, 3, 3, 2, 3, 4, 4, 3, 4, 4,
+	},
+	{
+		3, 3, 4, 3, 4, 3, 3, 2, 2, 2, 2, 4, 4, 3, 2, 3, 3, 4, 2, 2, 3, 3, 3, 3, 2, 3, 3, 3, 4, 3, 3, 3,
+		3, 4, 3, 3, 4, 2, 2, 2, 2, 2, 2, 2, 2, 4, 3, 4, 2, 3, 3, 2, 4, 3, 3, 2, 3, 2, 2, 2, 3, 4, 3, 4,
+		2, 3, 3, 2, 4, 2, 2, 3, 2, 4, 3, 3, 2, 3, 3, 3, 3, 3, 4, 3, 3, 3, 2, 2, 3, 3, 2, 3, 3, 3, 3, 2,
+		3, 2, 3, 3, 2, 2, 2, 4, 3, 3, 2, 4, 2, 3, 3, 4, 4, 2, 3, 4, 3, 3, 4, 3, 3, 4, 3, 4, 3, 3, 4, 3,
+		3, 3, 3, 3, 3, 4, 4, 3, 3, 2, 3, 3, 2, 4, 2, 3, 3, 3, 2, 2, 4, 3, 2, 4, 4, 4, 2, 4, 2, 2, 4, 4,
+		4, 4, 3, 3, 2, 4, 3, 4, 2, 2, 3, 2, 2, 2, 2, 4, 4, 3, 4, 4, 4, 3, 3, 2, 3, 2, 2, 2, 2, 4, 4, 4,
+		2, 3, 2, 3, 2, 4, 2, 4, 4, 2, 3, 4, 2, 2, 3, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 2, 4,
+		4, 3, 3, 4, 4, 4, 2, 2, 3, 4, 4, 4, 4, 3, 2, 4, 4, 4, 4, 4, 4, 3, 2, 2, 2, 4, 4, 4, 4, 3, 3, 4,
+	},
+	{
+		4, 4, 3, 4, 4, 4, 4, 4, 4, 3, 2, 4, 2, 4, 4, 4, 4, 4, 3, 2, 4, 2, 4, 3, 3, 3, 4, 4, 4, 4, 3, 4,
+		4, 4, 4, 4, 4, 2, 4, 3, 4, 4, 4, 4, 4, 3, 4, 4, 3, 3, 4, 4, 3, 4, 4, 2, 4, 3, 4, 4, 2, 2, 4, 4,
+		4, 4, 2, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 4, 4, 4, 2, 3, 4, 2, 4, 4, 3, 4, 2, 4, 2, 2, 2, 2, 4,
+		4, 4, 4, 3, 4, 3, 2, 2, 4, 3, 3, 2, 3, 2, 4, 4, 2, 2, 4, 4, 3, 3, 2, 3, 3, 4, 4, 2, 2, 2, 2, 2,
+		4, 4, 4, 3, 4, 4, 4, 3, 2, 3, 4, 3, 2, 4, 2, 4, 4, 4, 3, 4, 2, 2, 2, 2, 2, 4, 4, 4, 3, 4, 3, 4,
+		4, 4, 4, 3, 2, 4, 2, 4, 4, 2, 4, 3, 3, 4, 3, 4, 4, 3, 4, 4, 3, 4, 2, 4, 2, 4, 3, 2, 4, 4, 4, 2,
+		3, 3, 4, 4, 2, 3, 3, 3, 2, 3, 2, 3, 3, 3, 3, 3, 3, 3, 2, 4, 4, 4, 2, 3, 3, 3, 4, 2, 3, 3, 2, 2,
+		2, 2, 4, 3, 4, 2, 3, 3, 4, 3, 4, 4, 4, 3, 4, 2, 2, 4, 2, 4, 4, 3, 2, 4, 4, 4, 2, 2, 2, 4, 2, 4,
+	},
+	{
+		4, 4, 4, 4, 4, 4, 4, 3, 2, 3, 4, 2, 4, 3, 2, 4, 3, 3, 4, 2, 3, 3, 4, 4, 2, 4, 4, 2, 4, 2, 3, 2,
+		2, 2, 2, 3, 4, 4, 4, 4, 2, 2, 2, 2, 2, 4, 4, 2, 4, 4, 4, 4, 3, 2, 4, 3, 3, 3, 4, 2, 2, 3, 3, 3,
+		3, 2, 2, 2, 2, 3, 4, 2, 4, 3, 4, 3, 4, 3, 4, 4, 4, 3, 4, 4, 4, 2, 4, 3, 2, 2, 3, 3, 2, 2, 4, 2,
+		4, 4, 2, 4, 3, 4, 4, 4, 2, 2, 2, 2, 4, 4, 2, 4, 4, 2, 4, 2, 2, 2, 4, 2, 3, 4, 4, 3, 3, 4, 4, 4,
+		3, 2, 4, 4, 2, 3, 4, 4, 4, 2, 4, 4, 4, 4, 4, 2, 2, 3, 2, 3, 4, 4, 3, 4, 3, 4, 4, 4, 3, 4, 2, 2,
+		4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 4, 4, 3, 2, 2, 2, 2, 2, 3, 3, 4, 4, 4, 3, 2, 2, 2, 3, 3, 2, 2, 2,
+		4, 3, 4, 4, 4, 3, 4, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 2, 4, 2, 4, 4, 4, 2, 2, 2, 4, 4, 4,
+		4, 4, 2, 2, 3, 2, 4, 4, 4, 4, 3, 2, 2, 2, 4, 4, 3, 4, 2, 2, 2, 2, 2, 4, 3, 4, 4, 4, 3, 2, 4, 4,
+	},
+	{
+		4, 4, 4, 2, 3, 2, 4, 2, 4, 4, 2, 4, 4, 4, 4, 4, 3, 2, 4, 4, 4, 3, 4, 2, 3, 3, 3, 4, 2, 4, 4, 4,
+		3, 3, 3, 4, 4, 4, 3, 4, 3, 4, 4, 3, 2, 4, 3, 3, 2, 2, 2, 3, 4, 4, 3, 2, 4, 4, 2, 2, 4, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 4, 4, 2, 4, 3, 3, 4, 3, 4, 4, 4, 4, 4, 2, 3, 4, 4, 4, 4, 4, 3, 3, 4, 2, 4, 2,
+		4, 4, 2, 4, 4, 3, 2, 4, 2, 2, 4, 2, 3, 4, 2, 2, 3, 4, 2, 2, 2, 3, 4, 4, 2, 4, 4, 4, 4, 2, 3, 2,
+		4, 2, 3, 4, 2, 2, 2, 2, 4, 4, 3, 2, 4, 4, 4, 4, 2, 4, 4, 2, 3, 4, 3, 3, 3, 4, 3, 4, 2, 4, 4, 4,
+		2, 4, 3, 4, 4, 4, 4, 4, 4, 4, 4, 2, 3, 2, 3, 4, 3, 4, 4, 3, 4, 4, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2,
+		4, 2, 4, 3, 4, 2, 2, 4, 3, 2, 4, 2, 4, 3, 4, 4, 4, 3, 4, 2, 4, 4, 3, 3, 3, 4, 4, 2, 3, 3, 4, 3,
+		2, 3, 3, 4, 3, 2, 4, 4, 3, 2, 2, 2, 4, 2, 4, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 4,
+	},
+	{
+		4, 2, 2, 3, 2, 2, 4, 4, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 3, 4, 2, 2, 2, 2, 2, 2,
+		4, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 3, 4, 2, 3, 2, 4, 4, 3, 3, 2, 3, 4, 4, 3, 4, 3, 4, 4, 4, 2, 4,
+		4, 2, 2, 2, 3, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 4, 4, 3, 3, 2, 2, 4, 2, 4, 2, 2, 2, 2, 2, 4, 4, 2,
+		3, 2, 4, 3, 3, 2, 2, 2, 4, 4, 3, 4, 2, 4, 4, 4, 3, 4, 3, 4, 4, 4, 4, 3, 4, 2, 2, 2, 3, 3, 3, 3,
+		4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	},
+	{
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 4, 4, 4, 4, 2, 2,
+		3, 2, 3, 3, 2, 2, 4, 2, 4, 3, 2, 3, 4, 4, 3, 3, 4, 3, 3, 3, 3, 2, 2, 2, 3, 2, 2, 4, 4, 2, 4, 4,
+		2, 3, 2, 3, 3, 3, 2, 2, 3, 3, 2, 4, 4, 3, 4, 2, 4, 3, 2, 2, 2, 4, 4, 4, 2, 4, 4, 3, 4, 4, 4, 4,
+		4, 2, 2, 4, 2, 4, 3, 4, 3, 4, 3, 3, 3, 4, 2, 2, 3, 4, 4, 4, 3, 3, 3, 2, 2, 2, 4, 4, 3, 2, 4, 4,
+		4, 3, 3, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	},
+	{
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 4, 2,
+		4, 3, 4, 4, 4, 2, 2, 2, 4, 2, 3, 2, 3, 4, 3, 4, 4, 3, 3, 2, 2, 2, 2, 2, 2, 4, 4, 3, 4, 4, 2, 3,
+		3, 2, 3, 4, 3, 2, 2, 2, 2, 2, 4, 3, 3, 3, 4, 4, 3, 4, 2, 4, 4, 2, 2, 2, 3, 2, 2, 3, 4, 3, 3, 4,
+		2, 3, 3, 3, 3, 2, 2, 2, 2, 2, 3, 4, 3, 4, 2, 4, 3, 4, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 4, 3, 4, 2,
+		4, 2, 2, 4, 3, 3, 3, 4, 4, 4, 3, 3, 2, 3, 3, 2, 2, 4, 4, 4, 3, 3, 2, 4, 3, 3, 2, 3, 3, 2, 4, 2,
+		2, 4, 4, 2, 4, 2, 2, 3, 3, 4, 3, 2, 4, 2, 4, 2, 4, 3, 2, 4, 3, 2, 2, 2, 3, 3, 2, 3, 4, 2, 2, 4,
+		3, 3, 4, 4, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 4, 2, 2, 2, 3, 4, 4, 3, 3, 4, 4, 3, 4, 3, 3, 4, 3, 4,
+		2, 4, 3, 3, 2, 4, 2, 2, 3, 3, 3, 2, 2, 2, 2, 3, 4, 4, 3, 2, 2, 4, 3, 3, 4, 3, 4, 3, 2, 4, 2, 4,
+	},
+	{
+		3, 2, 4, 2, 3, 4, 3, 3, 4, 3, 2, 4, 2, 3, 3, 3, 4, 3, 4, 3, 2, 2, 3, 2, 4, 4, 2, 2, 3, 4, 3, 4,
+		4, 2, 4, 4, 3, 4, 4, 3, 4, 4, 3, 4, 4, 2, 4, 4, 3, 2, 3, 2, 2, 4, 2, 2, 3, 3, 4, 2, 2, 3, 3, 4,
+		2, 2, 3, 4, 3, 2, 4, 4, 3, 4, 2, 4, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 2, 4, 2, 4, 3, 3, 2, 3, 2,
+		3, 3, 3, 2, 2, 2, 3, 2, 3, 3, 4, 2, 4, 2, 4, 2, 4, 2, 4, 4, 3, 2, 3, 4, 4, 2, 4, 4, 3, 4, 4, 4,
+		4, 4, 4, 4, 4, 3, 2, 2, 4, 2, 4, 3, 2, 3, 4, 3, 2, 2, 2, 2, 4, 2, 2, 4, 3, 4, 4, 2, 4, 4, 4, 2,
+		3, 4, 4, 3, 4, 4, 3, 2, 4, 2, 4, 4, 4, 3, 4, 2, 2, 2, 2, 4, 2, 2, 4, 4, 2, 4, 2, 4, 2, 2, 2, 4,
+		2, 3, 2, 3, 4, 4, 3, 4, 2, 3, 2, 3, 3, 4, 4, 4, 4, 2, 2, 3, 4, 4, 4, 4, 4, 4, 2, 2, 3, 4, 4, 4,
+		2, 4, 2, 4, 2, 4, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 4, 4, 2, 3, 2, 2, 3, 2, 4, 3, 4, 3, 2, 4, 4, 3,
+	},
+	{
+		4, 3, 3, 3, 4, 3, 3, 4, 3, 2, 3, 2, 3, 4, 4, 4, 3, 3, 3, 3, 2, 2, 4, 3, 3, 2, 2, 4, 3, 4, 4, 2,
+		4, 3, 2, 2, 3, 2, 4, 4, 4, 4, 2, 3, 2, 3, 2, 4, 3, 2, 4, 2, 2, 4, 2, 3, 3, 3, 2, 3, 2, 2, 2, 2,
+		2, 4, 2, 4, 4, 4, 3, 2, 4, 4, 4, 2, 3, 3, 3, 3, 4, 4, 4, 3, 2, 2, 2, 4, 3, 4, 2, 3, 4, 4, 3, 4,
+		4, 2, 4, 4, 4, 3, 2, 3, 2, 4, 4, 3, 2, 2, 2, 3, 3, 3, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 2, 2, 4, 4, 4, 3, 2, 3, 4, 3, 2, 2, 3, 2, 4, 2, 3, 4, 3, 4, 4, 4,
+		4, 4, 4, 2, 3, 2, 4, 2, 2, 4, 2, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3,
+		2, 2, 3, 4, 2, 4, 2, 3, 2, 3, 3, 4, 2, 3, 2, 3, 2, 2, 3, 2, 3, 2, 4, 2, 2, 4, 4, 2, 3, 3, 3, 2,
+	},
+	{
+		4, 2, 4, 3, 2, 3, 2, 4, 4, 3, 3, 2, 3, 2, 2, 2, 3, 4, 3, 3, 4, 4, 4, 4, 3, 2, 3, 3, 2, 2, 3, 4,
+		2, 3, 2, 2, 4, 4, 2, 4, 3, 4, 4, 4, 4, 4, 3, 4, 4, 4, 4, 4, 2, 3, 2, 2, 2, 2, 4, 2, 4, 3, 3, 3,
+		2, 4, 2, 4, 2, 3, 2, 4, 4, 3, 2, 4, 4, 2, 4, 2, 4, 3, 3, 4, 4, 3, 4, 3, 4, 4, 2, 4, 3, 2, 3, 4,
+		2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 4, 3, 2, 2, 4, 4, 4, 2,
+		2, 4, 2, 4, 2, 3, 4, 4, 3, 2, 2, 4, 3, 3, 3, 4, 4, 3, 4, 3, 3, 4, 2, 2, 2, 4, 4, 4, 2, 4, 2, 2,
+		2, 3, 4, 4, 2, 2, 2, 4, 2, 4, 2, 4, 4, 4, 4, 4, 3, 3, 3, 4, 4, 3, 4, 4, 4, 3, 2, 3, 4, 3, 2, 3,
+		2, 2, 3, 4, 4, 4, 2, 4, 2, 4, 4, 2, 4, 3, 4, 2, 4, 3, 2, 2, 4, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3,
+	},
+	{
+		2, 3, 4, 4, 4, 4, 4, 4, 2, 4, 4, 4, 2, 4, 3, 4, 2, 4, 2, 2, 4, 4, 3, 2, 2, 3, 4, 4, 4, 4, 4, 2,
+		4, 2, 4, 4, 4, 4, 2, 4, 2, 4, 4, 3, 4, 4, 4, 2, 3, 4, 4, 2, 4, 3, 4, 3, 4, 4, 4, 2, 2, 4, 3, 4,
+		3, 4, 4, 3, 4, 3, 4, 2, 4, 4, 4, 2, 4, 3, 4, 4, 4, 2, 4, 4, 4, 3, 4, 3, 2, 4, 3, 3, 2, 2, 4, 3,
+		4, 2, 3, 2, 4, 3, 4, 4, 4, 4, 3, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 4, 2, 4, 2, 3, 3, 4, 2, 4, 4, 2, 2, 3, 3, 4, 2, 4, 3, 2, 4, 4,
+		4, 3, 4, 2, 2, 2, 4, 4, 2, 2, 4, 2, 2, 4, 2, 3, 4, 3, 3, 3, 3, 4, 3, 2, 3, 2, 2, 2, 4, 2, 2, 4,
+		2, 3, 2, 4, 2, 2, 3, 4, 2, 2, 2, 4, 4, 3, 3, 3, 2, 4, 4, 4, 2, 2, 4, 4, 2, 4, 4, 3, 4, 4, 4, 2,
+	},
+	{
+		2, 4, 2, 3, 4, 4, 3, 2, 4, 2, 4, 4, 4, 3, 4, 2, 4, 4, 4, 2, 2, 4, 4, 4, 4, 4, 3, 2, 2, 2, 4, 4,
+		4, 2, 3, 3, 4, 3, 2, 3, 3, 4, 2, 4, 2, 2, 4, 4, 2, 3, 3, 4, 2, 4, 2, 4, 2, 2, 4, 4, 3, 2, 4, 4,
+		2, 3, 3, 4, 3, 3, 4, 2, 4, 2, 4, 4, 4, 3, 3, 3, 2, 3, 4, 2, 3, 4, 4, 2, 3, 4, 3, 4, 2, 2, 2, 4,
+		4, 4, 2, 2, 4, 2, 4, 4, 4, 2, 2, 2, 4, 2, 2, 3, 4, 4, 2, 2, 4, 4, 4, 3, 2, 2, 4, 4, 4, 4, 4, 2,
+		4, 2, 4, 2, 2, 4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 4, 3, 4, 4, 2, 4, 2, 2, 2, 2, 4, 4, 2, 2, 4, 2,
+		4, 4, 4, 2, 4, 4, 4, 2, 4, 2, 3, 3, 2, 3, 3, 4, 2, 2, 2, 2, 2, 4, 4, 2, 4, 4, 2, 2, 2, 4, 2, 4,
+		3, 4, 2, 4, 4, 2, 4, 4, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 3, 4, 2, 4, 4, 3, 4, 2, 4, 2,
+		4, 4, 4, 2, 4, 4, 4, 3, 3, 2, 4, 4, 4, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 4, 4, 2, 2, 2, 2, 3, 2, 2,
+	},
+	{
+		2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 2, 4, 2, 3, 4, 2, 2, 2, 4, 3, 4, 2, 2, 4, 2, 2, 2, 2, 4, 4, 2, 2,
+		2, 4, 2, 4, 4, 3, 2, 2, 4, 4, 2, 4, 4, 3, 2, 2, 2, 3, 4, 4, 4, 2, 4, 4, 2, 4, 2, 3, 4, 4, 3, 4,
+		4, 4, 2, 2, 4, 2, 4, 2, 4, 3, 4, 4, 4, 4, 4, 2, 4, 2, 4, 2, 3, 4, 3, 3, 4, 4, 2, 2, 2, 2, 4, 3,
+		4, 2, 4, 4, 2, 2, 4, 4, 4, 2, 2, 2, 2, 4, 4, 2, 2, 4, 2, 4, 4, 4, 2, 3, 3, 4, 4, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 3, 4, 4, 2, 3, 4, 2, 2, 4, 2, 2, 2, 4, 4, 3, 3, 4, 3, 4, 2, 4, 4, 4, 4, 4, 2, 4,
+	},
+	{
+		4, 2, 2, 3, 4, 4, 3, 4, 4, 3, 2, 2, 2, 2, 2, 2, 4, 2, 3, 2, 4, 3, 2, 4, 4, 4, 2, 3, 2, 4, 4, 4,
+		4, 2, 4, 3, 2, 4, 3, 2, 3, 4, 2, 2, 2, 4, 4, 4, 4, 4, 2, 4, 2, 2, 4, 4, 4, 2, 2, 3, 2, 4, 4, 3,
+		4, 4, 4, 4, 2, 4, 2, 2, 2, 2, 4, 4, 4, 2, 2, 4, 2, 3, 4, 4, 4, 2, 4, 4, 4, 4, 4, 4, 4, 3, 2, 4,
+		3, 3, 2, 2, 2, 2, 2, 4, 4, 4, 3, 4, 3, 2, 2, 4, 4, 4, 3, 4, 4, 4, 2, 4, 4, 4, 2, 4, 2, 4, 2, 4,
+		4, 4, 4, 2, 4, 4, 4, 4, 4, 3, 4, 4, 4, 2, 2, 2, 4, 2, 4, 2, 4, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 2, 4, 4, 2, 3, 2, 4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 4, 2, 4, 4,
+		2, 4, 3, 4, 2, 4, 2, 4, 4, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 2, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+		2, 4, 4, 4, 4, 3, 4, 2, 4, 4, 2, 4, 4, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 4, 4, 3, 3, 4, 2, 4, 4, 4,
+	},
+	{
+		4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 2, 4, 2, 4, 2, 4, 4, 4, 4, 4, 4, 4, 2, 4, 2, 4, 3, 3, 2, 4, 3, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 4, 2, 3, 3, 2, 3,
+		4, 2, 3, 4, 2, 2, 4, 4, 4, 4, 4, 3, 4, 4, 4, 2, 2, 4, 3, 3, 4, 2, 2, 3, 2, 4, 4, 4, 4, 3, 2, 3,
+		4, 4, 2, 2, 4, 3, 2, 4, 2, 3, 2, 2, 2, 4, 4, 2, 4, 2, 2, 2, 3, 3, 4, 4, 2, 2, 2, 3, 3, 2, 3, 2,
+		4, 2, 4, 3, 2, 2, 2, 2, 4, 2, 2, 2, 3, 3, 3, 3, 4, 3, 2, 4, 3, 4, 4, 2, 3, 2, 4, 3, 3, 3, 3, 4,
+		3, 2, 2, 2, 4, 4, 4, 4, 3, 2, 2, 4, 2, 4, 4, 3, 4, 2, 4, 4, 3, 4, 4, 3, 2, 4, 4, 4, 4, 4, 2, 4,
+	},
+	{
+		4, 4, 2, 2, 2, 2, 4, 3, 2, 4, 4, 2, 2, 2, 3, 4, 4, 2, 4, 3, 2, 3, 4, 2, 4, 3, 4, 4, 4, 2, 4, 2,
+		3, 2, 4, 4, 4, 4, 2, 2, 4, 4, 4, 4, 3, 4, 4, 3, 4, 4, 4, 4, 3, 4, 4, 4, 4, 2, 2, 3, 2, 4, 3, 2,
+		4, 4, 4, 4, 2, 2, 4, 4, 4, 4, 3, 3, 4, 4, 4, 4, 2, 2, 3, 2, 4, 4, 4, 4, 4, 4, 2, 4, 3, 4, 4, 3,
+		4, 3, 2, 3, 4, 4, 3, 3, 2, 2, 3, 4, 3, 2, 4, 4, 4, 4, 3, 2, 4, 4, 4, 3, 4, 4, 4, 4, 2, 2, 4, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 4, 4, 2, 3, 4, 2, 2, 4, 2, 2, 2, 3, 2, 2, 2,
+		4, 2, 4, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	},
+	{
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	},
+	{
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 13, 13, 15, 13, 15, 13, 13, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 13,
+		15, 13, 15, 13, 13, 15, 15, 13, 13, 13, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	},
+	{
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	},
+	{
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	},
+	{
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	},
+	{
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	},
+	{
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	},
+	{
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	},
+	{
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	},
+	{
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+	},
+};
+
+static const uint16_t charClassBlockIndex[4352] = {
+	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+	23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54,
+	55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 89, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 91, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 93, 94, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 96, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 99, 100, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 101,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 101,
+};
+
+CinCharClass cinCharClassOf(uint32_t codepoint) {
+	if (codepoint > 0x10FFFF) {
+		return CIN_CHAR_OTHER;
+	}
+	return CinCharClass(charClassBlocks[charClassBlockIndex[codepoint >> 8]][codepoint & 0xff]);
+}
+
+} // namespace PIME
@@ -0,0 +1,600 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+#include "CinCompiler.h"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "CinCharSet.h"
+#include "CinTableFormat.h"
+
+using namespace std;
+
+namespace PIME {
+
+// increase it when the compiled tables change, so they are compiled again
+static constexpr uint32_t CIN_COMPILER_VERSION = 1;
+
+static const char CIN_HEAD[] = "%gen_inp";
+static const char ENAME_HEAD[] = "%ename";
+static const char CNAME_HEAD[] = "%cname";
+static const char ENCODING_HEAD[] = "%encoding";
+static const char SELKEY_HEAD[] = "%selkey";
+static const char KEYNAME_HEAD[] = "%keyname";
+static const char CHARDEF_HEAD[] = "%chardef";
+
+static const char IDEOGRAPHIC_SPACE[] = "\xe3\x80\x80";  // U+3000
+
+// cname of the table whose chardefs have comments after '#'
+static const char CNS_CJ_CNAME[] = "\xe4\xb8\xad\xe6\xa8\x99\xe5\x80\x89\xe9\xa0\xa1";  // 中標倉頡
+
+// tables whose key names contain '#', so only comments in the heads are skipped
+static const char* const HASHTAG_IN_KEYNAMES[] = {"ez.cin", "ezsmall.cin", "ezmid.cin", "ezbig.cin"};
+
+// the dicts merged by CinToJson.mergeDicts() for the tables sorted by character sets, in order
+enum Bucket : uint32_t {
+	BUCKET_BIG5_F,
+	BUCKET_BIG5_LF,
+	BUCKET_BIG5_S,
+	BUCKET_BIG5_OTHER,
+	BUCKET_BOPOMOFO,
+	BUCKET_CJK,
+	BUCKET_CJK_EXT_A,
+	BUCKET_CJK_EXT_B,
+	BUCKET_CJK_EXT_C,
+	BUCKET_CJK_EXT_D,
+	BUCKET_CJK_EXT_E,
+	BUCKET_CJK_EXT_F,
+	BUCKET_CJK_CI_IBM,
+	BUCKET_CJK_OTHER,
+	BUCKET_PHRASES,
+	BUCKET_PRIVATE_USE
+};
+
+static const Bucket bucketOfClass[CIN_CHAR_CLASS_COUNT] = {
+	BUCKET_CJK_OTHER,
+	BUCKET_BOPOMOFO,
+	BUCKET_CJK,
+	BUCKET_BIG5_F,
+	BUCKET_BIG5_LF,
+	BUCKET_BIG5_S,
+	BUCKET_BIG5_OTHER,
+	BUCKET_CJK_EXT_A,
+	BUCKET_CJK_EXT_B,
+	BUCKET_CJK_EXT_C,
+	BUCKET_CJK_EXT_D,
+	BUCKET_CJK_EXT_E,
+	BUCKET_CJK_EXT_F,
+	BUCKET_CJK_CI_IBM,
+	BUCKET_PRIVATE_USE,
+	BUCKET_PRIVATE_USE,
+	BUCKET_PRIVATE_USE
+};
+
+// keys of cincount counting the characters of each class
+static const char* const countNameOfClass[CIN_CHAR_CLASS_COUNT] = {
+	"cjkOther",
+	"bopomofo",
+	"cjk",
+	"big5F",
+	"big5LF",
+	"big5S",
+	"big5Other",
+	"cjkExtA",
+	"cjkExtB",
+	"cjkExtC",
+	"cjkExtD",
+	"cjkExtE",
+	"cjkExtF",
+	"cjkCI",
+	"privateuse",
+	"cjkCI",
+	"cjkCIS"
+};
+
+static const char* const COUNT_NAMES[] = {
+	"bopomofo", "big5F", "big5LF", "big5S", "big5Other", "cjk", "cjkExtA", "cjkExtB", "cjkExtC", "cjkExtD",
+	"cjkExtE", "cjkExtF", "cjkOther", "phrases", "cjkCI", "cjkCIS", "privateuse", "totalchardefs"
+};
+
+// decodes the UTF-8 character at pos and returns its size
+static size_t decodeUtf8(const string& str, size_t pos, uint32_t& codepoint) {
+	auto lead = uint8_t(str[pos]);
+	size_t size = lead < 0x80 ? 1 : (lead < 0xe0 ? 2 : (lead < 0xf0 ? 3 : 4));
+	size = min(size, str.size() - pos);
+	codepoint = size == 1 ? lead : (lead & (0xff >> (size + 1)));
+	for (size_t i = 1; i < size; ++i) {
+		codepoint = (codepoint << 6) | (uint8_t(str[pos + i]) & 0x3f);
+	}
+	return size;
+}
+
+static size_t codepointCount(const string& str) {
+	size_t count = 0;
+	uint32_t codepoint;
+	for (size_t pos = 0; pos < str.size(); pos += decodeUtf8(str, pos, codepoint)) {
+		++count;
+	}
+	return count;
+}
+
+// whitespace of str.isspace() of python
+static bool isSpace(uint32_t c) {
+	return (c >= 0x09 && c <= 0x0d) || (c >= 0x1c && c <= 0x20) || c == 0x85 || c == 0xa0 || c == 0x1680
+		|| (c >= 0x2000 && c <= 0x200a) || c == 0x2028 || c == 0x2029 || c == 0x202f || c == 0x205f || c == 0x3000;
+}
+
+// str.strip() of python
+static string strip(const string& str) {
+	size_t begin = str.size(), end = 0;
+	uint32_t codepoint;
+	for (size_t pos = 0; pos < str.size();) {
+		size_t size = decodeUtf8(str, pos, codepoint);
+		if (!isSpace(codepoint)) {
+			begin = min(begin, pos);
+			end = pos + size;
+		}
+		pos += size;
+	}
+	return begin < end ? str.substr(begin, end - begin) : string();
+}
+
+// the keys are ASCII in practice, so only ASCII letters are converted
+static string toLower(string str) {
+	for (auto& c : str) {
+		if (c >= 'A' && c <= 'Z') {
+			c = c - 'A' + 'a';
+		}
+	}
+	return str;
+}
+
+static bool contains(const string& str, const char* part) {
+	return str.find(part) != string::npos;
+}
+
+// head_rest() of cintojson.py, the heads are ASCII
+static string headRest(const char* head, const string& line) {
+	size_t pos = 0;
+	uint32_t codepoint;
+	for (size_t i = 0; i < strlen(head) && pos < line.size(); ++i) {
+		pos += decodeUtf8(line, pos, codepoint);
+	}
+	return strip(line.substr(pos));
+}
+
+// safeSplit() of cintojson.py
+static void safeSplit(const string& line, string& key, string& value) {
+	size_t pos = line.find(' ');
+	if (pos == string::npos) {
+		pos = line.find('\t');
+	}
+	if (pos == string::npos) {
+		key = line;
+		value = "Error";
+	}
+	else {
+		key = line.substr(0, pos);
+		value = line.substr(pos + 1);
+	}
+}
+
+// code point of the first character, 0 for empty strings
+static uint32_t firstCodepoint(const string& str) {
+	uint32_t codepoint = 0;
+	if (!str.empty()) {
+		decodeUtf8(str, 0, codepoint);
+	}
+	return codepoint;
+}
+
+static void appendUint32(string& data, uint32_t value) {
+	for (int i = 0; i < 4; ++i) {
+		data.push_back(char((value >> (8 * i)) & 0xff));
+	}
+}
+
+static string packUint32(const vector<uint32_t>& values) {
+	string data;
+	data.reserve(values.size() * sizeof(uint32_t));
+	for (uint32_t value : values) {
+		appendUint32(data, value);
+	}
+	return data;
+}
+
+static size_t align(size_t size) {
+	return (size + 3) & ~size_t(3);
+}
+
+namespace {
+
+// STRINGS section, equal strings are stored once
+class StringPool {
+public:
+	uint32_t add(const string& str, uint8_t attributes = 0) {
+		auto it = offsets_.find(str);
+		if (it != offsets_.end()) {
+			data_[it->second] = char(uint8_t(data_[it->second]) | attributes);
+			return it->second;
+		}
+		auto offset = uint32_t(data_.size());
+		offsets_.emplace(str, offset);
+		data_.push_back(char(attributes));
+		data_ += str;
+		data_.push_back('\0');
+		return offset;
+	}
+
+	const string& data() const {
+		return data_;
+	}
+
+private:
+	string data_;
+	unordered_map<string, uint32_t> offsets_;
+};
+
+}
+
+// Builds the KEY_TRIE section from the sorted keys. Nodes are placed at the first position
+// where all of their children are free, which keeps the array almost full.
+static vector<uint32_t> buildTrie(const vector<const string*>& keys) {
+	vector<uint32_t> base{0};
+	vector<uint32_t> check{CIN_TRIE_NONE};
+	vector<uint32_t> keyBegin{0};
+	vector<uint32_t> keyEnd{uint32_t(keys.size())};
+	size_t firstFree = 1;
+	vector<pair<uint32_t, size_t>> pending{{0, 0}};  // node and its depth
+	struct Child {
+		uint32_t code;  // 0 for the end of a key, or the next byte + 1
+		uint32_t begin;
+		uint32_t end;
+	};
+	vector<Child> children;
+	while (!pending.empty()) {
+		uint32_t node = pending.back().first;
+		size_t depth = pending.back().second;
+		pending.pop_back();
+
+		children.clear();
+		uint32_t i = keyBegin[node], end = keyEnd[node];
+		if (i < end && keys[i]->size() == depth) {
+			children.push_back(Child{0, i, i + 1});
+			++i;
+		}
+		while (i < end) {
+			uint32_t code = uint8_t((*keys[i])[depth]) + 1u;
+			uint32_t j = i + 1;
+			while (j < end && uint8_t((*keys[j])[depth]) + 1u == code) {
+				++j;
+			}
+			children.push_back(Child{code, i, j});
+			i = j;
+		}
+		if (children.empty()) {
+			continue;
+		}
+
+		size_t position = firstFree;
+		size_t nodeBase;
+		for (;;) {
+			bool isFree = position >= children[0].code;
+			nodeBase = position - children[0].code;
+			for (size_t c = 0; isFree && c < children.size(); ++c) {
+				size_t slot = nodeBase + children[c].code;
+				isFree = slot >= check.size() || (check[slot] == CIN_TRIE_NONE && slot != 0);
+			}
+			if (isFree) {
+				break;
+			}
+			++position;
+			while (position < check.size() && check[position] != CIN_TRIE_NONE) {
+				++position;
+			}
+		}
+
+		size_t size = nodeBase + children.back().code + 1;
+		if (size > check.size()) {
+			base.resize(size, 0);
+			check.resize(size, CIN_TRIE_NONE);
+			keyBegin.resize(size, 0);
+			keyEnd.resize(size, 0);
+		}
+		base[node] = uint32_t(nodeBase);
+		for (const auto& child : children) {
+			size_t slot = nodeBase + child.code;
+			check[slot] = node;
+			keyBegin[slot] = child.begin;
+			keyEnd[slot] = child.end;
+			if (child.code != 0) {
+				pending.emplace_back(uint32_t(slot), depth + 1);
+			}
+		}
+		while (firstFree < check.size() && check[firstFree] != CIN_TRIE_NONE) {
+			++firstFree;
+		}
+	}
+
+	vector<uint32_t> nodes;
+	nodes.reserve(check.size() * 4);
+	for (size_t i = 0; i < check.size(); ++i) {
+		nodes.insert(nodes.end(), {base[i], check[i], keyBegin[i], keyEnd[i]});
+	}
+	return nodes;
+}
+
+static string buildFile(const vector<pair<CinTableSectionId, string>>& sections) {
+	size_t headerSize = sizeof(CinTableHeader) + sizeof(CinTableSection) * sections.size();
+	string header(CIN_TABLE_MAGIC, sizeof(CIN_TABLE_MAGIC));
+	appendUint32(header, CIN_TABLE_VERSION);
+	appendUint32(header, uint32_t(sections.size()));
+	string body;
+	for (const auto& section : sections) {
+		appendUint32(header, section.first);
+		appendUint32(header, uint32_t(align(headerSize) + body.size()));
+		appendUint32(header, uint32_t(section.second.size()));
+		body += section.second;
+		body.resize(align(body.size()), '\0');
+	}
+	header.resize(align(headerSize), '\0');
+	return header + body;
+}
+
+CinCompiler::CinCompiler(const string& fileName, bool sortByCharset):
+	fileName_(fileName),
+	sortByCharset_(sortByCharset),
+	hashtagInKeyNames_(false) {
+	for (auto name : HASHTAG_IN_KEYNAMES) {
+		hashtagInKeyNames_ = hashtagInKeyNames_ || fileName == name;
+	}
+	for (auto name : COUNT_NAMES) {
+		cinCount_[name] = 0;
+	}
+}
+
+void CinCompiler::parse(const string& data) {
+	State state = PARSING_HEAD;
+	// lines end with "\n", "\r\n", or "\r", the same as the universal newlines mode of python
+	for (size_t pos = 0; pos < data.size();) {
+		size_t end = min(data.find_first_of("\r\n", pos), data.size());
+		string line = data.substr(pos, end - pos);
+		pos = end + ((end + 1 < data.size() && data[end] == '\r' && data[end + 1] == '\n') ? 2 : 1);
+		if (!parseLine(move(line), state)) {
+			break;
+		}
+	}
+
+	if (sortByCharset_) {
+		// CinToJson.mergeDicts() merges the values of each character set in order
+		stable_sort(sortedValues_.begin(), sortedValues_.end(), [](const SortedValue& a, const SortedValue& b) {
+			return a.bucket < b.bucket;
+		});
+		for (const auto& value : sortedValues_) {
+			appendValue(value.key, value.value);
+		}
+		sortedValues_.clear();
+	}
+}
+
+// returns false if the rest of the file should be ignored
+bool CinCompiler::parseLine(string line, State& state) {
+	// re.sub('^ | $|\n$', '', line)
+	if (!line.empty() && line.front() == ' ') {
+		line.erase(0, 1);
+	}
+	if (!line.empty() && line.back() == ' ') {
+		line.pop_back();
+	}
+	if (line.empty() || (line[0] == '#' && (!hashtagInKeyNames_ || state == PARSING_HEAD))) {
+		return true;
+	}
+
+	string key, value;
+	if (state != PARSE_CHARDEF) {
+		if (contains(line, CIN_HEAD)) {
+			return true;
+		}
+		if (contains(line, ENAME_HEAD)) {
+			ename_ = headRest(ENAME_HEAD, line);
+		}
+		if (contains(line, CNAME_HEAD)) {
+			cname_ = headRest(CNAME_HEAD, line);
+		}
+		if (contains(line, ENCODING_HEAD)) {
+			return true;
+		}
+		if (contains(line, SELKEY_HEAD)) {
+			selkey_ = headRest(SELKEY_HEAD, line);
+		}
+		if (contains(line, CHARDEF_HEAD)) {
+			state = contains(line, "begin") ? PARSE_CHARDEF : PARSING_HEAD;
+			return true;
+		}
+		if (contains(line, KEYNAME_HEAD)) {
+			state = contains(line, "begin") ? PARSE_KEYNAME : PARSING_HEAD;
+			return true;
+		}
+		if (state == PARSE_KEYNAME) {
+			safeSplit(line, key, value);
+			keyNames_[toLower(strip(key))] = contains(value, IDEOGRAPHIC_SPACE) ? string(IDEOGRAPHIC_SPACE) : strip(value);
+		}
+		return true;
+	}
+
+	// "%chardef end" does not end the chardefs in cintojson.py
+	if (contains(line, CHARDEF_HEAD)) {
+		return true;
+	}
+	if (cname_ == CNS_CJ_CNAME) {
+		// re.sub('#.+', '', line)
+		size_t pos = line.find('#');
+		if (pos != string::npos && pos + 1 < line.size()) {
+			line.erase(pos);
+		}
+	}
+	safeSplit(line, key, value);
+	if (value == "Error") {
+		return false;
+	}
+	addCharDef(toLower(strip(key)), contains(value, IDEOGRAPHIC_SPACE) ? string(IDEOGRAPHIC_SPACE) : strip(value));
+	return true;
+}
+
+// CinToJson.getCharSet() and the rest of the parsing of a chardef
+void CinCompiler::addCharDef(const string& key, const string& value) {
+	Bucket bucket = BUCKET_PHRASES;
+	const char* countName = "phrases";
+	if (codepointCount(value) <= 1) {
+		CinCharClass charClass = cinCharClassOf(firstCodepoint(value));
+		bucket = bucketOfClass[charClass];
+		countName = countNameOfClass[charClass];
+	}
+	++cinCount_[countName];
+
+	uint32_t index = keyIndex(key);
+	if (sortByCharset_) {
+		sortedValues_.push_back(SortedValue{index, bucket, value});
+	}
+	else {
+		appendValue(index, value);
+	}
+}
+
+// duplicated values of a key are skipped
+void CinCompiler::appendValue(uint32_t key, const string& value) {
+	auto& values = values_[key];
+	if (find(values.begin(), values.end(), value) == values.end()) {
+		values.push_back(value);
+		++cinCount_["totalchardefs"];
+	}
+}
+
+uint32_t CinCompiler::keyIndex(const string& key) {
+	auto it = keyIndexes_.find(key);
+	if (it != keyIndexes_.end()) {
+		return it->second;
+	}
+	auto index = uint32_t(keys_.size());
+	keyIndexes_.emplace(key, index);
+	keys_.push_back(key);
+	values_.emplace_back();
+	return index;
+}
+
+// json.dumps(cincount, sort_keys=True)
+string CinCompiler::cinCountJson() const {
+	string json = "{";
+	for (const auto& count : cinCount_) {
+		if (json.size() > 1) {
+			json += ", ";
+		}
+		json += "\"" + count.first + "\": " + to_string(count.second);
+	}
+	return json + "}";
+}
+
+string CinCompiler::build(uint64_t sourceHash) const {
+	StringPool pool;
+	vector<uint32_t> meta{pool.add(ename_), pool.add(cname_), pool.add(selkey_), pool.add(cinCountJson())};
+
+	// keys are sorted by their UTF-8 bytes, which is also the code point order
+	vector<uint32_t> order(keys_.size());
+	iota(order.begin(), order.end(), 0);
+	sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+		return keys_[a] < keys_[b];
+	});
+
+	vector<const string*> sortedKeys;
+	vector<uint32_t> keyOffsets{0};
+	string keyChars;
+	vector<uint32_t> valueStarts{0};
+	vector<uint32_t> values;
+	map<string, vector<uint32_t>> valueKeys;  // inverted index, value => indexes of the keys
+	for (uint32_t i = 0; i < order.size(); ++i) {
+		const string& key = keys_[order[i]];
+		sortedKeys.push_back(&key);
+		keyChars += key;
+		keyOffsets.push_back(uint32_t(keyChars.size()));
+		for (const auto& value : values_[order[i]]) {
+			uint32_t codepoint = firstCodepoint(value);
+			auto attributes = uint8_t(cinCharSetOf(codepoint));
+			// the privateuse list of cintojson.py has the single characters of these classes
+			if (isPrivateUseClass(cinCharClassOf(codepoint)) && codepointCount(value) == 1) {
+				attributes |= CIN_STRING_PRIVATE_USE;
+			}
+			values.push_back(pool.add(value, attributes));
+			auto& keyList = valueKeys[value];
+			if (keyList.empty() || keyList.back() != i) {
+				keyList.push_back(i);
+			}
+		}
+		valueStarts.push_back(uint32_t(values.size()));
+	}
+
+	vector<uint32_t> valueIndex;
+	vector<uint32_t> valueKeyStarts{0};
+	vector<uint32_t> valueKeyList;
+	for (const auto& entry : valueKeys) {
+		valueIndex.push_back(pool.add(entry.first));
+		valueKeyList.insert(valueKeyList.end(), entry.second.begin(), entry.second.end());
+		valueKeyStarts.push_back(uint32_t(valueKeyList.size()));
+	}
+
+	vector<uint32_t> keyNames{uint32_t(keyNames_.size())};
+	for (const auto& entry : keyNames_) {
+		keyNames.push_back(pool.add(entry.first));
+		keyNames.push_back(pool.add(entry.second));
+	}
+
+	return buildFile({
+		{CIN_SECTION_META, packUint32(meta)},
+		{CIN_SECTION_KEY_OFFSETS, packUint32(keyOffsets)},
+		{CIN_SECTION_KEY_CHARS, keyChars},
+		{CIN_SECTION_VALUE_STARTS, packUint32(valueStarts)},
+		{CIN_SECTION_VALUES, packUint32(values)},
+		{CIN_SECTION_KEY_NAMES, packUint32(keyNames)},
+		{CIN_SECTION_VALUE_INDEX, packUint32(valueIndex)},
+		{CIN_SECTION_VALUE_KEY_STARTS, packUint32(valueKeyStarts)},
+		{CIN_SECTION_VALUE_KEYS, packUint32(valueKeyList)},
+		{CIN_SECTION_KEY_TRIE, packUint32(buildTrie(sortedKeys))},
+		{CIN_SECTION_STRINGS, pool.data()},
+		{CIN_SECTION_SOURCE_HASH, packUint32({uint32_t(sourceHash), uint32_t(sourceHash >> 32)})}
+	});
+}
+
+// FNV-1a
+uint64_t CinCompiler::sourceHash(const string& data, bool sortByCharset) {
+	uint64_t hash = 14695981039346656037ULL;
+	auto add = [&hash](uint8_t byte) {
+		hash = (hash ^ byte) * 1099511628211ULL;
+	};
+	for (char c : data) {
+		add(uint8_t(c));
+	}
+	add(sortByCharset ? 1 : 0);
+	for (int i = 0; i < 4; ++i) {
+		add(uint8_t(CIN_COMPILER_VERSION >> (8 * i)));
+	}
+	return hash;
+}
+
+} // namespace PIME
@@ -0,0 +1,91 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+#ifndef _PIME_CIN_COMPILER_H_
+#define _PIME_CIN_COMPILER_H_
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PIME {
+
+// Compiles a .cin file to the format of CinTableFormat.h.
+//
+// The file is parsed the same as CinToJson.parse() in python/cinbase/tools/cintojson.py, which
+// still generates the json tables loaded when PIMECinTable is not available, so both have the
+// same keys and values. Each CinCompiler compiles one file, and different files can be compiled
+// by different threads.
+class CinCompiler {
+public:
+	// fileName is the name of the .cin file, which decides some special cases of cintojson.py.
+	// Values of the tables sorted by character sets are ordered by CinCharClass instead of
+	// the order of the file.
+	CinCompiler(const std::string& fileName, bool sortByCharset);
+
+	// data is the UTF-8 content of the .cin file
+	void parse(const std::string& data);
+
+	// the compiled table, which records sourceHash in its SOURCE_HASH section
+	std::string build(uint64_t sourceHash) const;
+
+	// hash of the .cin file, the options, and the version of the compiler
+	static uint64_t sourceHash(const std::string& data, bool sortByCharset);
+
+private:
+	enum State {
+		PARSING_HEAD,
+		PARSE_KEYNAME,
+		PARSE_CHARDEF
+	};
+
+	// a value of the tables sorted by character sets
+	struct SortedValue {
+		uint32_t key;
+		uint32_t bucket;
+		std::string value;
+	};
+
+	bool parseLine(std::string line, State& state);
+	void addCharDef(const std::string& key, const std::string& value);
+	void appendValue(uint32_t key, const std::string& value);
+	uint32_t keyIndex(const std::string& key);
+	std::string cinCountJson() const;
+
+	std::string fileName_;
+	bool sortByCharset_;
+	bool hashtagInKeyNames_;
+
+	std::string ename_;
+	std::string cname_;
+	std::string selkey_;
+	std::map<std::string, std::string> keyNames_;
+	std::map<std::string, uint32_t> cinCount_;
+	std::vector<std::string> keys_;
+	std::unordered_map<std::string, uint32_t> keyIndexes_;
+	std::vector<std::vector<std::string>> values_;
+	std::vector<SortedValue> sortedValues_;
+};
+
+} // namespace PIME
+
+#endif // _PIME_CIN_COMPILER_H_
@@ -0,0 +1,303 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+// PIMECinCompiler compiles the .cin files to the binary tables loaded by PIMECinTable.
+//
+// Usage: PIMECinCompiler [--force] <cin dir> <bin dir> [file.cin ...]
+//
+// All .cin files in <cin dir> are compiled if no files are given. The files are compiled by
+// several threads, and a table is skipped if its SOURCE_HASH is the hash of the current .cin
+// file, unless --force is given.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+#include "CinCompiler.h"
+#include "CinTableFormat.h"
+
+using namespace std;
+using namespace PIME;
+
+// the same as SORT_LIST of cintojson.py
+static const char* const SORT_LIST[] = {"cnscj.cin", "CnsPhonetic.cin"};
+
+#ifdef _WIN32
+
+static wstring utf8ToUtf16(const string& str) {
+	int len = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), int(str.size()), nullptr, 0);
+	wstring wstr(len, L'\0');
+	MultiByteToWideChar(CP_UTF8, 0, str.c_str(), int(str.size()), &wstr[0], len);
+	return wstr;
+}
+
+static string utf16ToUtf8(const wstring& wstr) {
+	int len = WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), int(wstr.size()), nullptr, 0, nullptr, nullptr);
+	string str(len, '\0');
+	WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), int(wstr.size()), &str[0], len, nullptr, nullptr);
+	return str;
+}
+
+static FILE* openFile(const string& path, const char* mode) {
+	return _wfopen(utf8ToUtf16(path).c_str(), utf8ToUtf16(mode).c_str());
+}
+
+static bool replaceFile(const string& from, const string& to) {
+	return MoveFileExW(utf8ToUtf16(from).c_str(), utf8ToUtf16(to).c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE;
+}
+
+static void removeFile(const string& path) {
+	DeleteFileW(utf8ToUtf16(path).c_str());
+}
+
+static bool makeDir(const string& path) {
+	return CreateDirectoryW(utf8ToUtf16(path).c_str(), nullptr) || GetLastError() == ERROR_ALREADY_EXISTS;
+}
+
+static vector<string> listDir(const string& dir) {
+	vector<string> names;
+	WIN32_FIND_DATAW findData;
+	HANDLE find = FindFirstFileW(utf8ToUtf16(dir + "\\*").c_str(), &findData);
+	if (find != INVALID_HANDLE_VALUE) {
+		do {
+			if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+				names.push_back(utf16ToUtf8(findData.cFileName));
+			}
+		} while (FindNextFileW(find, &findData));
+		FindClose(find);
+	}
+	return names;
+}
+
+static const char PATH_SEPARATOR = '\\';
+
+#else
+
+static FILE* openFile(const string& path, const char* mode) {
+	return fopen(path.c_str(), mode);
+}
+
+static bool replaceFile(const string& from, const string& to) {
+	return rename(from.c_str(), to.c_str()) == 0;
+}
+
+static void removeFile(const string& path) {
+	remove(path.c_str());
+}
+
+static bool makeDir(const string& path) {
+	struct stat info;
+	return mkdir(path.c_str(), 0755) == 0 || (stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode));
+}
+
+static vector<string> listDir(const string& dir) {
+	vector<string> names;
+	if (DIR* d = opendir(dir.c_str())) {
+		while (dirent* entry = readdir(d)) {
+			if (entry->d_name[0] != '.') {
+				names.push_back(entry->d_name);
+			}
+		}
+		closedir(d);
+	}
+	return names;
+}
+
+static const char PATH_SEPARATOR = '/';
+
+#endif // _WIN32
+
+static bool readFile(const string& path, string& data) {
+	FILE* file = openFile(path, "rb");
+	if (!file) {
+		return false;
+	}
+	char buf[65536];
+	size_t len;
+	data.clear();
+	while ((len = fread(buf, 1, sizeof(buf), file)) > 0) {
+		data.append(buf, len);
+	}
+	bool success = !ferror(file);
+	fclose(file);
+	return success;
+}
+
+static bool writeFile(const string& path, const string& data) {
+	FILE* file = openFile(path, "wb");
+	if (!file) {
+		return false;
+	}
+	bool success = fwrite(data.data(), 1, data.size(), file) == data.size();
+	return fclose(file) == 0 && success;
+}
+
+// reads the SOURCE_HASH section of a compiled table, only the header and the section are read
+static bool readSourceHash(const string& path, uint64_t& hash) {
+	FILE* file = openFile(path, "rb");
+	if (!file) {
+		return false;
+	}
+	bool found = false;
+	CinTableHeader header;
+	if (fread(&header, sizeof(header), 1, file) == 1
+		&& memcmp(header.magic, CIN_TABLE_MAGIC, sizeof(CIN_TABLE_MAGIC)) == 0
+		&& header.version == CIN_TABLE_VERSION) {
+		CinTableSection section;
+		for (uint32_t i = 0; i < header.sectionCount && fread(&section, sizeof(section), 1, file) == 1; ++i) {
+			uint32_t words[2];
+			if (section.id == CIN_SECTION_SOURCE_HASH && section.size == sizeof(words)) {
+				found = fseek(file, long(section.offset), SEEK_SET) == 0 && fread(words, sizeof(words), 1, file) == 1;
+				hash = uint64_t(words[0]) | (uint64_t(words[1]) << 32);
+				break;
+			}
+		}
+	}
+	fclose(file);
+	return found;
+}
+
+static bool endsWith(const string& str, const string& suffix) {
+	return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+enum CompileResult {
+	COMPILE_FAILED,
+	COMPILE_UP_TO_DATE,
+	COMPILE_DONE
+};
+
+static CompileResult compileFile(const string& cinDir, const string& binDir, const string& fileName, bool force) {
+	string data;
+	if (!readFile(cinDir + PATH_SEPARATOR + fileName, data)) {
+		return COMPILE_FAILED;
+	}
+	bool sortByCharset = find_if(begin(SORT_LIST), end(SORT_LIST), [&fileName](const char* name) {
+		return fileName == name;
+	}) != end(SORT_LIST);
+	uint64_t hash = CinCompiler::sourceHash(data, sortByCharset);
+
+	string binFile = binDir + PATH_SEPARATOR + fileName.substr(0, fileName.size() - 4) + ".bin";
+	uint64_t binHash = 0;
+	if (!force && readSourceHash(binFile, binHash) && binHash == hash) {
+		return COMPILE_UP_TO_DATE;
+	}
+
+	CinCompiler compiler(fileName, sortByCharset);
+	compiler.parse(data);
+	// write to a temp file first, so other processes never map a partially written table
+	string tempFile = binFile + ".tmp";
+	if (!writeFile(tempFile, compiler.build(hash)) || !replaceFile(tempFile, binFile)) {
+		removeFile(tempFile);
+		return COMPILE_FAILED;
+	}
+	return COMPILE_DONE;
+}
+
+static int compileFiles(const vector<string>& args) {
+	bool force = false;
+	vector<string> paths;
+	for (const auto& arg : args) {
+		if (arg == "--force") {
+			force = true;
+		}
+		else {
+			paths.push_back(arg);
+		}
+	}
+	if (paths.size() < 2) {
+		fprintf(stderr, "Usage: PIMECinCompiler [--force] <cin dir> <bin dir> [file.cin ...]\n");
+		return 2;
+	}
+	string cinDir = paths[0];
+	string binDir = paths[1];
+	vector<string> fileNames(paths.begin() + 2, paths.end());
+	if (fileNames.empty()) {
+		for (const auto& name : listDir(cinDir)) {
+			if (endsWith(name, ".cin")) {
+				fileNames.push_back(name);
+			}
+		}
+		sort(fileNames.begin(), fileNames.end());
+	}
+	if (!makeDir(binDir)) {
+		fprintf(stderr, "Cannot create %s\n", binDir.c_str());
+		return 1;
+	}
+
+	// the files are independent, so each thread compiles the next file until all are done
+	atomic<size_t> nextFile{0};
+	atomic<bool> failed{false};
+	mutex outputMutex;
+	auto worker = [&]() {
+		for (size_t i = nextFile++; i < fileNames.size(); i = nextFile++) {
+			CompileResult result = compileFile(cinDir, binDir, fileNames[i], force);
+			if (result == COMPILE_FAILED) {
+				failed = true;
+			}
+			if (result != COMPILE_UP_TO_DATE) {
+				lock_guard<mutex> lock(outputMutex);
+				fprintf(result == COMPILE_FAILED ? stderr : stdout, "%s %s\n",
+					result == COMPILE_FAILED ? "failed to compile" : "compiled", fileNames[i].c_str());
+			}
+		}
+	};
+	size_t threadCount = min<size_t>(max(thread::hardware_concurrency(), 1u), fileNames.size());
+	vector<thread> threads;
+	for (size_t i = 1; i < threadCount; ++i) {
+		threads.emplace_back(worker);
+	}
+	worker();
+	for (auto& t : threads) {
+		t.join();
+	}
+	return failed ? 1 : 0;
+}
+
+#ifdef _WIN32
+
+int wmain(int argc, wchar_t* argv[]) {
+	vector<string> args;
+	for (int i = 1; i < argc; ++i) {
+		args.push_back(utf16ToUtf8(argv[i]));
+	}
+	return compileFiles(args);
+}
+
+#else
+
+int main(int argc, char* argv[]) {
+	return compileFiles(vector<string>(argv + 1, argv + argc));
+}
+
+#endif // _WIN32
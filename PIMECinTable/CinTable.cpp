@@ -0,0 +1,371 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+#include "CinTable.h"
+#include <cstring>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace PIME {
+
+// compares the strings by their UTF-8 bytes, which is also the order of the code points
+static int compareString(const CinString& str, const char* other, size_t len) {
+	int result = memcmp(str.data, other, str.size < len ? str.size : len);
+	if (result == 0) {
+		result = str.size < len ? -1 : (str.size > len ? 1 : 0);
+	}
+	return result;
+}
+
+CinTable::CinTable():
+	fileHandle_(nullptr),
+	mappingHandle_(nullptr),
+	data_(nullptr),
+	dataSize_(0) {
+	close();
+}
+
+CinTable::~CinTable() {
+	close();
+}
+
+bool CinTable::open(const std::string& path) {
+	close();
+#ifdef _WIN32
+	int len = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, nullptr, 0);
+	std::wstring wpath(len, L'\0');
+	MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, &wpath[0], len);
+	HANDLE file = CreateFileW(wpath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	fileHandle_ = file;
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < sizeof(CinTableHeader) || fileSize.QuadPart > UINT32_MAX) {
+		close();
+		return false;
+	}
+	dataSize_ = size_t(fileSize.QuadPart);
+	mappingHandle_ = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mappingHandle_) {
+		close();
+		return false;
+	}
+	data_ = reinterpret_cast<const char*>(MapViewOfFile(mappingHandle_, FILE_MAP_READ, 0, 0, 0));
+#else
+	int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return false;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(CinTableHeader) || uint64_t(st.st_size) > UINT32_MAX) {
+		::close(fd);
+		return false;
+	}
+	dataSize_ = size_t(st.st_size);
+	void* data = mmap(nullptr, dataSize_, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);  // the mapping is kept after closing the fd
+	data_ = data != MAP_FAILED ? reinterpret_cast<const char*>(data) : nullptr;
+#endif
+	if (!data_) {
+		close();
+		return false;
+	}
+
+	auto header = reinterpret_cast<const CinTableHeader*>(data_);
+	if (memcmp(header->magic, CIN_TABLE_MAGIC, sizeof(CIN_TABLE_MAGIC)) != 0
+		|| header->version != CIN_TABLE_VERSION
+		|| header->sectionCount > (dataSize_ - sizeof(CinTableHeader)) / sizeof(CinTableSection)) {
+		close();
+		return false;
+	}
+
+	uint32_t size;
+	// the string pool should end with '\0' so strings cannot go past the end
+	strings_ = reinterpret_cast<const char*>(section(CIN_SECTION_STRINGS, size));
+	stringsSize_ = size;
+	if (!strings_ || size == 0 || strings_[size - 1] != '\0') {
+		close();
+		return false;
+	}
+
+	auto meta = reinterpret_cast<const uint32_t*>(section(CIN_SECTION_META, size));
+	if (!meta || size < sizeof(meta_)) {
+		close();
+		return false;
+	}
+	memcpy(meta_, meta, sizeof(meta_));
+
+	keyOffsets_ = reinterpret_cast<const uint32_t*>(section(CIN_SECTION_KEY_OFFSETS, size));
+	if (!keyOffsets_ || size < sizeof(uint32_t)) {
+		close();
+		return false;
+	}
+	keyCount_ = size / sizeof(uint32_t) - 1;
+	keyChars_ = reinterpret_cast<const char*>(section(CIN_SECTION_KEY_CHARS, keyCharsSize_));
+
+	valueStarts_ = reinterpret_cast<const uint32_t*>(section(CIN_SECTION_VALUE_STARTS, size));
+	if (!keyChars_ || !valueStarts_ || size != (keyCount_ + 1) * sizeof(uint32_t)) {
+		close();
+		return false;
+	}
+	values_ = reinterpret_cast<const uint32_t*>(section(CIN_SECTION_VALUES, size));
+	valueCount_ = size / sizeof(uint32_t);
+	if (!values_) {
+		close();
+		return false;
+	}
+	// the offsets should be in ascending order and inside the sections
+	for (size_t i = 0; i < keyCount_; ++i) {
+		if (keyOffsets_[i] > keyOffsets_[i + 1] || valueStarts_[i] > valueStarts_[i + 1]) {
+			close();
+			return false;
+		}
+	}
+	if (keyOffsets_[keyCount_] > keyCharsSize_ || valueStarts_[keyCount_] > valueCount_) {
+		close();
+		return false;
+	}
+
+	keyNames_ = reinterpret_cast<const uint32_t*>(section(CIN_SECTION_KEY_NAMES, size));
+	if (keyNames_ && size >= sizeof(uint32_t)) {
+		keyNameCount_ = keyNames_[0];
+		++keyNames_;
+		if (keyNameCount_ > (size - sizeof(uint32_t)) / (2 * sizeof(uint32_t))) {
+			keyNameCount_ = 0;
+		}
+	}
+
+	// the inverted index is optional, reverse lookups scan all values without it
+	valueIndex_ = reinterpret_cast<const uint32_t*>(section(CIN_SECTION_VALUE_INDEX, size));
+	valueIndexCount_ = size / sizeof(uint32_t);
+	valueKeyStarts_ = reinterpret_cast<const uint32_t*>(section(CIN_SECTION_VALUE_KEY_STARTS, size));
+	uint32_t valueKeysSize;
+	valueKeys_ = reinterpret_cast<const uint32_t*>(section(CIN_SECTION_VALUE_KEYS, valueKeysSize));
+	bool validIndex = valueIndex_ && valueKeyStarts_ && valueKeys_ && size == (valueIndexCount_ + 1) * sizeof(uint32_t)
+		&& valueKeyStarts_[valueIndexCount_] <= valueKeysSize / sizeof(uint32_t);
+	for (uint32_t i = 0; validIndex && i < valueIndexCount_; ++i) {
+		validIndex = valueKeyStarts_[i] <= valueKeyStarts_[i + 1];
+	}
+	for (uint32_t i = 0; validIndex && i < valueKeyStarts_[valueIndexCount_]; ++i) {
+		validIndex = valueKeys_[i] < keyCount_;
+	}
+	if (!validIndex) {
+		valueIndex_ = nullptr;
+		valueIndexCount_ = 0;
+	}
+
+	// the trie is optional too, prefix lookups use binary searches without it
+	trie_ = reinterpret_cast<const CinTrieNode*>(section(CIN_SECTION_KEY_TRIE, size));
+	trieSize_ = size / sizeof(CinTrieNode);
+	bool validTrie = trie_ && trieSize_ > 0;
+	for (uint32_t i = 0; validTrie && i < trieSize_; ++i) {
+		validTrie = trie_[i].keyBegin <= trie_[i].keyEnd && trie_[i].keyEnd <= keyCount_;
+	}
+	if (!validTrie) {
+		trie_ = nullptr;
+		trieSize_ = 0;
+	}
+	return true;
+}
+
+void CinTable::close() {
+#ifdef _WIN32
+	if (data_) {
+		UnmapViewOfFile(data_);
+	}
+	if (mappingHandle_) {
+		CloseHandle(mappingHandle_);
+	}
+	if (fileHandle_) {
+		CloseHandle(fileHandle_);
+	}
+#else
+	if (data_) {
+		munmap(const_cast<char*>(data_), dataSize_);
+	}
+#endif
+	fileHandle_ = nullptr;
+	mappingHandle_ = nullptr;
+	data_ = nullptr;
+	dataSize_ = 0;
+	memset(meta_, 0, sizeof(meta_));
+	strings_ = nullptr;
+	stringsSize_ = 0;
+	keyCount_ = 0;
+	keyOffsets_ = nullptr;
+	keyChars_ = nullptr;
+	keyCharsSize_ = 0;
+	valueStarts_ = nullptr;
+	values_ = nullptr;
+	valueCount_ = 0;
+	keyNames_ = nullptr;
+	keyNameCount_ = 0;
+	valueIndex_ = nullptr;
+	valueIndexCount_ = 0;
+	valueKeyStarts_ = nullptr;
+	valueKeys_ = nullptr;
+	trie_ = nullptr;
+	trieSize_ = 0;
+}
+
+const void* CinTable::section(CinTableSectionId id, uint32_t& size) const {
+	auto header = reinterpret_cast<const CinTableHeader*>(data_);
+	auto sections = reinterpret_cast<const CinTableSection*>(header + 1);
+	for (uint32_t i = 0; i < header->sectionCount; ++i) {
+		if (sections[i].id == id) {
+			if (sections[i].offset % 4 != 0 || sections[i].offset > dataSize_ || sections[i].size > dataSize_ - sections[i].offset) {
+				return nullptr;  // broken file
+			}
+			size = sections[i].size;
+			return data_ + sections[i].offset;
+		}
+	}
+	size = 0;
+	return nullptr;
+}
+
+CinString CinTable::meta(CinTableMetaField field) const {
+	return string(meta_[field]);
+}
+
+CinString CinTable::key(size_t index) const {
+	return CinString{keyChars_ + keyOffsets_[index], keyOffsets_[index + 1] - keyOffsets_[index]};
+}
+
+int CinTable::compareKey(size_t index, const char* key, size_t len) const {
+	return compareString(this->key(index), key, len);
+}
+
+ptrdiff_t CinTable::findKey(const char* key, size_t len) const {
+	size_t begin = 0, end = keyCount_;
+	while (begin < end) {
+		size_t mid = begin + (end - begin) / 2;
+		int result = compareKey(mid, key, len);
+		if (result == 0) {
+			return ptrdiff_t(mid);
+		}
+		if (result < 0) {
+			begin = mid + 1;
+		}
+		else {
+			end = mid;
+		}
+	}
+	return -1;
+}
+
+void CinTable::findPrefix(const char* prefix, size_t len, size_t& begin, size_t& end) const {
+	begin = 0;
+	end = keyCount_;
+	narrowRange(begin, end, 0, prefix, len);
+}
+
+void CinTable::narrowRange(size_t& begin, size_t& end, size_t pos, const char* bytes, size_t len) const {
+	// compares the bytes of the key at pos with bytes, where a key having the bytes is equal
+	auto compare = [this, pos, bytes, len](size_t index) {
+		CinString k = key(index);
+		size_t size = k.size - pos;  // all keys in the range have at least pos bytes
+		int result = memcmp(k.data + pos, bytes, size < len ? size : len);
+		return result != 0 ? result : (size < len ? -1 : 0);
+	};
+	size_t low = begin, high = end;
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+		if (compare(mid) < 0) {
+			low = mid + 1;
+		}
+		else {
+			high = mid;
+		}
+	}
+	begin = low;
+	high = end;
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+		if (compare(mid) == 0) {
+			low = mid + 1;
+		}
+		else {
+			high = mid;
+		}
+	}
+	end = low;
+}
+
+CinString CinTable::string(uint32_t id) const {
+	if (id + 1 >= stringsSize_) {
+		return CinString{"", 0};
+	}
+	const char* str = strings_ + id + 1;  // skip the attributes byte
+	return CinString{str, strlen(str)};
+}
+
+bool CinTable::findKeyName(const char* key, size_t len, CinString& name) const {
+	size_t begin = 0, end = keyNameCount_;
+	while (begin < end) {
+		size_t mid = begin + (end - begin) / 2;
+		int result = compareString(string(keyNames_[mid * 2]), key, len);
+		if (result == 0) {
+			name = string(keyNames_[mid * 2 + 1]);
+			return true;
+		}
+		if (result < 0) {
+			begin = mid + 1;
+		}
+		else {
+			end = mid;
+		}
+	}
+	return false;
+}
+
+bool CinTable::findValueKeys(const char* value, size_t len, uint32_t& id, uint32_t& begin, uint32_t& end) const {
+	size_t low = 0, high = valueIndexCount_;
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+		int result = compareString(string(valueIndex_[mid]), value, len);
+		if (result == 0) {
+			id = valueIndex_[mid];
+			begin = valueKeyStarts_[mid];
+			end = valueKeyStarts_[mid + 1];
+			return true;
+		}
+		if (result < 0) {
+			low = mid + 1;
+		}
+		else {
+			high = mid;
+		}
+	}
+	id = begin = end = 0;
+	return false;
+}
+
+} // namespace PIME
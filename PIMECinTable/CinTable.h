@@ -0,0 +1,169 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+#ifndef _PIME_CIN_TABLE_H_
+#define _PIME_CIN_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "CinTableFormat.h"
+
+namespace PIME {
+
+// UTF-8 string inside the mapped table, not necessarily '\0' terminated
+struct CinString {
+	const char* data;
+	size_t size;
+};
+
+// Read-only view of a compiled cin table (see CinTableFormat.h).
+// The file is memory-mapped, so opening it does not parse anything, and the pages are
+// shared by all processes using the same table.
+// All methods are const after open() and can be called from multiple threads.
+class CinTable {
+public:
+	CinTable();
+	~CinTable();
+
+	// path is in UTF-8
+	bool open(const std::string& path);
+
+	void close();
+
+	CinString meta(CinTableMetaField field) const;
+
+	size_t keyCount() const {
+		return keyCount_;
+	}
+
+	CinString key(size_t index) const;
+
+	// index of the key, or -1 if it's not in the table
+	ptrdiff_t findKey(const char* key, size_t len) const;
+
+	// the keys starting with prefix are [begin, end)
+	void findPrefix(const char* prefix, size_t len, size_t& begin, size_t& end) const;
+
+	// Narrows [begin, end), in which all keys have the same first pos bytes, to the keys
+	// followed by the bytes at pos.
+	void narrowRange(size_t& begin, size_t& end, size_t pos, const char* bytes, size_t len) const;
+
+	// the values of the key are [valueBegin(index), valueEnd(index))
+	uint32_t valueBegin(size_t index) const {
+		return valueStarts_[index];
+	}
+
+	uint32_t valueEnd(size_t index) const {
+		return valueStarts_[index + 1];
+	}
+
+	// offset of a value in the string pool, which identifies the string
+	uint32_t valueId(uint32_t value) const {
+		return values_[value];
+	}
+
+	CinString string(uint32_t id) const;
+
+	uint8_t stringAttributes(uint32_t id) const {
+		return id < stringsSize_ ? uint8_t(strings_[id]) : 0;
+	}
+
+	bool findKeyName(const char* key, size_t len, CinString& name) const;
+
+	// whether the table has the inverted index of the values
+	bool hasValueIndex() const {
+		return valueIndex_ != nullptr;
+	}
+
+	// Finds the keys having the value with the inverted index.
+	// id is the offset of the value in the string pool, and the indexes of the keys are
+	// valueKey(begin) to valueKey(end - 1) in ascending order.
+	bool findValueKeys(const char* value, size_t len, uint32_t& id, uint32_t& begin, uint32_t& end) const;
+
+	size_t valueKey(uint32_t i) const {
+		return valueKeys_[i];
+	}
+
+	// whether the table has the trie of the keys, the root of which is node 0
+	bool hasTrie() const {
+		return trie_ != nullptr;
+	}
+
+	// the child of the trie node for the next byte of the keys, or CIN_TRIE_NONE
+	uint32_t trieNext(uint32_t node, uint8_t byte) const {
+		if (node >= trieSize_) {
+			return CIN_TRIE_NONE;
+		}
+		uint64_t child = uint64_t(trie_[node].base) + byte + 1;
+		return child < trieSize_ && trie_[child].check == node ? uint32_t(child) : CIN_TRIE_NONE;
+	}
+
+	// whether the bytes from the root to the node are a key
+	bool trieIsKey(uint32_t node) const {
+		if (node >= trieSize_) {
+			return false;
+		}
+		uint32_t terminal = trie_[node].base;
+		return terminal < trieSize_ && trie_[terminal].check == node;
+	}
+
+	// the keys starting with the bytes from the root to the node are [begin, end)
+	void trieKeys(uint32_t node, size_t& begin, size_t& end) const {
+		begin = end = 0;
+		if (node < trieSize_) {
+			begin = trie_[node].keyBegin;
+			end = trie_[node].keyEnd;
+		}
+	}
+
+private:
+	const void* section(CinTableSectionId id, uint32_t& size) const;
+	int compareKey(size_t index, const char* key, size_t len) const;
+
+	void* fileHandle_;
+	void* mappingHandle_;
+	const char* data_;
+	size_t dataSize_;
+
+	uint32_t meta_[CIN_META_FIELD_COUNT];
+	const char* strings_;
+	uint32_t stringsSize_;
+	size_t keyCount_;
+	const uint32_t* keyOffsets_;
+	const char* keyChars_;
+	uint32_t keyCharsSize_;
+	const uint32_t* valueStarts_;
+	const uint32_t* values_;
+	uint32_t valueCount_;
+	const uint32_t* keyNames_;
+	uint32_t keyNameCount_;
+	const uint32_t* valueIndex_;
+	uint32_t valueIndexCount_;
+	const uint32_t* valueKeyStarts_;
+	const uint32_t* valueKeys_;
+	const CinTrieNode* trie_;
+	uint32_t trieSize_;
+};
+
+} // namespace PIME
+
+#endif // _PIME_CIN_TABLE_H_
@@ -0,0 +1,143 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+#ifndef _PIME_CIN_TABLE_FORMAT_H_
+#define _PIME_CIN_TABLE_FORMAT_H_
+
+#include <cstdint>
+
+namespace PIME {
+
+// On-disk format of the compiled cin tables (*.bin), generated by PIMECinCompiler (CinCompiler)
+// from the *.cin sources and memory-mapped by CinTable.
+//
+// All integers are little endian. The file starts with a CinTableHeader, followed by the
+// section directory (CinTableSection[sectionCount]). The sections can be in any order and
+// are aligned to 4 bytes. Readers ignore sections they do not know, so new sections can be
+// added without changing the version.
+//
+// Sections:
+//   META:         uint32_t[META_FIELD_COUNT], offsets of the ename, cname, selkey, and
+//                 cincount (a JSON object) strings in the STRINGS section.
+//   STRINGS:      string pool. Each entry is <attributes: uint8_t> <UTF-8 bytes> <'\0'>,
+//                 referenced by the offset of its attributes byte. Equal strings are stored once.
+//                 The attributes are CinStringAttribute flags and the CinCharSet of the first
+//                 character of the string.
+//   KEY_OFFSETS:  uint32_t[keyCount + 1], offsets of the keys in KEY_CHARS.
+//                 Keys are sorted by their UTF-8 bytes, which is also the code point order.
+//   KEY_CHARS:    UTF-8 bytes of all keys, not '\0' terminated.
+//   VALUE_STARTS: uint32_t[keyCount + 1], the values of key i are VALUES[VALUE_STARTS[i]] to
+//                 VALUES[VALUE_STARTS[i + 1] - 1], in the order of the cin file.
+//   VALUES:       uint32_t[], offsets of the values in STRINGS.
+//   KEY_NAMES:    uint32_t count, followed by count pairs of STRINGS offsets <key> <name>,
+//                 sorted by key. These are the %keyname definitions.
+//   VALUE_INDEX:  inverted index for reverse lookups (optional).
+//                 uint32_t[valueIndexCount], STRINGS offsets of the distinct values sorted by
+//                 their UTF-8 bytes.
+//   VALUE_KEY_STARTS: uint32_t[valueIndexCount + 1], the keys having value i are
+//                 VALUE_KEYS[VALUE_KEY_STARTS[i]] to VALUE_KEYS[VALUE_KEY_STARTS[i + 1] - 1].
+//   VALUE_KEYS:   uint32_t[], indexes of the keys in ascending order.
+//   KEY_TRIE:     double-array trie of the UTF-8 bytes of the keys (optional),
+//                 CinTrieNode[], the root is node 0. The child of node s for byte b is
+//                 t = base(s) + b + 1 if check(t) == s, and t = base(s) + 0 with check(t) == s
+//                 marks that the bytes from the root to s are a key. The keys starting with the
+//                 bytes of a node are keys keyBegin to keyEnd - 1.
+//   SOURCE_HASH:  uint32_t[2], low and high 32 bits of the hash of the .cin file and the options
+//                 of the compiler, which skips the tables compiled from the same source.
+
+static const char CIN_TABLE_MAGIC[8] = {'P', 'I', 'M', 'E', 'C', 'I', 'N', '\0'};
+static constexpr uint32_t CIN_TABLE_VERSION = 1;
+
+enum CinTableSectionId : uint32_t {
+	CIN_SECTION_META = 1,
+	CIN_SECTION_STRINGS = 2,
+	CIN_SECTION_KEY_OFFSETS = 3,
+	CIN_SECTION_KEY_CHARS = 4,
+	CIN_SECTION_VALUE_STARTS = 5,
+	CIN_SECTION_VALUES = 6,
+	CIN_SECTION_KEY_NAMES = 7,
+	CIN_SECTION_VALUE_INDEX = 8,
+	CIN_SECTION_VALUE_KEY_STARTS = 9,
+	CIN_SECTION_VALUE_KEYS = 10,
+	CIN_SECTION_KEY_TRIE = 11,
+	CIN_SECTION_SOURCE_HASH = 12
+};
+
+enum CinTableMetaField : uint32_t {
+	CIN_META_ENAME = 0,
+	CIN_META_CNAME,
+	CIN_META_SELKEY,
+	CIN_META_CINCOUNT,
+	CIN_META_FIELD_COUNT
+};
+
+// bits of the attributes byte of the strings
+enum CinStringAttribute : uint8_t {
+	CIN_STRING_CHARSET_MASK = 0x1f,  // CinCharSet
+	CIN_STRING_PRIVATE_USE = 0x80  // in the privateuse list, hidden if ignorePrivateUseArea is set
+};
+
+// character sets of Cin.getCharSet() in python/cinbase/cin.py, which decide the order of the
+// candidates of wildcard searches
+enum CinCharSet : uint8_t {
+	CIN_CHARSET_CJK_OTHER = 0,  // not a CJK unified ideograph
+	CIN_CHARSET_BOPOMOFO,
+	CIN_CHARSET_CJK,  // CJK unified ideographs not in Big5
+	CIN_CHARSET_BIG5_F,  // frequently used characters of Big5
+	CIN_CHARSET_BIG5_LF,  // less frequently used characters and symbols of Big5
+	CIN_CHARSET_BIG5_OTHER,
+	CIN_CHARSET_CJK_EXT_A,
+	CIN_CHARSET_CJK_EXT_B,
+	CIN_CHARSET_CJK_EXT_C,
+	CIN_CHARSET_CJK_EXT_D,
+	CIN_CHARSET_CJK_EXT_E,
+	CIN_CHARSET_CJK_EXT_F,
+	CIN_CHARSET_CJK_CI_IBM,  // the 12 unified ideographs in the CJK compatibility ideographs block
+	CIN_CHARSET_PUA  // private use area and other CJK compatibility ideographs
+};
+
+#pragma pack(push, 4)
+
+struct CinTableHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t sectionCount;
+};
+
+struct CinTableSection {
+	uint32_t id;
+	uint32_t offset;  // from the beginning of the file
+	uint32_t size;
+};
+
+struct CinTrieNode {
+	uint32_t base;
+	uint32_t check;  // parent node, CIN_TRIE_NONE for unused nodes and the root
+	uint32_t keyBegin;
+	uint32_t keyEnd;
+};
+
+#pragma pack(pop)
+
+static constexpr uint32_t CIN_TRIE_NONE = UINT32_MAX;
+
+} // namespace PIME
+
+#endif // _PIME_CIN_TABLE_FORMAT_H_
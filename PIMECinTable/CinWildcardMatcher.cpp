@@ -0,0 +1,151 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+#include "CinWildcardMatcher.h"
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+namespace PIME {
+
+// index of the bucket of the low frequency character sets, or -1 for high frequency ones.
+// The order is the same as lowFrequencyCharSetList of Cin.getWildcardCharDefs().
+static int lowFrequencyBucket(uint8_t charSet) {
+	switch (charSet) {
+	case CIN_CHARSET_CJK_EXT_A:
+		return 0;
+	case CIN_CHARSET_CJK_EXT_B:
+		return 1;
+	case CIN_CHARSET_CJK_EXT_C:
+		return 2;
+	case CIN_CHARSET_CJK_EXT_D:
+		return 3;
+	case CIN_CHARSET_CJK_EXT_E:
+		return 4;
+	case CIN_CHARSET_CJK_EXT_F:
+		return 5;
+	case CIN_CHARSET_CJK_CI_IBM:
+		return 6;
+	case CIN_CHARSET_PUA:
+		return 7;
+	case CIN_CHARSET_CJK_OTHER:
+		return 8;
+	default:  // bopomofo, CJK, and Big5
+		return -1;
+	}
+}
+
+// number of bytes of the UTF-8 character starting with the byte
+static size_t utf8CharSize(char lead) {
+	auto c = uint8_t(lead);
+	return c < 0x80 ? 1 : (c < 0xe0 ? 2 : (c < 0xf0 ? 3 : 4));
+}
+
+CinWildcardMatcher::CinWildcardMatcher(const CinTable& table, bool skipPrivateUse, size_t maxCount):
+	table_(table),
+	skipPrivateUse_(skipPrivateUse),
+	maxCount_(maxCount),
+	done_(false) {
+}
+
+void CinWildcardMatcher::match(const char* pattern, size_t len, const char* wildcard, size_t wildcardLen) {
+	tokens_.clear();
+	candidates_.clear();
+	for (auto& bucket : lowFrequency_) {
+		bucket.clear();
+	}
+	done_ = maxCount_ == 0;
+
+	for (size_t pos = 0; pos < len;) {
+		size_t size = min(utf8CharSize(pattern[pos]), len - pos);
+		bool isWildcard = size == wildcardLen && memcmp(pattern + pos, wildcard, size) == 0;
+		tokens_.push_back(Token{pattern + pos, size, isWildcard});
+		pos += size;
+	}
+	if (!done_) {
+		matchRange(0, table_.keyCount(), 0, 0);
+	}
+
+	// append the low frequency ones if there are not enough candidates
+	for (auto& bucket : lowFrequency_) {
+		for (uint32_t id : bucket) {
+			if (candidates_.size() >= maxCount_) {
+				return;
+			}
+			// the same string is always in the same bucket, so it's not in the high frequency ones
+			candidates_.push_back(id);
+		}
+	}
+}
+
+void CinWildcardMatcher::matchRange(size_t begin, size_t end, size_t pos, size_t token) {
+	if (token == tokens_.size()) {
+		// the key having only the matched characters is the first one in the range
+		if (begin < end && table_.key(begin).size == pos) {
+			addValues(begin);
+		}
+		return;
+	}
+	const Token& t = tokens_[token];
+	if (!t.isWildcard) {
+		table_.narrowRange(begin, end, pos, t.data, t.size);
+		if (begin < end) {
+			matchRange(begin, end, pos + t.size, token + 1);
+		}
+		return;
+	}
+	// a key ending here has no character for the wildcard
+	if (begin < end && table_.key(begin).size == pos) {
+		++begin;
+	}
+	while (begin < end && !done_) {
+		CinString k = table_.key(begin);
+		size_t size = min(utf8CharSize(k.data[pos]), k.size - pos);
+		size_t subBegin = begin, subEnd = end;
+		table_.narrowRange(subBegin, subEnd, pos, k.data + pos, size);
+		matchRange(subBegin, subEnd, pos + size, token + 1);
+		begin = subEnd;
+	}
+}
+
+void CinWildcardMatcher::addValues(size_t index) {
+	for (uint32_t value = table_.valueBegin(index); value < table_.valueEnd(index) && !done_; ++value) {
+		uint32_t id = table_.valueId(value);
+		uint8_t attributes = table_.stringAttributes(id);
+		if (skipPrivateUse_ && (attributes & CIN_STRING_PRIVATE_USE)) {
+			continue;
+		}
+		int bucket = lowFrequencyBucket(attributes & CIN_STRING_CHARSET_MASK);
+		if (bucket < 0) {
+			candidates_.push_back(id);
+			done_ = candidates_.size() >= maxCount_;
+		}
+		else {
+			auto& ids = lowFrequency_[bucket];
+			// at most maxCount of them can be used
+			if (ids.size() < maxCount_ && find(ids.begin(), ids.end(), id) == ids.end()) {
+				ids.push_back(id);
+			}
+		}
+	}
+}
+
+} // namespace PIME
@@ -0,0 +1,77 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+#ifndef _PIME_CIN_WILDCARD_MATCHER_H_
+#define _PIME_CIN_WILDCARD_MATCHER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "CinTable.h"
+
+namespace PIME {
+
+// Native version of Cin.getWildcardCharDefs() in python/cinbase/cin.py.
+//
+// The wildcard matches exactly one character. The sorted keys of the table are walked like a
+// trie: a literal character narrows the range of keys with binary searches, and a wildcard
+// visits the ranges of the distinct characters at the position, so only the matching branches
+// are visited, in the sorted order of the keys.
+//
+// Values of frequently used character sets (Big5, bopomofo, and other CJK unified ideographs)
+// are returned first in the order of the keys, and the matching stops as soon as maxCount of
+// them are found. Other values follow by their character set, without duplicates.
+// The character set of each value is precomputed in the attributes of the strings.
+class CinWildcardMatcher {
+public:
+	CinWildcardMatcher(const CinTable& table, bool skipPrivateUse, size_t maxCount);
+
+	// pattern and wildcard are UTF-8
+	void match(const char* pattern, size_t len, const char* wildcard, size_t wildcardLen);
+
+	// string ids of the candidates, valid after match()
+	const std::vector<uint32_t>& candidates() const {
+		return candidates_;
+	}
+
+private:
+	struct Token {
+		const char* data;
+		size_t size;
+		bool isWildcard;
+	};
+
+	void matchRange(size_t begin, size_t end, size_t pos, size_t token);
+	void addValues(size_t index);
+
+	static constexpr size_t LOW_FREQUENCY_BUCKETS = 9;
+
+	const CinTable& table_;
+	bool skipPrivateUse_;
+	size_t maxCount_;
+	bool done_;
+	std::vector<Token> tokens_;
+	std::vector<uint32_t> candidates_;  // high frequency ones until match() returns
+	std::vector<uint32_t> lowFrequency_[LOW_FREQUENCY_BUCKETS];
+};
+
+} // namespace PIME
+
+#endif // _PIME_CIN_WILDCARD_MATCHER_H_
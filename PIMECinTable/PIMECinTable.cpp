@@ -0,0 +1,257 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+// C interface of the compiled cin tables, used by python/cinbase/cintable.py through ctypes.
+//
+// Functions returning strings write them to the buffer provided by the caller, each followed
+// by '\0', and return the number of bytes required. If the buffer is too small, nothing useful
+// is written and the caller should call again with a buffer of the returned size.
+
+#include "CinCharSet.h"
+#include "CinTable.h"
+#include "CinWildcardMatcher.h"
+#include <cstring>
+
+using namespace std;
+using namespace PIME;
+
+namespace {
+
+enum {
+	SKIP_PRIVATE_USE = 1  // skip the strings in the privateuse list
+};
+
+class OutputBuffer {
+public:
+	OutputBuffer(char* buf, int size) :
+		buf_(buf),
+		size_(buf ? size_t(size) : 0),
+		used_(0) {
+	}
+
+	void append(const char* str, size_t len) {
+		if (used_ + len + 1 <= size_) {
+			memcpy(buf_ + used_, str, len);
+			buf_[used_ + len] = '\0';
+		}
+		used_ += len + 1;
+	}
+
+	void append(const CinString& str) {
+		append(str.data, str.size);
+	}
+
+	int result() const {
+		return int(used_);
+	}
+
+private:
+	char* buf_;
+	size_t size_;
+	size_t used_;
+};
+
+inline const CinTable* toTable(void* table) {
+	return reinterpret_cast<const CinTable*>(table);
+}
+
+inline bool isSkipped(const CinTable* table, uint32_t id, int flags) {
+	return (flags & SKIP_PRIVATE_USE) && (table->stringAttributes(id) & CIN_STRING_PRIVATE_USE);
+}
+
+inline bool equals(const CinString& str, const char* data, size_t len) {
+	return str.size == len && memcmp(str.data, data, len) == 0;
+}
+
+} // anonymous namespace
+
+extern "C" {
+
+// path is in UTF-8. returns nullptr if the file does not exist or is not a valid table.
+void* cin_table_open(const char* path) {
+	auto table = new CinTable();
+	if (!table->open(path)) {
+		delete table;
+		return nullptr;
+	}
+	return table;
+}
+
+void cin_table_close(void* table) {
+	delete reinterpret_cast<CinTable*>(table);
+}
+
+int cin_table_get_meta(void* table, int field, char* buf, int size) {
+	OutputBuffer output(buf, size);
+	if (field >= 0 && field < int(CIN_META_FIELD_COUNT)) {
+		output.append(toTable(table)->meta(CinTableMetaField(field)));
+	}
+	return output.result();
+}
+
+int cin_table_key_count(void* table) {
+	return int(toTable(table)->keyCount());
+}
+
+int cin_table_has_key(void* table, const char* key, int len) {
+	return toTable(table)->findKey(key, size_t(len)) >= 0;
+}
+
+// returns -1 if the key is not in the table
+int cin_table_get_values(void* table, const char* key, int len, int flags, char* buf, int size) {
+	auto t = toTable(table);
+	ptrdiff_t index = t->findKey(key, size_t(len));
+	if (index < 0) {
+		return -1;
+	}
+	OutputBuffer output(buf, size);
+	for (uint32_t value = t->valueBegin(index); value < t->valueEnd(index); ++value) {
+		uint32_t id = t->valueId(value);
+		if (!isSkipped(t, id, flags)) {
+			output.append(t->string(id));
+		}
+	}
+	return output.result();
+}
+
+// returns -1 if the key has no name
+int cin_table_get_key_name(void* table, const char* key, int len, char* buf, int size) {
+	CinString name;
+	if (!toTable(table)->findKeyName(key, size_t(len), name)) {
+		return -1;
+	}
+	OutputBuffer output(buf, size);
+	output.append(name);
+	return output.result();
+}
+
+// all keys in the sorted order
+int cin_table_get_keys(void* table, char* buf, int size) {
+	auto t = toTable(table);
+	OutputBuffer output(buf, size);
+	for (size_t i = 0; i < t->keyCount(); ++i) {
+		output.append(t->key(i));
+	}
+	return output.result();
+}
+
+// the first maxCount keys starting with prefix in the sorted order
+int cin_table_get_prefix_keys(void* table, const char* prefix, int len, int maxCount, char* buf, int size) {
+	auto t = toTable(table);
+	size_t begin, end;
+	t->findPrefix(prefix, size_t(len), begin, end);
+	OutputBuffer output(buf, size);
+	for (size_t i = begin; i < end && int(i - begin) < maxCount; ++i) {
+		output.append(t->key(i));
+	}
+	return output.result();
+}
+
+// Nodes of the trie of the keys, which callers keep as cursors of the keys being typed.
+// The root is node 0, and -1 means no node (no trie in the table, or no key with the bytes).
+int cin_table_trie_root(void* table) {
+	return toTable(table)->hasTrie() ? 0 : -1;
+}
+
+// the node after the UTF-8 bytes, usually one more character typed
+int cin_table_trie_next(void* table, int node, const char* bytes, int len) {
+	auto t = toTable(table);
+	uint32_t current = node >= 0 ? uint32_t(node) : CIN_TRIE_NONE;
+	for (int i = 0; i < len && current != CIN_TRIE_NONE; ++i) {
+		current = t->trieNext(current, uint8_t(bytes[i]));
+	}
+	return current != CIN_TRIE_NONE ? int(current) : -1;
+}
+
+// whether the bytes from the root to the node are a key
+int cin_table_trie_is_key(void* table, int node) {
+	return node >= 0 && toTable(table)->trieIsKey(uint32_t(node)) ? 1 : 0;
+}
+
+// number of keys starting with the bytes of the node, including the key of the node itself
+int cin_table_trie_key_count(void* table, int node) {
+	if (node < 0) {
+		return 0;
+	}
+	size_t begin, end;
+	toTable(table)->trieKeys(uint32_t(node), begin, end);
+	return int(end - begin);
+}
+
+// the first maxCount keys starting with the bytes of the node
+int cin_table_trie_get_keys(void* table, int node, int maxCount, char* buf, int size) {
+	auto t = toTable(table);
+	size_t begin = 0, end = 0;
+	if (node >= 0) {
+		t->trieKeys(uint32_t(node), begin, end);
+	}
+	OutputBuffer output(buf, size);
+	for (size_t i = begin; i < end && int(i - begin) < maxCount; ++i) {
+		output.append(t->key(i));
+	}
+	return output.result();
+}
+
+// the first maxCount keys having the value in the sorted order
+int cin_table_find_keys_with_value(void* table, const char* value, int len, int flags, int maxCount, char* buf, int size) {
+	auto t = toTable(table);
+	OutputBuffer output(buf, size);
+	if (t->hasValueIndex()) {
+		uint32_t id, begin, end;
+		if (t->findValueKeys(value, size_t(len), id, begin, end) && !isSkipped(t, id, flags)) {
+			for (uint32_t i = begin; i < end && int(i - begin) < maxCount; ++i) {
+				output.append(t->key(t->valueKey(i)));
+			}
+		}
+		return output.result();
+	}
+	// tables compiled without the index
+	int count = 0;
+	for (size_t i = 0; i < t->keyCount() && count < maxCount; ++i) {
+		for (uint32_t v = t->valueBegin(i); v < t->valueEnd(i); ++v) {
+			uint32_t id = t->valueId(v);
+			if (!isSkipped(t, id, flags) && equals(t->string(id), value, size_t(len))) {
+				output.append(t->key(i));
+				++count;
+				break;
+			}
+		}
+	}
+	return output.result();
+}
+
+// candidates of the wildcard search of Cin.getWildcardCharDefs(), see CinWildcardMatcher
+int cin_table_match_wildcard(void* table, const char* pattern, int len, const char* wildcard, int wildcardLen, int flags, int maxCount, char* buf, int size) {
+	auto t = toTable(table);
+	CinWildcardMatcher matcher(*t, (flags & SKIP_PRIVATE_USE) != 0, size_t(maxCount > 0 ? maxCount : 0));
+	matcher.match(pattern, size_t(len), wildcard, size_t(wildcardLen));
+	OutputBuffer output(buf, size);
+	for (uint32_t id : matcher.candidates()) {
+		output.append(t->string(id));
+	}
+	return output.result();
+}
+
+// CinCharSet of the code point, used by NativeCin.getCharSet()
+int cin_char_set(unsigned int codepoint) {
+	return cinCharSetOf(codepoint);
+}
+
+} // extern "C"
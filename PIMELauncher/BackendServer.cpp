@@ -69,19 +69,30 @@ std::shared_ptr<spdlog::logger>& BackendServer::logger() {
 	return pipeServer_->logger();
 }
 
-void BackendServer::handleClientMessage(PipeClient * client, const char * readBuf, size_t len) {
+void BackendServer::handleClientMessage(const std::string& clientId, const char * readBuf, size_t len) {
 	if (!isProcessRunning()) {
 		startProcess();
 	}
 
 	// message format: <client_id>|<json string>\n
-	string msg = string{ client->clientId_ };
+	string msg = clientId;
 	msg += "|";
-	msg.append(readBuf, len);
+	if (Trace::enabled()) {
+		// ask the backend to send its trace events of the request
+		TraceCollector::appendTraceFlag(msg, readBuf, len);
+	}
+	else {
+		msg.append(readBuf, len);
+	}
 	msg += "\n";
 
 	logger()->debug("SEND: {}", msg);
 
+	auto& recorder = pipeServer_->trafficRecorder();
+	if (recorder.isRecording()) {
+		recorder.recordRequest(name_, clientId, readBuf, len);
+	}
+
 	// write the message to the backend server
 	writeInputPipe(msg.c_str(), msg.length());
 }
@@ -145,6 +156,15 @@ void BackendServer::startProcess() {
 	// By default, python uses ANSI encoding in Windows and this breaks our unicode support.
 	// FIXME: makes this configurable from backend.json.
 	utf8_environ.emplace_back("PYTHONIOENCODING=utf-8:ignore");
+	// input methods the backend should load in the background after it's started
+	string preloadEnv = "PIME_PRELOAD=";
+	for (const auto& guid : pipeServer_->preloadInputMethods(this)) {
+		if (preloadEnv.back() != '=')
+			preloadEnv += ',';
+		preloadEnv += guid;
+	}
+	utf8_environ.emplace_back(preloadEnv);
+	readyInputMethods_.clear();
 	vector<const char*> env;
 	for (auto& v : utf8_environ) {
 		env.emplace_back(v.c_str());
@@ -165,6 +185,12 @@ void BackendServer::startProcess() {
 	// start receiving data from the backend server
 	startReadOutputPipe();
 	startReadErrorPipe();
+
+	// a replay of the recorded traffic should restart the backend here
+	auto& recorder = pipeServer_->trafficRecorder();
+	if (recorder.isRecording()) {
+		recorder.recordRestart(name_);
+	}
 }
 
 void BackendServer::restartProcess() {
@@ -235,8 +261,8 @@ void BackendServer::onProcessErrorReceived(uv_stream_t * stream, ssize_t nread,
 		return;
 	}
 	if (buf->base) {
-		// log the error message
-		logger()->error("[Backend error] {}", std::string(buf->base, buf->len));
+		// stderr is the diagnostic channel of the backends, including the tracebacks of errors
+		logger()->info("[Backend {}] {}", name_, std::string(buf->base, nread));
 		delete[]buf->base;
 	}
 }
@@ -307,12 +333,33 @@ void BackendServer::handleBackendReply() {
 						--msgLen;
 					}
 
+					auto& recorder = pipeServer_->trafficRecorder();
+					if (recorder.isRecording()) {
+						recorder.recordReply(name_, clientId, msg, msgLen);
+					}
+
 					// send the reply message back to the client
 					if (auto client = pipeServer_->clientFromId(clientId)) {
-						client->writePipe(msg, msgLen);
+						client->writeReply(clientId, msg, msgLen);
 					}
 				}
 			}
+			// an input method is preloaded: "PIME_READY|<guid>|{"success":<bool>,"time":<ms>}\n"
+			else if (strncmp(line, "PIME_READY|", 11) == 0) {
+				line += 11;
+				if (auto sep = strchr(line, '|')) {
+					onInputMethodReady(string(line, sep - line), sep + 1, lineEnd - (sep + 1));
+				}
+			}
+			// trace events of a request: "PIME_TRACE|<client_id>|<JSON array of events>\n"
+			else if (strncmp(line, "PIME_TRACE|", 11) == 0) {
+				line += 11;
+				if (auto sep = strchr(line, '|')) {
+					string clientId(line, sep - line);
+					auto events = sep + 1;
+					pipeServer_->traceCollector().addBackendEvents(name_, process_ ? process_->pid : 0, clientId, events, lineEnd - events);
+				}
+			}
 
 			// skip empty lines or additional CRLF, and go to the next non-empty line
 			lineStartPos = lineEndPos + 1;
@@ -325,6 +372,21 @@ void BackendServer::handleBackendReply() {
 	stdoutReadBuf_ = stdoutReadBuf_.substr(lineStartPos);
 }
 
+void BackendServer::onInputMethodReady(const std::string& guid, const char* status, size_t len) {
+	Json::Value result;
+	Json::Reader reader;
+	if (!reader.parse(status, status + len, result)) {
+		return;
+	}
+	if (result["success"].asBool()) {
+		readyInputMethods_.insert(guid);
+		logger()->info("Input method {} is preloaded by backend {} in {} ms", guid, name_, result["time"].asInt());
+	}
+	else {
+		logger()->warn("Backend {} fails to preload input method {}", name_, guid);
+	}
+}
+
 void BackendServer::startReadOutputPipe() {
 	uv_read_start(stdoutStream(), allocReadBuf,
 		[](uv_stream_t* stream, ssize_t nread, const uv_buf_t* buf) {
@@ -28,6 +28,7 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <uv.h>
 #include <json/json.h>
@@ -73,7 +74,7 @@ public:
 
 	std::shared_ptr<spdlog::logger>& logger();
 
-	void handleClientMessage(PipeClient* client, const char* readBuf, size_t len);
+	void handleClientMessage(const std::string& clientId, const char* readBuf, size_t len);
 
 	void startReadOutputPipe();
 
@@ -81,6 +82,11 @@ public:
 
 	void writeInputPipe(const char* data, size_t len);
 
+	// whether the backend reported that the input method is preloaded
+	bool isInputMethodReady(const std::string& guid) const {
+		return readyInputMethods_.find(guid) != readyInputMethods_.end();
+	}
+
 private:
 	static void allocReadBuf(uv_handle_t*, size_t suggested_size, uv_buf_t* buf);
 	void onProcessDataReceived(uv_stream_t* stream, ssize_t nread, const uv_buf_t* buf);
@@ -89,6 +95,7 @@ private:
 	void closeStdioPipes();
 
 	void handleBackendReply();
+	void onInputMethodReady(const std::string& guid, const char* status, size_t len);
 
 private:
 	PipeServer* pipeServer_;
@@ -99,6 +106,7 @@ private:
 	uv_pipe_t* stderrPipe_;
 	bool ready_;
 	std::string stdoutReadBuf_;
+	std::unordered_set<std::string> readyInputMethods_;  // GUIDs of the preloaded input methods
 
 	bool needRestart_;
 	// command to launch the server process
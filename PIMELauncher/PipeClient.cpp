@@ -21,6 +21,8 @@
 #include "PipeServer.h"
 
 #include "BackendServer.h"
+#include <algorithm>
+#include <vector>
 
 using namespace std;
 
@@ -32,8 +34,16 @@ static wstring_convert<codecvt_utf8<wchar_t>> utf8Codec;
 static constexpr std::uint64_t BACKEND_REQUEST_TIMEOUT_MS = 30 * 1000;
 
 
+// reply sent by the launcher when a session is closed
+static const char SESSION_CLOSED_REPLY[] = "{\"success\":true}";
+// reply sent by the launcher when no backend is available for a session
+static const char NO_BACKEND_REPLY[] = "{\"success\":false}";
+// reply sent by the launcher when the trace events of a text service are received
+static const char TRACE_EVENTS_REPLY[] = "{\"success\":true}";
+
+
 PipeClient::PipeClient(PipeServer* server, DWORD pipeMode, SECURITY_ATTRIBUTES* securityAttributes) :
-	backend_(nullptr),
+	pendingRequests_(0),
 	server_{ server } {
 
 	// setup pipe
@@ -46,7 +56,7 @@ PipeClient::PipeClient(PipeServer* server, DWORD pipeMode, SECURITY_ATTRIBUTES*
 	UuidCreate(&uuid);
 	RPC_CSTR uuid_str = nullptr;
 	UuidToStringA(&uuid, &uuid_str);
-	clientId_ = (char*)uuid_str;
+	id_ = (char*)uuid_str;
 	RpcStringFreeA(&uuid_str);
 
 	// setup a timer to detect request timeout
@@ -70,16 +80,78 @@ void PipeClient::startReadPipe() {
 	});
 }
 
-void PipeClient::writePipe(const char* data, size_t len) {
-	// we got a response before request timeout, so stop the timer
-	stopWaitTimer();
+// static
+std::string PipeClient::pipeIdFromClientId(const std::string& clientId) {
+	auto sep = clientId.find('#');
+	return sep == clientId.npos ? clientId : clientId.substr(0, sep);
+}
+
+bool PipeClient::usesBackend(BackendServer* backend) const {
+	for (const auto& item : sessions_) {
+		if (item.second.backend == backend)
+			return true;
+	}
+	return false;
+}
+
+void PipeClient::writeReply(const std::string& clientId, const char* data, size_t len) {
+	unsigned int sessionId = 0;
+	auto sep = clientId.find('#');
+	if (sep != clientId.npos) {
+		sessionId = strtoul(clientId.c_str() + sep + 1, nullptr, 10);
+	}
+
+	// The sessions of the client wait for their replies concurrently and match them by the
+	// session id, so a reply nobody waits for, such as a late one after the request timed out,
+	// is dropped instead of being taken as the reply of the next request.
+	auto session_it = sessions_.find(sessionId);
+	if (session_it == sessions_.end() || !session_it->second.waitingReply) {
+		logger()->warn("Drop the unexpected reply to {}", clientId);
+		return;
+	}
+	session_it->second.waitingReply = false;
+	--pendingRequests_;
+	if (pendingRequests_ == 0)
+		stopWaitTimer();
+	else  // other sessions are still waiting, so wait for another timeout after each reply
+		startWaitTimer(BACKEND_REQUEST_TIMEOUT_MS);
+
+	Session& session = session_it->second;
+	if (Trace::enabled() && session.traceSentTime != 0) {
+		uint64_t context = server_->traceCollector().clientContext(clientId);
+		// time spent by the backend, including the transfer of the request and the reply
+		Trace::record("launcher.backend", context, session.traceSeqNum, session.traceSentTime, Trace::now());
+		session.traceSentTime = 0;
+
+		Trace::Scope scope("launcher.reply", context, session.traceSeqNum);
+		writePipe(sessionId, data, len);
+		return;
+	}
+	writePipe(sessionId, data, len);
+}
+
+void PipeClient::writePipe(unsigned int sessionId, const char* data, size_t len) {
+	// add the session id prefix: "<session id>|"
+	char prefix[16];
+	size_t prefixLen = 0;
+	if (sessionId != 0) {
+		prefixLen = snprintf(prefix, sizeof(prefix), "%u|", sessionId);
+	}
 
 	// The memory pointed to by the buffers must remain valid until the callback gets called. 
 	// http://docs.libuv.org/en/v1.x/stream.html
 	// So we need to copy the buffer
-	char* copiedData = new char[len];
-	memcpy(copiedData, data, len);
-	uv_buf_t buf = { len, copiedData };
+	std::string traced;
+	if (Trace::enabled()) {
+		// tell the text service to record trace events of its next request
+		TraceCollector::appendTraceFlag(traced, data, len);
+		data = traced.c_str();
+		len = traced.length();
+	}
+	char* copiedData = new char[prefixLen + len];
+	memcpy(copiedData, prefix, prefixLen);
+	memcpy(copiedData + prefixLen, data, len);
+	uv_buf_t buf = { prefixLen + len, copiedData };
 	uv_write_t* req = new uv_write_t{};
 	req->data = copiedData;
 	uv_write(req, stream(), &buf, 1, [](uv_write_t* req, int status) {
@@ -106,39 +178,113 @@ void PipeClient::onClientDataReceived(uv_stream_t* stream, ssize_t nread, const
 		return;
 	}
 	if (buf->base) {
-		handleClientMessage(buf->base, buf->len);
+		handleClientMessage(buf->base, nread);
 		delete[]buf->base;
 	}
 }
 
 void PipeClient::handleClientMessage(const char* readBuf, size_t len) {
-	if (!backend_) {
+	// message format: "<session id>|<json string>" or "<json string>" for session 0
+	unsigned int sessionId = 0;
+	if (len > 0 && readBuf[0] >= '0' && readBuf[0] <= '9') {
+		const char* p = readBuf;
+		const char* end = readBuf + len;
+		while (p < end && *p >= '0' && *p <= '9') {
+			sessionId = sessionId * 10 + (*p - '0');
+			++p;
+		}
+		if (p >= end || *p != '|') {
+			logger()->error("Invalid message from the client: {}", std::string(readBuf, len));
+			return;
+		}
+		++p;
+		len -= (p - readBuf);
+		readBuf = p;
+	}
+
+	auto session_it = sessions_.find(sessionId);
+	if (session_it == sessions_.end()) {
+		// the client opens a new session
+		Session newSession{ nullptr, sessionId == 0 ? id_ : id_ + "#" + std::to_string(sessionId), false, 0, 0 };
+		session_it = sessions_.emplace(sessionId, std::move(newSession)).first;
+	}
+	Session& session = session_it->second;
+
+	// special handling for closing a session. The request is written by PIME::RequestWriter of the
+	// text service, so "method" is always the first key and we do not need to parse the whole message.
+	static const char closeMethod[] = "{\"method\":\"close\"";
+	if (len >= sizeof(closeMethod) - 1 && memcmp(readBuf, closeMethod, sizeof(closeMethod) - 1) == 0) {
+		if (session.backend) {
+			// notify the backend server to remove the client
+			session.backend->handleClientMessage(session.clientId, readBuf, len);
+		}
+		if (session.waitingReply)
+			--pendingRequests_;
+		sessions_.erase(session_it);
+		writePipe(sessionId, SESSION_CLOSED_REPLY, strlen(SESSION_CLOSED_REPLY));
+		return;
+	}
+
+	// trace events sent by the text service are collected by the launcher
+	static const char traceMethod[] = "{\"method\":\"trace\"";
+	if (len >= sizeof(traceMethod) - 1 && memcmp(readBuf, traceMethod, sizeof(traceMethod) - 1) == 0) {
+		server_->traceCollector().addClientEvents(id_, readBuf, len);
+		writePipe(sessionId, TRACE_EVENTS_REPLY, strlen(TRACE_EVENTS_REPLY));
+		return;
+	}
+
+	uint64_t traceBegin = 0;
+	if (Trace::enabled()) {
+		traceBegin = Trace::now();
+		session.traceSeqNum = TraceCollector::seqNumOf(readBuf, len);
+	}
+
+	if (!session.backend) {
 		// special handling, asked for init PIMELauncher.
 		// extract backend info from the request message and find a suitable backend
 		Json::Value msg;
 		Json::Reader reader;
-		if (reader.parse(readBuf, msg)) {
-			setupBackend(msg);
+		if (reader.parse(readBuf, readBuf + len, msg)) {
+			setupBackend(session, msg);
 		}
 	}
 
 	// pass the incoming message to the backend
-	if (backend_) {
+	if (session.backend) {
 		// start a timer to see if we can get a response from backend server before timeout.
-		startWaitTimer(BACKEND_REQUEST_TIMEOUT_MS);
+		// Requests of other sessions may be in flight already, and the timer keeps running for them.
+		if (!session.waitingReply) {
+			session.waitingReply = true;
+			if (pendingRequests_++ == 0)
+				startWaitTimer(BACKEND_REQUEST_TIMEOUT_MS);
+		}
 
 		// really call the backend
-		backend_->handleClientMessage(this, readBuf, len);
+		session.backend->handleClientMessage(session.clientId, readBuf, len);
+
+		if (traceBegin != 0) {
+			session.traceSentTime = Trace::now();
+			Trace::record("launcher.route", server_->traceCollector().clientContext(session.clientId),
+				session.traceSeqNum, traceBegin, session.traceSentTime);
+		}
+	}
+	else {
+		// reply immediately so the client is not blocked
+		writePipe(sessionId, NO_BACKEND_REPLY, strlen(NO_BACKEND_REPLY));
 	}
 }
 
-bool PipeClient::setupBackend(const Json::Value & params) {
+bool PipeClient::setupBackend(Session& session, const Json::Value & params) {
 	const char* method = params["method"].asCString();
 	if (method != nullptr && strcmp(method, "init") == 0) {  // the client connects to us the first time
 		// find a backend for the client text service
 		const char* guid = params["id"].asCString();
-		backend_ = server_->backendFromLangProfileGuid(guid);
-		if (backend_ != nullptr) {
+		session.backend = server_->backendFromLangProfileGuid(guid);
+		if (session.backend != nullptr) {
+			if (!session.backend->isInputMethodReady(guid)) {
+				logger()->info("Input method {} is used before it's preloaded", guid);
+			}
+			server_->onInputMethodUsed(guid);
 			// FIXME: write some response to indicate the failure
 			return true;
 		}
@@ -150,12 +296,16 @@ bool PipeClient::setupBackend(const Json::Value & params) {
 }
 
 void PipeClient::disconnectFromBackend() {
-	if (backend_ != nullptr) {
-		// FIXME: client->backend_->removeClient(client->clientId_);
-		// notify the backend server to remove the client
-		const char msg[] = "{\"method\":\"close\"}";
-		backend_->handleClientMessage(this, msg, strlen(msg));
+	// notify the backend servers to remove all sessions of the client
+	const char msg[] = "{\"method\":\"close\"}";
+	for (const auto& item : sessions_) {
+		if (item.second.backend != nullptr) {
+			item.second.backend->handleClientMessage(item.second.clientId, msg, strlen(msg));
+		}
 	}
+	sessions_.clear();
+	pendingRequests_ = 0;
+	stopWaitTimer();
 
 	server_->removeClient(this);
 
@@ -176,9 +326,20 @@ void PipeClient::stopWaitTimer() {
 void PipeClient::onRequestTimeout() {
 	// We sent a message to the backend server, but haven't got any response before the timeout
 	// Assume that the backend server is dead. => Try to restart
-	if (backend_) {
-		logger()->critical("Backend {} seems to be dead. Try to restart!", backend_->name());
-		backend_->restartProcess();
+	std::vector<BackendServer*> deadBackends;
+	for (auto& item : sessions_) {
+		Session& session = item.second;
+		if (!session.waitingReply)
+			continue;
+		// the reply will never come, and a late one is dropped
+		session.waitingReply = false;
+		if (session.backend && std::find(deadBackends.begin(), deadBackends.end(), session.backend) == deadBackends.end())
+			deadBackends.push_back(session.backend);
+	}
+	pendingRequests_ = 0;
+	for (auto backend : deadBackends) {
+		logger()->critical("Backend {} seems to be dead. Try to restart!", backend->name());
+		backend->restartProcess();
 	}
 }
 
@@ -23,6 +23,8 @@
 #include <Windows.h>
 #include <memory>
 #include <cstdint>
+#include <string>
+#include <unordered_map>
 #include "BackendServer.h"
 
 #include <uv.h>
@@ -34,14 +36,25 @@ namespace PIME {
 class PipeServer;
 class BackendServer;
 
+// A connection from a text service process.
+// All text service instances in the process share the same pipe connection and each of them
+// opens a logical session on it. Messages of a session are framed as "<session id>|<JSON string>".
+// Messages without the session id prefix are handled as session 0 for older text service DLLs.
 class PipeClient {
 public:
-	BackendServer* backend_;
-	std::string textServiceGuid_;
-	std::string clientId_;
-
 	PipeClient(PipeServer* server, DWORD pipeMode, SECURITY_ATTRIBUTES* securityAttributes);
 
+	// unique ID of the pipe connection
+	const std::string& id() const {
+		return id_;
+	}
+
+	// get the pipe ID from the client ID of a session used by the backends
+	static std::string pipeIdFromClientId(const std::string& clientId);
+
+	// check if any session of this client is using the backend
+	bool usesBackend(BackendServer* backend) const;
+
 	uv_stream_t* stream() {
 		return reinterpret_cast<uv_stream_t*>(&pipe_);
 	}
@@ -50,9 +63,8 @@ public:
 
 	void startReadPipe();
 
-	void writePipe(const char* data, size_t len);
-
-	bool setupBackend(const Json::Value& params);
+	// send the reply of the backend to the session with the specified client ID
+	void writeReply(const std::string& clientId, const char* data, size_t len);
 
 	void disconnectFromBackend();
 
@@ -60,6 +72,19 @@ public:
 	void destroy();
 
 private:
+	struct Session {
+		BackendServer* backend;
+		std::string clientId; // ID of the session used by the backend: "<pipe id>#<session id>"
+		bool waitingReply; // a request of the session is sent to the backend and not replied yet
+		// the request sent to the backend when request tracing is enabled
+		uint32_t traceSeqNum;
+		uint64_t traceSentTime;
+	};
+
+	void writePipe(unsigned int sessionId, const char* data, size_t len);
+
+	bool setupBackend(Session& session, const Json::Value& params);
+
 	void startWaitTimer(std::uint64_t timeoutMs);
 
 	void stopWaitTimer();
@@ -71,6 +96,9 @@ private:
 	void onRequestTimeout();
 
 private:
+	std::string id_;
+	std::unordered_map<unsigned int, Session> sessions_;
+	unsigned int pendingRequests_; // number of sessions waiting for the replies of their backends
 	uv_pipe_t pipe_;
 	PipeServer* server_;
 
@@ -63,12 +63,17 @@ static constexpr UINT MAIN_SHELL_NOTIFY_ICON_ID = 1;
 static constexpr UINT ID_ENABLE_DEBUG_LOG = 1000;
 static constexpr UINT ID_SHOW_DEBUG_LOGS = 1001;
 static constexpr UINT ID_RESTART_PIME_BACKENDS = 1002;
+static constexpr UINT ID_TRACE_REQUESTS = 1003;
+static constexpr UINT ID_RECORD_TRAFFIC = 1004;
 
 static constexpr size_t MAX_LOG_FILE_SIZE = 5 * 1024 * 1024; // log file size: 5 MB
 static constexpr int NUM_LOG_FILES = 5;  // backup 3 copies of the log file
 
 static constexpr wchar_t CONFIG_FILE_REL_PATH[] = L"\\PIMELauncher.json";
 
+// max number of recently used input methods preloaded by the backends
+static constexpr size_t MAX_RECENT_INPUT_METHODS = 4;
+
 
 PipeServer::PipeServer() :
 	securittyDescriptor_(nullptr),
@@ -77,7 +82,8 @@ PipeServer::PipeServer() :
 	allAppsSID_(nullptr),
 	quitExistingLauncher_(false),
 	singleInstanceMutex_(nullptr),
-	logLevel_{spdlog::level::warn} {
+	logLevel_{spdlog::level::warn},
+	recordTraffic_(false) {
 
 	// this can only be assigned once
 	assert(singleton_ == nullptr);
@@ -133,6 +139,13 @@ void PipeServer::loadConfig() {
 	if (loadJsonFile(configFile, config)) {
 		auto levelName = config["logLevel"].asString();
 		logLevel_ = spdlog::level::from_str(levelName);
+
+		for (const auto& guid : config["preloadInputMethods"]) {
+			configuredPreloadInputMethods_.emplace_back(guid.asString());
+		}
+		for (const auto& guid : config["recentInputMethods"]) {
+			recentInputMethods_.emplace_back(guid.asString());
+		}
 	}
 }
 
@@ -140,6 +153,17 @@ void PipeServer::saveConfig() {
 	auto configFile = dataDirPath_ + CONFIG_FILE_REL_PATH;
 	Json::Value config;
 	config["logLevel"] = spdlog::level::to_c_str(logLevel_);
+	std::lock_guard<std::mutex> lock(configMutex_);
+	if (!configuredPreloadInputMethods_.empty()) {
+		auto& guids = config["preloadInputMethods"] = Json::Value(Json::arrayValue);
+		for (const auto& guid : configuredPreloadInputMethods_) {
+			guids.append(guid);
+		}
+	}
+	auto& recentGuids = config["recentInputMethods"] = Json::Value(Json::arrayValue);
+	for (const auto& guid : recentInputMethods_) {
+		recentGuids.append(guid);
+	}
 	if (!saveJsonFile(configFile, config)) {
 		logger_->error("fail to write config file");
 	}
@@ -214,6 +238,104 @@ void PipeServer::restartAllBackends() {
 	}
 }
 
+void PipeServer::startPreloadingBackends() {
+	// start the backends having input methods to preload, so they're ready before the first keystroke
+	for (auto& backend : backends_) {
+		if (!backend->isProcessRunning() && !preloadInputMethods(backend).empty()) {
+			logger_->info("Start backend {} to preload input methods", backend->name());
+			backend->startProcess();
+		}
+	}
+}
+
+void PipeServer::onInputMethodUsed(const std::string& guid) {
+	std::string lowerGuid = guid;
+	transform(lowerGuid.begin(), lowerGuid.end(), lowerGuid.begin(), tolower);
+	{
+		std::lock_guard<std::mutex> lock(configMutex_);
+		if (!recentInputMethods_.empty() && recentInputMethods_.front() == lowerGuid)
+			return;  // nothing changed
+		recentInputMethods_.erase(std::remove(recentInputMethods_.begin(), recentInputMethods_.end(), lowerGuid), recentInputMethods_.end());
+		recentInputMethods_.insert(recentInputMethods_.begin(), lowerGuid);
+		if (recentInputMethods_.size() > MAX_RECENT_INPUT_METHODS) {
+			recentInputMethods_.resize(MAX_RECENT_INPUT_METHODS);
+		}
+	}
+	saveConfig();
+}
+
+std::vector<std::string> PipeServer::preloadInputMethods(BackendServer* backend) const {
+	std::vector<std::string> guids;
+	std::lock_guard<std::mutex> lock(configMutex_);
+	const auto& candidates = configuredPreloadInputMethods_.empty() ? recentInputMethods_ : configuredPreloadInputMethods_;
+	for (auto guid : candidates) {
+		transform(guid.begin(), guid.end(), guid.begin(), tolower);
+		auto it = backendMap_.find(guid);
+		if (it != backendMap_.end() && it->second == backend) {
+			guids.emplace_back(std::move(guid));
+		}
+	}
+	return guids;
+}
+
+// called from the GUI thread
+void PipeServer::toggleTrace() {
+	Trace::setEnabled(!Trace::enabled());
+	// the collected events are only accessed in the main loop
+	uv_async_send(&traceToggledAsync_);
+}
+
+void PipeServer::onTraceToggled() {
+	if (Trace::enabled()) {
+		logger_->info("Start tracing requests");
+		traceCollector_.clear();
+	}
+	else {
+		// write the trace of the requests to the log dir, which can be loaded by chrome://tracing
+		std::wstring path = logFilePath(L"trace", L"json");
+		if (traceCollector_.writeFile(path)) {
+			logger_->info("Request trace is written to {}", utf8Codec.to_bytes(path));
+		}
+		else {
+			logger_->error("Failed to write request trace to {}", utf8Codec.to_bytes(path));
+		}
+	}
+}
+
+// called from the GUI thread
+void PipeServer::toggleTrafficRecording() {
+	recordTraffic_ = !recordTraffic_;
+	// the recorder is only accessed in the main loop
+	uv_async_send(&trafficRecordingToggledAsync_);
+}
+
+void PipeServer::onTrafficRecordingToggled() {
+	if (recordTraffic_) {
+		std::wstring path = logFilePath(L"traffic", L"pimecap");
+		if (trafficRecorder_.start(path)) {
+			logger_->info("Recording IPC traffic to {}", utf8Codec.to_bytes(path));
+		}
+		else {
+			logger_->error("Failed to record IPC traffic to {}", utf8Codec.to_bytes(path));
+			recordTraffic_ = false;
+		}
+	}
+	else if (trafficRecorder_.isRecording()) {
+		trafficRecorder_.stop();
+		logger_->info("Stop recording IPC traffic");
+	}
+}
+
+// path of a new file in the log dir named by the current time: <prefix>-YYYYMMDD-HHMMSS.<extension>
+std::wstring PipeServer::logFilePath(const wchar_t* prefix, const wchar_t* extension) const {
+	wchar_t filename[64];
+	SYSTEMTIME now;
+	::GetLocalTime(&now);
+	swprintf_s(filename, L"\\Log\\%s-%04d%02d%02d-%02d%02d%02d.%s", prefix,
+		now.wYear, now.wMonth, now.wDay, now.wHour, now.wMinute, now.wSecond, extension);
+	return dataDirPath_ + filename;
+}
+
 BackendServer* PipeServer::backendFromName(const char* name) {
 	// for such a small list, linear search is often faster than hash table or map
 	for (BackendServer* backend : backends_) {
@@ -227,8 +349,9 @@ void PipeServer::onBackendClosed(BackendServer * backend) {
 	// the backend server is terminated, disconnect all clients using this backend
 	auto removed_it = std::remove_if(clients_.begin(), clients_.end(),
 		[backend](PipeClient* client) {
-		if (client->backend_ == backend) {
-			// if the client is using this broken backend, disconnect it
+		if (client->usesBackend(backend)) {
+			// if the client is using this broken backend, disconnect it.
+			// the text service will reconnect and initialize all of its sessions again.
 			client->destroy();
 			return true;
 		}
@@ -284,8 +407,9 @@ void PipeServer::quit() {
 PipeClient* PipeServer::clientFromId(const std::string& clientId) {
 	PipeClient* client = nullptr;
 	// find the client with this ID
-	auto it = std::find_if(clients_.cbegin(), clients_.cend(), [clientId](const PipeClient* client) {
-		return client->clientId_ == clientId;
+	std::string pipeId = PipeClient::pipeIdFromClientId(clientId);
+	auto it = std::find_if(clients_.cbegin(), clients_.cend(), [&pipeId](const PipeClient* client) {
+		return client->id() == pipeId;
 	});
 	if (it != clients_.cend()) {
 		client = *it;
@@ -442,6 +566,18 @@ int PipeServer::exec(LPSTR cmd) {
 		_this->onNewClientConnected(server, status);
 	});
 
+	// the GUI thread notifies us when request tracing is toggled
+	uv_async_init(uv_default_loop(), &traceToggledAsync_, [](uv_async_t* handle) {
+		reinterpret_cast<PipeServer*>(handle->data)->onTraceToggled();
+	});
+	traceToggledAsync_.data = this;
+	uv_async_init(uv_default_loop(), &trafficRecordingToggledAsync_, [](uv_async_t* handle) {
+		reinterpret_cast<PipeServer*>(handle->data)->onTrafficRecordingToggled();
+	});
+	trafficRecordingToggledAsync_.data = this;
+
+	startPreloadingBackends();
+
 	// run GUI message loop in another worker thread
 	uv_thread_t uiThread;
 	uv_thread_create(&uiThread, [](void* arg) {
@@ -485,6 +621,12 @@ LRESULT PipeServer::wndProc(UINT msg, WPARAM wp, LPARAM lp) {
 			// show logs dir
 			::ShellExecuteW(hwnd_, L"open", (dataDirPath_ + L"\\Log").c_str(), nullptr, nullptr, SW_SHOWNORMAL);
 			break;
+		case ID_TRACE_REQUESTS:
+			toggleTrace();
+			break;
+		case ID_RECORD_TRAFFIC:
+			toggleTrafficRecording();
+			break;
 		}
 		break;
 	default:
@@ -550,6 +692,8 @@ void PipeServer::showPopupMenu() const {
 	bool debugEnabled = logLevel_ <= spdlog::level::debug;
 	::AppendMenu(hmenu, MF_STRING|MF_ENABLED|(debugEnabled ? MF_CHECKED : 0), ID_ENABLE_DEBUG_LOG, L"Enable Debug Log");
 	::AppendMenu(hmenu, MF_STRING | MF_ENABLED, ID_SHOW_DEBUG_LOGS, L"Show Debug Logs");
+	::AppendMenu(hmenu, MF_STRING | MF_ENABLED | (Trace::enabled() ? MF_CHECKED : 0), ID_TRACE_REQUESTS, L"Trace Requests");
+	::AppendMenu(hmenu, MF_STRING | MF_ENABLED | (recordTraffic_ ? MF_CHECKED : 0), ID_RECORD_TRAFFIC, L"Record IPC Traffic");
 	::AppendMenu(hmenu, MF_SEPARATOR, 0, 0);
 	::AppendMenu(hmenu, MF_STRING | MF_ENABLED, ID_RESTART_PIME_BACKENDS, L"Restart PIME");
 
@@ -34,7 +34,11 @@
 #include <queue>
 #include <deque>
 #include <memory>
+#include <atomic>
+#include <mutex>
 #include "BackendServer.h"
+#include "TraceCollector.h"
+#include "TrafficRecorder.h"
 
 #include <uv.h>
 
@@ -76,6 +80,20 @@ public:
 
 	void removeClient(PipeClient* client);
 
+	// remember the input methods recently used so their backends can preload them
+	void onInputMethodUsed(const std::string& guid);
+
+	// GUIDs of the input methods the backend should load in advance when started
+	std::vector<std::string> preloadInputMethods(BackendServer* backend) const;
+
+	TraceCollector& traceCollector() {
+		return traceCollector_;
+	}
+
+	TrafficRecorder& trafficRecorder() {
+		return trafficRecorder_;
+	}
+
 private:
 	// Windows GUI message loop
 	void runGuiThread();
@@ -90,6 +108,16 @@ private:
 	void finalizeBackendServers();
 	void initInputMethods(const std::wstring& topDirPath);
 	void restartAllBackends();
+	void startPreloadingBackends();
+
+	// request tracing
+	void toggleTrace();
+	void onTraceToggled();
+
+	// recording of the messages exchanged with the backends
+	void toggleTrafficRecording();
+	void onTrafficRecordingToggled();
+	std::wstring logFilePath(const wchar_t* prefix, const wchar_t* extension) const;
 
 	// main pipe server
 	void initDataDir();
@@ -135,6 +163,23 @@ private:
 	spdlog::level::level_enum logLevel_;
 	std::wstring dataDirPath_;
 	std::shared_ptr<spdlog::logger> logger_;
+
+	// input methods to preload when the backends are started.
+	// The list configured in "preloadInputMethods" is used if it exists. Otherwise, the recently
+	// used input methods kept in "recentInputMethods" are preloaded.
+	// The lists are locked by configMutex_ since the config is also saved from the GUI thread.
+	std::vector<std::string> configuredPreloadInputMethods_;
+	std::vector<std::string> recentInputMethods_;
+	mutable std::mutex configMutex_;
+
+	// request tracing, toggled from the GUI thread
+	TraceCollector traceCollector_;
+	uv_async_t traceToggledAsync_;
+
+	// recording of the IPC traffic, toggled from the GUI thread
+	TrafficRecorder trafficRecorder_;
+	std::atomic<bool> recordTraffic_;
+	uv_async_t trafficRecordingToggledAsync_;
 };
 
 } // namespace PIME
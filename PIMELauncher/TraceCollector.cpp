@@ -0,0 +1,219 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#include "TraceCollector.h"
+#include <Windows.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <json/json.h>
+
+using namespace std;
+
+namespace PIME {
+
+// keep at most this number of events to limit memory usage if tracing is left enabled
+static constexpr size_t MAX_TRACE_RECORDS = 1000000;
+
+TraceCollector::TraceCollector() {
+}
+
+void TraceCollector::addRecord(Record&& record) {
+	if (records_.size() < MAX_TRACE_RECORDS && record.end >= record.begin) {
+		records_.push_back(std::move(record));
+	}
+}
+
+uint32_t TraceCollector::processIndex(const std::string& name, uint32_t pid) {
+	for (size_t i = 0; i < processes_.size(); ++i) {
+		if (processes_[i].second == pid && processes_[i].first == name)
+			return static_cast<uint32_t>(i);
+	}
+	processes_.emplace_back(name, pid);
+	return static_cast<uint32_t>(processes_.size() - 1);
+}
+
+uint64_t TraceCollector::clientContext(const std::string& clientId) {
+	auto it = clientContexts_.find(clientId);
+	if (it != clientContexts_.end())
+		return it->second;
+	uint64_t context = clientIds_.size();
+	clientIds_.push_back(clientId);
+	clientContexts_.emplace(clientId, context);
+	return context;
+}
+
+void TraceCollector::addClientEvents(const std::string& pipeId, const char* msg, size_t len) {
+	Json::Value value;
+	Json::Reader reader;
+	if (!reader.parse(msg, msg + len, value) || !value.isObject())
+		return;
+	uint32_t pid = value["pid"].asUInt();
+	uint32_t process = processIndex("PIMETextService", pid);
+	for (const auto& event : value["events"]) {
+		// [threadId, "name", sessionId, seqNum, begin, end]
+		if (!event.isArray() || event.size() != 6 || !event[1].isString())
+			continue;
+		unsigned int sessionId = event[2].asUInt();
+		Record record{
+			event[1].asString(),
+			sessionId == 0 ? pipeId : pipeId + "#" + std::to_string(sessionId),
+			process,
+			pid,
+			event[0].asUInt(),
+			event[3].asUInt(),
+			event[4].asUInt64(),
+			event[5].asUInt64()
+		};
+		addRecord(std::move(record));
+	}
+}
+
+void TraceCollector::addBackendEvents(const std::string& backendName, int pid, const std::string& clientId, const char* json, size_t len) {
+	Json::Value events;
+	Json::Reader reader;
+	if (!reader.parse(json, json + len, events) || !events.isArray())
+		return;
+	uint32_t process = processIndex(backendName, pid);
+	for (const auto& event : events) {
+		// [threadId, "name", seqNum, begin, end]
+		if (!event.isArray() || event.size() != 5 || !event[1].isString())
+			continue;
+		Record record{
+			event[1].asString(),
+			clientId,
+			process,
+			static_cast<uint32_t>(pid),
+			event[0].asUInt(),
+			event[2].asUInt(),
+			event[3].asUInt64(),
+			event[4].asUInt64()
+		};
+		addRecord(std::move(record));
+	}
+}
+
+// write a string as a JSON string, names of the events are sent by other processes
+static void writeJsonString(ofstream& file, const std::string& str) {
+	file << '"';
+	for (char ch : str) {
+		if (ch == '"' || ch == '\\')
+			file << '\\' << ch;
+		else if (static_cast<unsigned char>(ch) >= 0x20)
+			file << ch;
+	}
+	file << '"';
+}
+
+bool TraceCollector::writeFile(const std::wstring& filename) {
+	// events recorded by the launcher itself
+	vector<Trace::Event> events;
+	Trace::Registry::instance().drain(events);
+	uint32_t launcherPid = ::GetCurrentProcessId();
+	uint32_t launcherProcess = processIndex("PIMELauncher", launcherPid);
+	for (const auto& event : events) {
+		if (event.context >= clientIds_.size())
+			continue;
+		addRecord(Record{ event.name, clientIds_[event.context], launcherProcess, launcherPid,
+			event.threadId, event.seqNum, event.begin, event.end });
+	}
+
+	ofstream file(filename, ios::binary | ios::trunc);
+	if (!file) {
+		clear();
+		return false;
+	}
+	file << "{\"traceEvents\":[";
+	bool first = true;
+	// name the processes
+	for (const auto& process : processes_) {
+		if (!first)
+			file << ",\n";
+		first = false;
+		file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << process.second << ",\"args\":{\"name\":";
+		writeJsonString(file, process.first);
+		file << "}}";
+	}
+	for (const auto& record : records_) {
+		if (!first)
+			file << ",\n";
+		first = false;
+		file << "{\"name\":";
+		writeJsonString(file, record.name);
+		file << ",\"cat\":";
+		writeJsonString(file, processes_[record.process].first);
+		file << ",\"ph\":\"X\",\"pid\":" << record.pid
+			<< ",\"tid\":" << record.threadId
+			<< ",\"ts\":" << record.begin
+			<< ",\"dur\":" << (record.end - record.begin)
+			<< ",\"args\":{\"clientId\":";
+		writeJsonString(file, record.clientId);
+		file << ",\"seqNum\":" << record.seqNum << "}}";
+	}
+	file << "]}\n";
+	file.close();
+	clear();
+	return !file.fail();
+}
+
+void TraceCollector::clear() {
+	records_.clear();
+	processes_.clear();
+	clientIds_.clear();
+	clientContexts_.clear();
+	vector<Trace::Event> events;
+	Trace::Registry::instance().drain(events);
+}
+
+// static
+void TraceCollector::appendTraceFlag(std::string& output, const char* json, size_t len) {
+	if (len < 2 || json[0] != '{') {
+		output.append(json, len);
+		return;
+	}
+	output += "{\"trace\":true";
+	// handle the empty object "{}"
+	size_t pos = 1;
+	while (pos < len && (json[pos] == ' ' || json[pos] == '\t' || json[pos] == '\r' || json[pos] == '\n'))
+		++pos;
+	if (pos < len && json[pos] != '}')
+		output += ',';
+	output.append(json + 1, len - 1);
+}
+
+// static
+uint32_t TraceCollector::seqNumOf(const char* json, size_t len) {
+	// requests written by PIME::RequestWriter and replies of the python backend have
+	// "seqNum" among the first few keys.
+	static const char key[] = "\"seqNum\":";
+	constexpr size_t keyLen = sizeof(key) - 1;
+	const size_t searchLen = len < 128 ? len : 128;
+	for (size_t i = 0; i + keyLen <= searchLen; ++i) {
+		if (json[i] == '"' && memcmp(json + i, key, keyLen) == 0) {
+			uint32_t seqNum = 0;
+			for (size_t j = i + keyLen; j < len && json[j] >= '0' && json[j] <= '9'; ++j) {
+				seqNum = seqNum * 10 + (json[j] - '0');
+			}
+			return seqNum;
+		}
+	}
+	return 0;
+}
+
+} // namespace PIME
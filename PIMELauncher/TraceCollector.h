@@ -0,0 +1,87 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#ifndef _PIME_TRACE_COLLECTOR_H_
+#define _PIME_TRACE_COLLECTOR_H_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../PIMETextService/PIMETrace.h"
+
+namespace PIME {
+
+// Collects the trace events of the text services, the launcher, and the backends,
+// and writes them to a file in the Chrome trace event format (chrome://tracing).
+// Events of a request are correlated by the client ID and the sequence number of the request.
+// All methods are called from the libuv loop thread.
+class TraceCollector {
+public:
+	TraceCollector();
+
+	// events of a text service sent in a trace request:
+	// {"method":"trace","pid":<pid>,"events":[[threadId,"name",sessionId,seqNum,begin,end],...]}
+	void addClientEvents(const std::string& pipeId, const char* msg, size_t len);
+
+	// events of a backend sent in a line "PIME_TRACE|<client id>|[[threadId,"name",seqNum,begin,end],...]"
+	void addBackendEvents(const std::string& backendName, int pid, const std::string& clientId, const char* json, size_t len);
+
+	// events recorded by the launcher itself, the context of the events is the index of
+	// the client ID returned by clientContext()
+	uint64_t clientContext(const std::string& clientId);
+
+	// write all collected events to the file, and clear them.
+	bool writeFile(const std::wstring& filename);
+
+	void clear();
+
+	// append a JSON object to the output, adding "trace":true as its first key so the
+	// receiver of the message knows that it should record trace events.
+	static void appendTraceFlag(std::string& output, const char* json, size_t len);
+
+	// find the "seqNum" of a request or a reply without parsing the whole message.
+	// Returns 0 if it's not found near the beginning of the message.
+	static uint32_t seqNumOf(const char* json, size_t len);
+
+private:
+	struct Record {
+		std::string name;
+		std::string clientId;
+		uint32_t process; // index of the process name
+		uint32_t pid;
+		uint32_t threadId;
+		uint32_t seqNum;
+		uint64_t begin;
+		uint64_t end;
+	};
+
+	void addRecord(Record&& record);
+	uint32_t processIndex(const std::string& name, uint32_t pid);
+
+	std::vector<Record> records_;
+	std::vector<std::pair<std::string, uint32_t>> processes_; // name and pid of the traced processes
+	std::vector<std::string> clientIds_; // client IDs of the launcher events
+	std::unordered_map<std::string, uint64_t> clientContexts_;
+};
+
+} // namespace PIME
+
+#endif // _PIME_TRACE_COLLECTOR_H_
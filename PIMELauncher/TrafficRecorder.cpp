@@ -0,0 +1,116 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#include "TrafficRecorder.h"
+#include "../PIMETextService/PIMETrace.h"  // for Trace::now()
+
+using namespace std;
+
+namespace PIME {
+
+static const char CAPTURE_FILE_MAGIC[] = "PIMECAP";
+static constexpr uint8_t CAPTURE_FILE_VERSION = 1;
+
+// write the buffered records to the file when they exceed this size, or once a second
+static constexpr size_t FLUSH_SIZE = 64 * 1024;
+static constexpr uint64_t FLUSH_INTERVAL_US = 1000000;
+
+TrafficRecorder::TrafficRecorder():
+	lastRecordTime_(0),
+	lastFlushTime_(0) {
+}
+
+TrafficRecorder::~TrafficRecorder() {
+	stop();
+}
+
+bool TrafficRecorder::start(const std::wstring& filename) {
+	stop();
+	file_.open(filename, ios::binary | ios::trunc);
+	if (!file_)
+		return false;
+	file_.write(CAPTURE_FILE_MAGIC, sizeof(CAPTURE_FILE_MAGIC) - 1);
+	file_.put(static_cast<char>(CAPTURE_FILE_VERSION));
+	lastRecordTime_ = lastFlushTime_ = Trace::now();
+	return true;
+}
+
+void TrafficRecorder::stop() {
+	if (file_.is_open()) {
+		file_.write(buf_.data(), buf_.size());
+		file_.close();
+	}
+	buf_.clear();
+	sessions_.clear();
+}
+
+void TrafficRecorder::recordRequest(const std::string& backendName, const std::string& clientId, const char* data, size_t len) {
+	writeRecord(REQUEST, sessionIndex(backendName, clientId), data, len);
+}
+
+void TrafficRecorder::recordReply(const std::string& backendName, const std::string& clientId, const char* data, size_t len) {
+	writeRecord(REPLY, sessionIndex(backendName, clientId), data, len);
+}
+
+void TrafficRecorder::recordRestart(const std::string& backendName) {
+	writeRecord(RESTART, 0, backendName.c_str(), backendName.length());
+}
+
+uint32_t TrafficRecorder::sessionIndex(const std::string& backendName, const std::string& clientId) {
+	std::string key = backendName;
+	key += '|';
+	key += clientId;
+	auto it = sessions_.find(key);
+	if (it != sessions_.end())
+		return it->second;
+	uint32_t session = static_cast<uint32_t>(sessions_.size());
+	sessions_.emplace(key, session);
+	writeRecord(SESSION, session, key.c_str(), key.length());
+	return session;
+}
+
+void TrafficRecorder::writeRecord(RecordType type, uint32_t session, const char* data, size_t len) {
+	if (!file_.is_open())
+		return;
+	uint64_t now = Trace::now();
+	buf_ += static_cast<char>(type);
+	appendVarint(now - lastRecordTime_);
+	appendVarint(session);
+	appendVarint(len);
+	buf_.append(data, len);
+	lastRecordTime_ = now;
+
+	if (buf_.size() >= FLUSH_SIZE || now - lastFlushTime_ >= FLUSH_INTERVAL_US) {
+		file_.write(buf_.data(), buf_.size());
+		file_.flush();
+		buf_.clear();
+		lastFlushTime_ = now;
+	}
+}
+
+void TrafficRecorder::appendVarint(uint64_t value) {
+	// LEB128: 7 bits per byte, the highest bit is set if more bytes follow
+	while (value >= 0x80) {
+		buf_ += static_cast<char>((value & 0x7f) | 0x80);
+		value >>= 7;
+	}
+	buf_ += static_cast<char>(value);
+}
+
+} // namespace PIME
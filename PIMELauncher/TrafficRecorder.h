@@ -0,0 +1,84 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#ifndef _PIME_TRAFFIC_RECORDER_H_
+#define _PIME_TRAFFIC_RECORDER_H_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+
+namespace PIME {
+
+// Records the messages exchanged between the clients and the backends to a capture file,
+// which can be replayed against a backend by tests/latency/replay.py.
+//
+// Format of the capture file (all integers are little endian):
+//   header: "PIMECAP" followed by a version byte (1)
+//   records: <type: uint8> <time: varint> <session: varint> <length: varint> <data: length bytes>
+//     time: microseconds elapsed since the previous record
+//     session: index of the session, assigned by the SESSION record
+//   record types:
+//     SESSION: a new session, data is "<backend name>|<client id>"
+//     REQUEST: a request sent to the backend, data is the JSON message
+//     REPLY: a reply received from the backend, data is the JSON message
+//     RESTART: the backend process is (re)started, data is the backend name
+// All methods are called from the libuv loop thread.
+class TrafficRecorder {
+public:
+	enum RecordType : uint8_t {
+		SESSION = 1,
+		REQUEST = 2,
+		REPLY = 3,
+		RESTART = 4
+	};
+
+	TrafficRecorder();
+	~TrafficRecorder();
+
+	bool start(const std::wstring& filename);
+
+	void stop();
+
+	bool isRecording() const {
+		return file_.is_open();
+	}
+
+	void recordRequest(const std::string& backendName, const std::string& clientId, const char* data, size_t len);
+
+	void recordReply(const std::string& backendName, const std::string& clientId, const char* data, size_t len);
+
+	void recordRestart(const std::string& backendName);
+
+private:
+	uint32_t sessionIndex(const std::string& backendName, const std::string& clientId);
+	void writeRecord(RecordType type, uint32_t session, const char* data, size_t len);
+	void appendVarint(uint64_t value);
+
+	std::ofstream file_;
+	std::string buf_; // records not yet written to the file
+	std::unordered_map<std::string, uint32_t> sessions_;
+	uint64_t lastRecordTime_;
+	uint64_t lastFlushTime_;
+};
+
+} // namespace PIME
+
+#endif // _PIME_TRAFFIC_RECORDER_H_
@@ -0,0 +1,87 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#include "PIMECandidatePage.h"
+#include <atomic>
+#include <cstring>
+
+using namespace std;
+
+namespace PIME {
+
+enum HeaderField {
+	FIELD_MAGIC,
+	FIELD_VERSION,
+	FIELD_GENERATION,
+	FIELD_COUNT,
+	FIELD_TEXT_LENGTH
+};
+
+// the section is shared with another process, so every read goes to memory
+static inline uint32_t loadField(const void* section, HeaderField field) {
+	return static_cast<const volatile uint32_t*>(section)[field];
+}
+
+// static
+void CandidatePage::init(void* section) {
+	uint32_t header[HEADER_SIZE / sizeof(uint32_t)] = { MAGIC, VERSION, 0, 0, 0, 0 };
+	memcpy(section, header, sizeof(header));
+}
+
+// static
+bool CandidatePage::read(const void* section, size_t size, uint32_t generation, vector<wstring>& candidates) {
+	if (size < HEADER_SIZE || (generation & 1) != 0)
+		return false;
+	if (loadField(section, FIELD_MAGIC) != MAGIC || loadField(section, FIELD_VERSION) != VERSION)
+		return false;
+	if (loadField(section, FIELD_GENERATION) != generation)
+		return false;
+	atomic_thread_fence(memory_order_acquire);
+
+	size_t count = loadField(section, FIELD_COUNT);
+	size_t textLength = loadField(section, FIELD_TEXT_LENGTH);
+	if (count > (size - HEADER_SIZE) / sizeof(uint32_t)
+		|| textLength > (size - HEADER_SIZE - count * sizeof(uint32_t)) / sizeof(uint16_t))
+		return false;
+
+	// copy the page first, and use it only if the backend did not touch it meanwhile.
+	const char* data = static_cast<const char*>(section) + HEADER_SIZE;
+	vector<uint32_t> ends(count);
+	vector<uint16_t> text(textLength);
+	if (count > 0)
+		memcpy(ends.data(), data, count * sizeof(uint32_t));
+	if (textLength > 0)
+		memcpy(text.data(), data + count * sizeof(uint32_t), textLength * sizeof(uint16_t));
+	atomic_thread_fence(memory_order_acquire);
+	if (loadField(section, FIELD_GENERATION) != generation)
+		return false;
+
+	candidates.resize(count);
+	size_t start = 0;
+	for (size_t i = 0; i < count; ++i) {
+		size_t end = ends[i];
+		if (end < start || end > textLength)
+			return false;
+		candidates[i].assign(text.begin() + start, text.begin() + end);
+		start = end;
+	}
+	return true;
+}
+
+} // namespace PIME
@@ -0,0 +1,60 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#ifndef _PIME_CANDIDATE_PAGE_H_
+#define _PIME_CANDIDATE_PAGE_H_
+
+// Layout of the shared memory section used by the backends to pass the candidate list.
+// This file does not depend on Windows so the reader can be built and tested on other platforms.
+// The same layout is written by python/sharedCandidates.py.
+//
+// All integers are 32-bit little endian.
+//   magic, version, generation, count, textLength, reserved
+//   end offset of each candidate in the text (count integers, in UTF-16 code units)
+//   text of all candidates in UTF-16 (textLength code units)
+//
+// The section is created and initialized by PIME::Client. The backend rewrites it for every new
+// candidate list and sends only the generation in the reply. generation is odd while the
+// backend is writing, so the client can detect a torn page (a seqlock).
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PIME {
+
+class CandidatePage {
+public:
+	static constexpr uint32_t MAGIC = 0x47504350;  // "PCPG"
+	static constexpr uint32_t VERSION = 1;
+	static constexpr size_t HEADER_SIZE = 24;
+	static constexpr size_t SECTION_SIZE = 64 * 1024;
+
+	// write an empty page header to a newly created section
+	static void init(void* section);
+
+	// Read the candidates of the given generation from the section.
+	// Returns false if the page has another generation, is being written, or is malformed.
+	static bool read(const void* section, size_t size, uint32_t generation, std::vector<std::wstring>& candidates);
+};
+
+} // namespace PIME
+
+#endif // _PIME_CANDIDATE_PAGE_H_
@@ -23,6 +23,10 @@
 #include <json/json.h>
 
 #include "PIMETextService.h"
+#include "PIMECandidatePage.h"
+#include "PIMEIconCache.h"
+#include "PIMELauncherConnection.h"
+#include "PIMETrace.h"
 #include <cstdlib>
 #include <ctime>
 #include <memory>
@@ -35,12 +39,19 @@ using namespace std;
 
 namespace PIME {
 
-unordered_map<UINT_PTR, Client*> Client::timerIdToClients_;
-
 Client::Client(TextService* service, REFIID langProfileGuid):
 	textService_(service),
-	pipe_(INVALID_HANDLE_VALUE),
+	sessionId_(LauncherConnection::instance().newSessionId()),
+	connectionGeneration_(0),
 	newSeqNum_(0),
+	pendingSeqNum_(0),
+	requestBeginTime_(0),
+	traceFlushNeeded_(false),
+	candidatePage_(0),
+	candidateSection_(NULL),
+	candidateView_(nullptr),
+	localEcho_(false),
+	localEchoChar_(0),
 	isActivated_(false),
 	connectingServerPipe_(false) {
 
@@ -53,7 +64,8 @@ Client::Client(TextService* service, REFIID langProfileGuid):
 }
 
 Client::~Client(void) {
-	closePipe();
+	// close our session, but keep the connection for other clients in the process.
+	LauncherConnection::instance().closeSession(connectionGeneration_, sessionId_);
 
 	// some language bar buttons are not unregistered properly
 	if (!buttons_.empty()) {
@@ -61,33 +73,90 @@ Client::~Client(void) {
 			textService_->removeButton(item.second);
 		}
 	}
-	LangBarButton::clearIconCache();
+
+	closeCandidateSection();
+}
+
+// create a shared memory section which the server can use to pass the candidate list without JSON.
+void Client::createCandidateSection() {
+	if (candidateView_ != nullptr)
+		return;
+	// objects created by metro apps live in the namespace of their app container, which the server cannot open.
+	if (textService_->isMetroApp())
+		return;
+	wchar_t name[64];
+	swprintf_s(name, L"PIME-Candidates-%u-%u", ::GetCurrentProcessId(), sessionId_);
+	candidateSection_ = ::CreateFileMappingW(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+		0, static_cast<DWORD>(CandidatePage::SECTION_SIZE), name);
+	if (candidateSection_ == NULL)
+		return;
+	candidateView_ = ::MapViewOfFile(candidateSection_, FILE_MAP_ALL_ACCESS, 0, 0, CandidatePage::SECTION_SIZE);
+	if (candidateView_ == nullptr) {
+		closeCandidateSection();
+		return;
+	}
+	CandidatePage::init(candidateView_);
+	candidateSectionName_ = utf16ToUtf8(name);
 }
 
-// pack a keyEvent object into a json value
-//static
-void Client::keyEventToJson(Ime::KeyEvent& keyEvent, Json::Value& jsonValue) {
-	jsonValue["charCode"] = keyEvent.charCode();
-	jsonValue["keyCode"] = keyEvent.keyCode();
-	jsonValue["repeatCount"] = keyEvent.repeatCount();
-	jsonValue["scanCode"] = keyEvent.scanCode();
-	jsonValue["isExtended"] = keyEvent.isExtended();
-	Json::Value keyStates(Json::arrayValue);
-	const BYTE* states = keyEvent.keyStates();
-	for(int i = 0; i < 256; ++i) {
-		keyStates.append(states[i]);
+void Client::closeCandidateSection() {
+	if (candidateView_ != nullptr) {
+		::UnmapViewOfFile(candidateView_);
+		candidateView_ = nullptr;
+	}
+	if (candidateSection_ != NULL) {
+		::CloseHandle(candidateSection_);
+		candidateSection_ = NULL;
 	}
-	jsonValue["keyStates"] = keyStates;
+	candidateSectionName_.clear();
 }
 
-bool Client::handleReply(Json::Value& msg, Ime::EditSession* session) {
-	bool success = msg.get("success", false).asBool();
+// write the fields of a keyEvent object to the request
+void Client::writeKeyEvent(Ime::KeyEvent& keyEvent, RequestWriter& req) {
+	req.add("charCode", static_cast<unsigned int>(keyEvent.charCode()));
+	req.add("keyCode", static_cast<unsigned int>(keyEvent.keyCode()));
+	req.add("repeatCount", static_cast<unsigned int>(keyEvent.repeatCount()));
+	req.add("scanCode", static_cast<unsigned int>(keyEvent.scanCode()));
+	req.add("isExtended", keyEvent.isExtended());
+	req.addByteArray("keyStates", keyEvent.keyStates(), 256);
+}
+
+bool Client::handleReply(Reply& msg, Ime::EditSession* session) {
+	bool success = msg.success;
+	// the server tells us after every request whether the next key can be echoed locally
+	localEcho_ = success && msg.has(Reply::LOCAL_ECHO) && msg.localEcho;
 	if (success) {
+		Trace::Scope scope("client.updateStatus", sessionId_, msg.seqNum);
 		updateStatus(msg, session);
 	}
+	flushTrace();
 	return success;
 }
 
+// send the trace events recorded in this process to the launcher.
+// this is only done when tracing is enabled, after the traced request is finished.
+void Client::flushTrace() {
+	if (!traceFlushNeeded_)
+		return;
+	traceFlushNeeded_ = false;
+	std::vector<Trace::Event> events;
+	if (Trace::Registry::instance().drain(events) == 0 || connectionGeneration_ == 0)
+		return;
+	std::string request = "{\"method\":\"trace\",\"pid\":";
+	request += std::to_string(::GetCurrentProcessId());
+	request += ",\"events\":";
+	Trace::appendJson(request, events);
+	request += '}';
+	std::string reply;
+	LauncherConnection::instance().transact(connectionGeneration_, sessionId_, request, reply);
+}
+
+// parse the raw JSON text of a reply field which is not decoded by PIME::Reply
+static bool parseJsonField(const StringRef& text, Json::Value& value) {
+	Json::Reader reader;
+	return reader.parse(text.data, text.data + text.length, value, false);
+}
+
 void Client::updateUI(const Json::Value& data) {
 	for (auto it = data.begin(); it != data.end(); ++it) {
 		const char* name = it.memberName();
@@ -108,38 +177,53 @@ void Client::updateUI(const Json::Value& data) {
 	}
 }
 
-void Client::updateStatus(Json::Value& msg, Ime::EditSession* session) {
+// whether the key only appends its key name to the composition string, as the server told us.
+bool Client::canEchoLocally(Ime::KeyEvent& keyEvent) {
+	if (!localEcho_ || localEchoKeys_.empty() || connectionGeneration_ == 0)
+		return false;
+	// keys with modifiers or caps lock may have special meanings, always ask the server.
+	if (keyEvent.isKeyDown(VK_SHIFT) || keyEvent.isKeyDown(VK_CONTROL) || keyEvent.isKeyDown(VK_MENU)
+		|| keyEvent.isKeyToggled(VK_CAPITAL))
+		return false;
+	return localEchoKeys_.find(towlower(keyEvent.charCode())) != localEchoKeys_.end();
+}
+
+void Client::updateLocalEchoKeys(const Json::Value& keys) {
+	localEchoKeys_.clear();
+	for (auto it = keys.begin(); it != keys.end(); ++it) {
+		std::wstring key = utf8ToUtf16(it.memberName());
+		if (key.length() == 1 && it->isString()) {
+			localEchoKeys_[key[0]] = utf8ToUtf16(it->asCString());
+		}
+	}
+}
+
+void Client::updateStatus(Reply& msg, Ime::EditSession* session) {
 	// We need to handle ordering of some types of the requests.
 	// For example, setCompositionCursor() should happen after setCompositionCursor().
 
 	// set sel keys before update candidates
-	const auto& setSelKeysVal = msg["setSelKeys"];
-	if (setSelKeysVal.isString()) {
+	if (msg.has(Reply::SET_SEL_KEYS)) {
 		// keys used to select candidates
-		std::wstring selKeys = utf8ToUtf16(setSelKeysVal.asCString());
+		std::wstring selKeys = utf8ToUtf16(msg.selKeys.data);
 		textService_->setSelKeys(selKeys);
 	}
 
 	// show message
     bool endComposition = false;
-	const auto& showMessageVal = msg["showMessage"];
-	if (showMessageVal.isObject()) {
-		const Json::Value& message = showMessageVal["message"];
-		const Json::Value& duration = showMessageVal["duration"];
-		if (message.isString() && duration.isInt()) {
-			if (!textService_->isComposing()) {
-				textService_->startComposition(session->context());
-                endComposition = true;
-			}
-			textService_->showMessage(session, utf8ToUtf16(message.asCString()), duration.asInt());
+	if (msg.has(Reply::SHOW_MESSAGE)) {
+		if (!textService_->isComposing()) {
+			textService_->startComposition(session->context());
+            endComposition = true;
 		}
+		textService_->showMessage(session, utf8ToUtf16(msg.message.data), msg.messageDuration);
 	}
 
 	if (session != nullptr) { // if an edit session is available
 		// handle candidate list
-		const auto& showCandidatesVal = msg["showCandidates"];
-		if (showCandidatesVal.isBool()) {
-			if (showCandidatesVal.asBool()) {
+		bool wasShowingCandidates = textService_->showingCandidates();
+		if (msg.has(Reply::SHOW_CANDIDATES)) {
+			if (msg.showCandidates) {
 				// start composition if we are not composing.
 				// this is required to get correctly position the candidate window
 				if (!textService_->isComposing()) {
@@ -152,34 +236,33 @@ void Client::updateStatus(Json::Value& msg, Ime::EditSession* session) {
 			}
 		}
 
-		const auto& candidateListVal = msg["candidateList"];
-		if (candidateListVal.isArray()) {
+		if (msg.has(Reply::CANDIDATE_LIST) || msg.has(Reply::CANDIDATE_CHANGES) || msg.has(Reply::CANDIDATE_COUNT)
+			|| msg.has(Reply::CANDIDATE_GENERATION)) {
 			// handle candidates
-			// FIXME: directly access private member is dirty!!!
-			vector<wstring>& candidates = textService_->candidates_;
-			candidates.clear();
-			for (auto cand_it = candidateListVal.begin(); cand_it != candidateListVal.end(); ++cand_it) {
-				wstring cand = utf8ToUtf16(cand_it->asCString());
-				candidates.push_back(cand);
+			// the candidate window is rebuilt only if the content is really changed.
+			if (updateCandidateList(msg) || !wasShowingCandidates) {
+				textService_->updateCandidates(session);
 			}
-			textService_->updateCandidates(session);
-			if (!showCandidatesVal.asBool()) {
+			if (!msg.showCandidates) {
 				textService_->hideCandidates();
 			}
 		}
+		else if (msg.showCandidates && !wasShowingCandidates) {
+			// the server omits the candidate list if it's not changed,
+			// but the newly shown candidate window still needs to be filled.
+			textService_->updateCandidates(session);
+		}
 
-		const auto& candidateCursorVal = msg["candidateCursor"];
-		if (candidateCursorVal.isInt()) {
+		if (msg.has(Reply::CANDIDATE_CURSOR)) {
 			if (textService_->candidateWindow_ != nullptr) {
-				textService_->candidateWindow_->setCurrentSel(candidateCursorVal.asInt());
+				textService_->candidateWindow_->setCurrentSel(msg.candidateCursor);
 				textService_->refreshCandidates();
 			}
 		}
 
 		// handle comosition and commit strings
-		const auto& commitStringVal = msg["commitString"];
-		if (commitStringVal.isString()) {
-			std::wstring commitString = utf8ToUtf16(commitStringVal.asCString());
+		if (msg.has(Reply::COMMIT_STRING)) {
+			std::wstring commitString = utf8ToUtf16(msg.commitString.data);
 			if (!commitString.empty()) {
 				if (!textService_->isComposing()) {
 					textService_->startComposition(session->context());
@@ -196,13 +279,12 @@ void Client::updateStatus(Json::Value& msg, Ime::EditSession* session) {
 			}
 		}
 
-		const auto& compositionStringVal = msg["compositionString"];
 		bool emptyComposition = false;
 		bool hasCompositionString = false;
 		std::wstring compositionString;
-		if (compositionStringVal.isString()) {
+		if (msg.has(Reply::COMPOSITION_STRING)) {
 			// composition buffer
-			compositionString = utf8ToUtf16(compositionStringVal.asCString());
+			compositionString = utf8ToUtf16(msg.compositionString.data);
 			hasCompositionString = true;
 			if (compositionString.empty()) {
 				emptyComposition = true;
@@ -227,11 +309,10 @@ void Client::updateStatus(Json::Value& msg, Ime::EditSession* session) {
             }
 		}
 
-		const auto& compositionCursorVal = msg["compositionCursor"];
-		if (compositionCursorVal.isInt()) {
+		if (msg.has(Reply::COMPOSITION_CURSOR)) {
 			// composition cursor
 			if (!emptyComposition) {
-				int compositionCursor = compositionCursorVal.asInt();
+				int compositionCursor = msg.compositionCursor;
 				if (!textService_->isComposing()) {
 					textService_->startComposition(session->context());
 				}
@@ -259,8 +340,15 @@ void Client::updateStatus(Json::Value& msg, Ime::EditSession* session) {
 	}
 
 	// language buttons
-	const auto& addButtonVal = msg["addButton"];
-	if (addButtonVal.isArray()) {
+	Json::Value addButtonVal;
+	if (msg.has(Reply::ADD_BUTTON) && parseJsonField(msg.addButton, addButtonVal)) {
+		// other icons used by the buttons later are usually in the same directories, load them in background.
+		for (const auto& btn : addButtonVal) {
+			const Json::Value& iconValue = btn["icon"];
+			if (iconValue.isString()) {
+				IconCache::instance().preloadDirectory(utf8ToUtf16(iconValue.asCString()));
+			}
+		}
 		for (auto btn_it = addButtonVal.begin(); btn_it != addButtonVal.end(); ++btn_it) {
 			const Json::Value& btn = *btn_it;
 			// FIXME: when to clear the id <=> button map??
@@ -272,8 +360,8 @@ void Client::updateStatus(Json::Value& msg, Ime::EditSession* session) {
 		}
 	}
 
-	const auto& removeButtonVal = msg["removeButton"];
-	if (removeButtonVal.isArray()) {
+	Json::Value removeButtonVal;
+	if (msg.has(Reply::REMOVE_BUTTON) && parseJsonField(msg.removeButton, removeButtonVal)) {
 		// FIXME: handle windows-mode-icon
 		for (auto btn_it = removeButtonVal.begin(); btn_it != removeButtonVal.end(); ++btn_it) {
 			if (btn_it->isString()) {
@@ -286,8 +374,8 @@ void Client::updateStatus(Json::Value& msg, Ime::EditSession* session) {
 			}
 		}
 	}
-	const auto& changeButtonVal = msg["changeButton"];
-	if (changeButtonVal.isArray()) {
+	Json::Value changeButtonVal;
+	if (msg.has(Reply::CHANGE_BUTTON) && parseJsonField(msg.changeButton, changeButtonVal)) {
 		// FIXME: handle windows-mode-icon
 		for (auto btn_it = changeButtonVal.begin(); btn_it != changeButtonVal.end(); ++btn_it) {
 			const Json::Value& btn = *btn_it;
@@ -302,8 +390,8 @@ void Client::updateStatus(Json::Value& msg, Ime::EditSession* session) {
 	}
 
 	// preserved keys
-	const auto& addPreservedKeyVal = msg["addPreservedKey"];
-	if (addPreservedKeyVal.isArray()) {
+	Json::Value addPreservedKeyVal;
+	if (msg.has(Reply::ADD_PRESERVED_KEY) && parseJsonField(msg.addPreservedKey, addPreservedKeyVal)) {
 		// preserved keys
 		for (auto key_it = addPreservedKeyVal.begin(); key_it != addPreservedKeyVal.end(); ++key_it) {
 			const Json::Value& key = *key_it;
@@ -318,8 +406,8 @@ void Client::updateStatus(Json::Value& msg, Ime::EditSession* session) {
 		}
 	}
 	
-	const auto& removePreservedKeyVal = msg["removePreservedKey"];
-	if (removePreservedKeyVal.isArray()) {
+	Json::Value removePreservedKeyVal;
+	if (msg.has(Reply::REMOVE_PRESERVED_KEY) && parseJsonField(msg.removePreservedKey, removePreservedKeyVal)) {
 		for (auto key_it = removePreservedKeyVal.begin(); key_it != removePreservedKeyVal.end(); ++key_it) {
 			if (key_it->isString()) {
 				std::wstring guidStr = utf8ToUtf16(key_it->asCString());
@@ -331,98 +419,177 @@ void Client::updateStatus(Json::Value& msg, Ime::EditSession* session) {
 	}
 
 	// keyboard status
-	const auto& openKeyboardVal = msg["openKeyboard"];
-	if (openKeyboardVal.isBool()) {
-		textService_->setKeyboardOpen(openKeyboardVal.asBool());
+	if (msg.has(Reply::OPEN_KEYBOARD)) {
+		textService_->setKeyboardOpen(msg.openKeyboard);
+	}
+
+	// keys which the client may handle without asking the server first
+	Json::Value localEchoKeysVal;
+	if (msg.has(Reply::LOCAL_ECHO_KEYS) && parseJsonField(msg.localEchoKeys, localEchoKeysVal)) {
+		updateLocalEchoKeys(localEchoKeysVal);
 	}
 
 	// other configurations
-	const auto& customizeUIVal = msg["customizeUI"];
-	if (customizeUIVal.isObject()) {
+	Json::Value customizeUIVal;
+	if (msg.has(Reply::CUSTOMIZE_UI) && parseJsonField(msg.customizeUI, customizeUIVal)) {
 		// customize the UI
 		updateUI(customizeUIVal);
 	}
 
 	// hide message
-    const auto& hideMessageVal = msg["hideMessage"];
-	if (hideMessageVal.isBool()) {
+	if (msg.has(Reply::HIDE_MESSAGE)) {
         textService_->hideMessage();
 	}
 }
 
+// apply the full candidate list or the changes to the candidate list sent by the server.
+// returns true if the content of the candidate list is changed.
+bool Client::updateCandidateList(Reply& msg) {
+	// FIXME: directly access private member is dirty!!!
+	vector<wstring>& candidates = textService_->candidates_;
+	bool changed = false;
+	if (msg.has(Reply::CANDIDATE_GENERATION)) {
+		// the candidate list is in the shared memory section
+		vector<wstring> page;
+		if (candidateView_ == nullptr || !CandidatePage::read(candidateView_, CandidatePage::SECTION_SIZE, msg.candidateGeneration, page)) {
+			// ask the server to send the whole list next time.
+			candidatePage_ = 0;
+			return false;
+		}
+		if (page != candidates) {
+			candidates.swap(page);
+			changed = true;
+		}
+	}
+	else if (msg.has(Reply::CANDIDATE_LIST)) {
+		// full candidate list
+		if (candidates.size() != msg.candidateList.size()) {
+			candidates.resize(msg.candidateList.size());
+			changed = true;
+		}
+		for (size_t i = 0; i < msg.candidateList.size(); ++i) {
+			wstring cand = utf8ToUtf16(msg.candidateList[i].data);
+			if (cand != candidates[i]) {
+				candidates[i].swap(cand);
+				changed = true;
+			}
+		}
+	}
+	else {
+		// only the changed ranges of the list is sent
+		size_t count = msg.has(Reply::CANDIDATE_COUNT) ? msg.candidateCount : candidates.size();
+		for (const auto& range : msg.candidateRanges) {
+			if (size_t(range.start) + range.count > count) {
+				// invalid changes, ask the server to resend the whole list next time.
+				candidatePage_ = 0;
+				return false;
+			}
+		}
+		if (candidates.size() != count) {
+			candidates.resize(count);
+			changed = true;
+		}
+		for (const auto& range : msg.candidateRanges) {
+			for (size_t i = 0; i < range.count; ++i) {
+				candidates[range.start + i] = utf8ToUtf16(msg.candidateChanges[range.first + i].data);
+			}
+			changed = true;
+		}
+	}
+	// backends not supporting delta updates do not send the page id
+	candidatePage_ = msg.has(Reply::CANDIDATE_PAGE) ? msg.candidatePage : 0;
+	return changed;
+}
+
 // handlers for the text service
 void Client::onActivate() {
-	Json::Value req;
-	req["method"] = "onActivate";
-	req["isKeyboardOpen"] = textService_->isKeyboardOpened();
+	auto& req = beginRequest("onActivate");
+	req.add("isKeyboardOpen", textService_->isKeyboardOpened());
 
-	Json::Value ret;
-	sendRequest(req, ret);
+	Reply ret;
+	sendRequest(ret);
 	if (handleReply(ret)) {
 	}
 	isActivated_ = true;
 }
 
 void Client::onDeactivate() {
-	Json::Value req;
-	req["method"] = "onDeactivate";
+	beginRequest("onDeactivate");
 
-	Json::Value ret;
-	sendRequest(req, ret);
+	Reply ret;
+	sendRequest(ret);
 	if (handleReply(ret)) {
 	}
-	LangBarButton::clearIconCache();
 	isActivated_ = false;
 }
 
 bool Client::filterKeyDown(Ime::KeyEvent& keyEvent) {
-	Json::Value req;
-	req["method"] = "filterKeyDown";
-	keyEventToJson(keyEvent, req);
+	// The server already told us this key only appends its key name to the composition string.
+	// Save the round trip of filterKeyDown, the server filters the key when handling onKeyDown.
+	localEchoChar_ = canEchoLocally(keyEvent) ? keyEvent.charCode() : 0;
+	if (localEchoChar_ != 0)
+		return true;
+
+	auto& req = beginRequest("filterKeyDown");
+	writeKeyEvent(keyEvent, req);
 
-	Json::Value ret;
-	sendRequest(req, ret);
+	Reply ret;
+	sendRequest(ret);
 	if (handleReply(ret)) {
-		return ret["return"].asBool();
+		return ret.returnValue;
 	}
 	return false;
 }
 
 bool Client::onKeyDown(Ime::KeyEvent& keyEvent, Ime::EditSession* session) {
-	Json::Value req;
-	req["method"] = "onKeyDown";
-	keyEventToJson(keyEvent, req);
-
-	Json::Value ret;
-	sendRequest(req, ret);
+	bool localEcho = (localEchoChar_ != 0 && localEchoChar_ == keyEvent.charCode());
+	localEchoChar_ = 0;
+	std::wstring predicted;
+	if (localEcho) {
+		// the composition string we expect to get from the server
+		if (textService_->isComposing())
+			predicted = textService_->compositionString(session);
+		predicted += localEchoKeys_[towlower(keyEvent.charCode())];
+	}
+
+	auto& req = beginRequest("onKeyDown");
+	writeKeyEvent(keyEvent, req);
+	if (localEcho)
+		req.add("localEcho", true);  // ask the server to run filterKeyDown first
+
+	Reply ret;
+	sendRequest(ret);
 	if (handleReply(ret, session)) {
-		return ret["return"].asBool();
+		if (localEcho && (!ret.has(Reply::COMPOSITION_STRING) || utf8ToUtf16(ret.compositionString.data) != predicted)) {
+			// The reply of the server always wins. Our guess was wrong, so stop guessing
+			// until the server publishes its keys again.
+			localEchoKeys_.clear();
+		}
+		return ret.returnValue;
 	}
 	return false;
 }
 
 bool Client::filterKeyUp(Ime::KeyEvent& keyEvent) {
-	Json::Value req;
-	req["method"] = "filterKeyUp";
-	keyEventToJson(keyEvent, req);
+	auto& req = beginRequest("filterKeyUp");
+	writeKeyEvent(keyEvent, req);
 
-	Json::Value ret;
-	sendRequest(req, ret);
+	Reply ret;
+	sendRequest(ret);
 	if (handleReply(ret)) {
-		return ret["return"].asBool();
+		return ret.returnValue;
 	}
 	return false;
 }
 
 bool Client::onKeyUp(Ime::KeyEvent& keyEvent, Ime::EditSession* session) {
-	Json::Value req;
-	req["method"] = "onKeyUp";
-	keyEventToJson(keyEvent, req);
+	auto& req = beginRequest("onKeyUp");
+	writeKeyEvent(keyEvent, req);
 
-	Json::Value ret;
-	sendRequest(req, ret);
+	Reply ret;
+	sendRequest(ret);
 	if (handleReply(ret, session)) {
-		return ret["return"].asBool();
+		return ret.returnValue;
 	}
 	return false;
 }
@@ -430,41 +597,43 @@ bool Client::onKeyUp(Ime::KeyEvent& keyEvent, Ime::EditSession* session) {
 bool Client::onPreservedKey(const GUID& guid) {
 	LPOLESTR str = NULL;
 	if (SUCCEEDED(::StringFromCLSID(guid, &str))) {
-		Json::Value req;
-		req["method"] = "onPreservedKey";
-		req["guid"] = utf16ToUtf8(str);
+		auto& req = beginRequest("onPreservedKey");
+		req.add("guid", utf16ToUtf8(str));
 		::CoTaskMemFree(str);
 
-		Json::Value ret;
-		sendRequest(req, ret);
+		Reply ret;
+		sendRequest(ret);
 		if (handleReply(ret)) {
-			return ret["return"].asBool();
+			return ret.returnValue;
 		}
 	}
 	return false;
 }
 
 bool Client::onCommand(UINT id, Ime::TextService::CommandType type) {
-	Json::Value req;
-	req["method"] = "onCommand";
-	req["id"] = id;
-	req["type"] = type;
+	auto& req = beginRequest("onCommand");
+	req.add("id", id);
+	req.add("type", static_cast<int>(type));
 
-	Json::Value ret;
-	sendRequest(req, ret);
+	Reply ret;
+	sendRequest(ret);
 	if (handleReply(ret)) {
-		return ret["return"].asBool();
+		return ret.returnValue;
 	}
 	return false;
 }
 
 bool Client::sendOnMenu(std::string button_id, Json::Value& result) {
-	Json::Value req;
-	req["method"] = "onMenu";
-	req["id"] = button_id;
+	auto& req = beginRequest("onMenu");
+	req.add("id", button_id);
 
-	sendRequest(req, result);
-	if (handleReply(result)) {
+	Reply ret;
+	sendRequest(ret);
+	if (handleReply(ret)) {
+		// menus are only requested on user clicks, so the slower jsoncpp is fine here
+		if (ret.has(Reply::RETURN)) {
+			parseJsonField(ret.returnJson, result);
+		}
 		return true;
 	}
 	return false;
@@ -506,9 +675,8 @@ static bool menuFromJson(ITfMenu* pMenu, const Json::Value& menuInfo) {
 // called when a language bar button needs a menu
 // virtual
 bool Client::onMenu(LangBarButton* btn, ITfMenu* pMenu) {
-	Json::Value result;
-	if(sendOnMenu(btn->id(), result)) {
-		Json::Value& menuInfo = result["return"];
+	Json::Value menuInfo;
+	if(sendOnMenu(btn->id(), menuInfo)) {
 		return menuFromJson(pMenu, menuInfo);
 	}
 	return false;
@@ -548,9 +716,8 @@ static HMENU menuFromJson(const Json::Value& menuInfo) {
 // called when a language bar button needs a menu
 // virtual
 HMENU Client::onMenu(LangBarButton* btn) {
-	Json::Value result;
-	if (sendOnMenu(btn->id(), result)) {
-		Json::Value& menuInfo = result["return"];
+	Json::Value menuInfo;
+	if (sendOnMenu(btn->id(), menuInfo)) {
 		return menuFromJson(menuInfo);
 	}
 	return NULL;
@@ -560,13 +727,12 @@ HMENU Client::onMenu(LangBarButton* btn) {
 void Client::onCompartmentChanged(const GUID& key) {
 	LPOLESTR str = NULL;
 	if (SUCCEEDED(::StringFromCLSID(key, &str))) {
-		Json::Value req;
-		req["method"] = "onCompartmentChanged";
-		req["guid"] = utf16ToUtf8(str);
+		auto& req = beginRequest("onCompartmentChanged");
+		req.add("guid", utf16ToUtf8(str));
 		::CoTaskMemFree(str);
 
-		Json::Value ret;
-		sendRequest(req, ret);
+		Reply ret;
+		sendRequest(ret);
 		if (handleReply(ret)) {
 		}
 	}
@@ -574,108 +740,102 @@ void Client::onCompartmentChanged(const GUID& key) {
 
 // called when the keyboard is opened or closed
 void Client::onKeyboardStatusChanged(bool opened) {
-	Json::Value req;
-	req["method"] = "onKeyboardStatusChanged";
-	req["opened"] = opened;
+	auto& req = beginRequest("onKeyboardStatusChanged");
+	req.add("opened", opened);
 
-	Json::Value ret;
-	sendRequest(req, ret);
+	Reply ret;
+	sendRequest(ret);
 	if (handleReply(ret)) {
 	}
 }
 
 // called just before current composition is terminated for doing cleanup.
 void Client::onCompositionTerminated(bool forced) {
-	Json::Value req;
-	req["method"] = "onCompositionTerminated";
-	req["forced"] = forced;
+	auto& req = beginRequest("onCompositionTerminated");
+	req.add("forced", forced);
 
-	Json::Value ret;
-	sendRequest(req, ret);
+	Reply ret;
+	sendRequest(ret);
 	if (handleReply(ret)) {
 	}
 }
 
 void Client::init() {
-	Json::Value req;
-	req["method"] = "init";
-	req["id"] = guid_.c_str();  // language profile guid
-	req["isWindows8Above"] = textService_->imeModule()->isWindows8Above();
-	req["isMetroApp"] = textService_->isMetroApp();
-	req["isUiLess"] = textService_->isUiLess();
-	req["isConsole"] = textService_->isConsole();
-
-	Json::Value ret;
-	sendRequest(req, ret);
+	candidatePage_ = 0; // the server does not know our candidate list after reconnection
+	localEchoKeys_.clear(); // the server publishes its keys again in onActivate
+	localEcho_ = false;
+	auto& req = beginRequest("init");
+	req.add("id", guid_);  // language profile guid
+	req.add("isWindows8Above", textService_->imeModule()->isWindows8Above());
+	req.add("isMetroApp", textService_->isMetroApp());
+	req.add("isUiLess", textService_->isUiLess());
+	req.add("isConsole", textService_->isConsole());
+	createCandidateSection();
+	if (!candidateSectionName_.empty()) {
+		req.add("candidateSection", candidateSectionName_);
+	}
+
+	Reply ret;
+	sendRequest(ret);
 	if (handleReply(ret)) {
 	}
 }
 
-bool Client::sendRequestText(HANDLE pipe, const char* data, int len, std::string& reply) {
-	char buf[1024];
-	DWORD rlen = 0;
-	if (TransactNamedPipe(pipe, (void*)data, len, buf, sizeof(buf) - 1, &rlen, NULL)) {
-		buf[rlen] = '\0';
-		reply = buf;
-	}
-	else { // error!
-		if (GetLastError() != ERROR_MORE_DATA) { // unknown error happens
-			return false;
-		}
-		// still has more data to read
-		buf[rlen] = '\0';
-		reply = buf;
-		for (;;) {
-			BOOL success = ReadFile(pipe, buf, sizeof(buf) - 1, &rlen, NULL);
-			if (!success && (GetLastError() != ERROR_MORE_DATA)) {
-				// unknown error happens, reset the pipe?
-				return false; // error reading the pipe
-			}
-			buf[rlen] = '\0';
-			reply += buf;
-			if (success)
-				break;
-		}
-	}
-	return true;
+// start writing a new request
+// a sequence number will be added to the request automatically.
+RequestWriter& Client::beginRequest(const char* method) {
+	pendingSeqNum_ = newSeqNum_++;
+	requestBeginTime_ = Trace::enabled() ? Trace::now() : 0;
+	requestWriter_.begin(method, pendingSeqNum_);
+	if (candidatePage_ != 0) {
+		// let the server know which candidate list we have so it can send only the changes
+		requestWriter_.add("candidatePage", candidatePage_);
+	}
+	return requestWriter_;
 }
 
-// send the request to the server
-// a sequence number will be added to the req object automatically.
-bool Client::sendRequest(Json::Value& req, Json::Value & result) {
+// send the request started with beginRequest() to the server
+bool Client::sendRequest(Reply& result) {
 	bool success = false;
-	unsigned int seqNum = newSeqNum_++;
-	req["seqNum"] = seqNum; // add a sequence number for the request
-	std::string ret;
-	DWORD rlen = 0;
-	Json::FastWriter writer;
-	std::string reqStr = writer.write(req); // convert the json object to string
+	unsigned int seqNum = pendingSeqNum_;
+	const std::string* reqStr = &requestWriter_.end();
+	std::string pendingReqStr;
+	if (Trace::enabled())
+		traceFlushNeeded_ = true;
+	if (requestBeginTime_ != 0) {
+		Trace::record("client.serialize", sessionId_, seqNum, requestBeginTime_, Trace::now());
+		requestBeginTime_ = 0;
+	}
 
 	if (!connectingServerPipe_) {  // if we're not in the middle of initializing the pipe connection
 		// ensure that we're connected
-		if (!connectServerPipe()) {
-			// connection failed, schedule a timer to try again every 0.5 seconds
-			if (connectServerTimerId_ != 0) { // do not create a new timer if there is an existing one.
-				connectServerTimerId_ = SetTimer(NULL, 0, 500, [](HWND hwnd, UINT msg, UINT_PTR timerId, DWORD time) {
-					auto client = timerIdToClients_[timerId];
-					if (client->connectServerPipe()) {
-						// successfully connected, cancel the timer
-						KillTimer(NULL, timerId);
-						timerIdToClients_.erase(timerId);
-						client->connectServerTimerId_ = 0;
-					}
-				});
-				timerIdToClients_[connectServerTimerId_] = this;
-			}
+		// The shared connection might be re-established by clients in other threads at any time.
+		// Initializing our session sends requests using the same request buffer, so our request
+		// is saved to pendingReqStr first in that case.
+		if (!connectServerPipe(&pendingReqStr)) {
+			// We're not connected yet and the connection is being established in background.
+			// Fail the request so the key is passed to the application instead of blocking it.
+			// Our session will be initialized again in the next request after being connected.
 			return false;
 		}
+		if (!pendingReqStr.empty())
+			reqStr = &pendingReqStr;
 	}
 
-	if (sendRequestText(pipe_, reqStr.c_str(), reqStr.length(), ret)) {
-		Json::Reader reader;
-		success = reader.parse(ret, result);
+	bool transacted;
+	{
+		Trace::Scope scope("client.transact", sessionId_, seqNum);
+		transacted = LauncherConnection::instance().transact(connectionGeneration_, sessionId_, *reqStr, result.text());
+	}
+	if (transacted) {
+		{
+			Trace::Scope scope("client.parse", sessionId_, seqNum);
+			success = result.parse();
+		}
 		if (success) {
-			if (result["seqNum"].asUInt() != seqNum) // sequence number mismatch
+			// the launcher tells us whether request tracing is enabled in every reply
+			Trace::setEnabled(result.has(Reply::TRACE) && result.trace);
+			if (result.seqNum != seqNum) // sequence number mismatch
 				success = false;
 		}
 	}
@@ -690,118 +850,48 @@ bool Client::sendRequest(Json::Value& req, Json::Value & result) {
 	return success;
 }
 
-// establish a connection to the specified pipe and returns its handle
-// static
-HANDLE Client::connectPipe(const wchar_t* pipeName) {
-	bool hasErrors = false;
-	HANDLE pipe = INVALID_HANDLE_VALUE;
-	for (;;) {
-		pipe = CreateFile(pipeName, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, 0, NULL);
-		if (pipe != INVALID_HANDLE_VALUE) {
-			// the pipe is successfully created
-			// security check: make sure that we're connecting to the correct server
-			ULONG serverPid;
-			if (GetNamedPipeServerProcessId(pipe, &serverPid)) {
-				// FIXME: check the command line of the server?
-				// See this: http://www.codeproject.com/Articles/19685/Get-Process-Info-with-NtQueryInformationProcess
-				// Too bad! Undocumented Windows internal API might be needed here. :-(
-			}
-			break;
-		}
-		// being busy is not really an error since we just need to wait.
-		if (GetLastError() != ERROR_PIPE_BUSY) {
-			hasErrors = true; // otherwise, pipe creation fails
-			break;
-		}
-		// All pipe instances are busy, so wait for 2 seconds.
-		if (!WaitNamedPipe(pipeName, 2000)) {
-			hasErrors = true;
-			break;
-		}
-	}
-
-	if (!hasErrors) {
-		// The pipe is connected; change to message-read mode.
-		DWORD mode = PIPE_READMODE_MESSAGE;
-		if (!SetNamedPipeHandleState(pipe, &mode, NULL, NULL)) {
-			hasErrors = true;
-		}
-	}
-
-	// the pipe is created, but errors happened, destroy it.
-	if (hasErrors && pipe != INVALID_HANDLE_VALUE) {
-		DisconnectNamedPipe(pipe);
-		CloseHandle(pipe);
-		pipe = INVALID_HANDLE_VALUE;
-	}
-	return pipe;
-}
-
-
-// Ensure that we're connected to the PIME input method server
+// Ensure that we're connected to the PIME input method server and our session is initialized.
 // If we are already connected, the method simply returns true;
 // otherwise, it tries to establish the connection.
-bool Client::connectServerPipe() {
-	if (pipe_ == INVALID_HANDLE_VALUE) { // the pipe is not connected
+// If the session needs to be initialized, the pending request is copied to savedRequest
+// before the initialization reuses the request buffer.
+bool Client::connectServerPipe(std::string* savedRequest) {
+	unsigned int generation = LauncherConnection::instance().connect();
+	if (generation == 0) // fail to connect to the server
+		return false;
+	if (generation != connectionGeneration_) { // our session is not yet opened on the connection
+		if (savedRequest)
+			*savedRequest = requestWriter_.text();
 		connectingServerPipe_ = true;
-		wstring serverPipeName = getPipeName(L"Launcher");
-		// try to connect to the server
-		pipe_ = connectPipe(serverPipeName.c_str());
-
-		if (pipe_ != INVALID_HANDLE_VALUE) { // successfully connected to the server
-			init(); // send initialization info to the server
-			if (isActivated_) {
-				// we lost connection while being activated previously
-				// re-initialize the whole text service.
-
-				// cleanup for the previous instance.
-				// remove all buttons
-				for (auto& item: buttons_) {
-					textService_->removeButton(item.second);
-				}
-				buttons_.clear();
+		connectionGeneration_ = generation;
+		init(); // send initialization info to the server
+		if (isActivated_) {
+			// we lost connection while being activated previously
+			// re-initialize the whole text service.
+
+			// cleanup for the previous instance.
+			// remove all buttons
+			for (auto& item: buttons_) {
+				textService_->removeButton(item.second);
+			}
+			buttons_.clear();
 
-				// FIXME: other cleanup might also be needed
+			// FIXME: other cleanup might also be needed
 
-				// activate the text service again.
-				onActivate();
-			}
+			// activate the text service again.
+			onActivate();
 		}
 		connectingServerPipe_ = false;
-		return (pipe_ != INVALID_HANDLE_VALUE);
 	}
 	return true;
 }
 
 void Client::closePipe() {
-	if (connectServerTimerId_) {
-		KillTimer(NULL, connectServerTimerId_);
-		timerIdToClients_.erase(connectServerTimerId_);
-		connectServerTimerId_ = 0;
-	}
-
-	if (pipe_ != INVALID_HANDLE_VALUE) {
-		DisconnectNamedPipe(pipe_);
-		CloseHandle(pipe_);
-		pipe_ = INVALID_HANDLE_VALUE;
+	if (connectionGeneration_ != 0) {
+		// the connection is shared by other clients, but it's broken anyway.
+		LauncherConnection::instance().disconnect(connectionGeneration_);
+		connectionGeneration_ = 0;
 	}
 }
 
-wstring Client::getPipeName(const wchar_t* base_name) {
-	wstring pipeName = L"\\\\.\\pipe\\";
-	DWORD len = 0;
-	::GetUserNameW(NULL, &len); // get the required size of the buffer
-	if (len <= 0)
-		return false;
-	// add username to the pipe path so it won't clash with the other users' pipes
-	unique_ptr<wchar_t[]> username(new wchar_t[len]);
-	if (!::GetUserNameW(username.get(), &len))
-		return false;
-	pipeName += username.get();
-	pipeName += L"\\PIME\\";
-	pipeName += base_name;
-	return pipeName;
-}
-
-
 } // namespace PIME
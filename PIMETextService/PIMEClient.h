@@ -24,6 +24,7 @@
 #include <libIME/KeyEvent.h>
 #include <libIME/EditSession.h>
 #include "PIMELangBarButton.h"
+#include "PIMEProtocol.h"
 
 #include <unordered_map>
 #include <string>
@@ -75,31 +76,43 @@ public:
 	void onCompositionTerminated(bool forced);
 
 private:
-	static HANDLE connectPipe(const wchar_t* pipeName);
-	bool connectServerPipe();
-	bool sendRequestText(HANDLE pipe, const char* data, int len, std::string& reply);
-	bool sendRequest(Json::Value& req, Json::Value& result);
+	bool connectServerPipe(std::string* savedRequest = nullptr);
+	RequestWriter& beginRequest(const char* method);
+	bool sendRequest(Reply& result);
 	void closePipe();
 	void init();
-
-	void keyEventToJson(Ime::KeyEvent& keyEvent, Json::Value& jsonValue);
-	bool handleReply(Json::Value& msg, Ime::EditSession* session = nullptr);
-	void updateStatus(Json::Value& msg, Ime::EditSession* session = nullptr);
+	void createCandidateSection();
+	void closeCandidateSection();
+
+	void writeKeyEvent(Ime::KeyEvent& keyEvent, RequestWriter& req);
+	bool canEchoLocally(Ime::KeyEvent& keyEvent);
+	void updateLocalEchoKeys(const Json::Value& keys);
+	bool handleReply(Reply& msg, Ime::EditSession* session = nullptr);
+	void flushTrace();
+	void updateStatus(Reply& msg, Ime::EditSession* session = nullptr);
+	bool updateCandidateList(Reply& msg);
 	void updateUI(const Json::Value& data);
 	bool sendOnMenu(std::string button_id, Json::Value& result);
 
-	static std::wstring getPipeName(const wchar_t* base_name);
-
 	TextService* textService_;
 	std::string guid_;
-	HANDLE pipe_;
+	unsigned int sessionId_; // our session on the connection shared by all clients in the process
+	unsigned int connectionGeneration_; // generation of the connection our session is opened on, 0 if not opened
 	std::unordered_map<std::string, Ime::ComPtr<PIME::LangBarButton>> buttons_; // map buttons to string IDs
 	unsigned int newSeqNum_;
+	unsigned int pendingSeqNum_; // sequence number of the request being written
+	uint64_t requestBeginTime_; // time when the request is started, 0 if tracing is disabled
+	bool traceFlushNeeded_; // trace events may be recorded by the last request
+	RequestWriter requestWriter_; // buffer reused by all requests
+	int candidatePage_; // id of the candidate list we have, used by the server to send only the changes
+	HANDLE candidateSection_; // shared memory the server may use to pass the candidate list
+	void* candidateView_;
+	std::string candidateSectionName_;
+	std::unordered_map<wchar_t, std::wstring> localEchoKeys_; // keys appended to the composition string as their key names
+	bool localEcho_; // the server allows handling the next key in localEchoKeys_ without asking it first
+	wchar_t localEchoChar_; // the key accepted by filterKeyDown() without asking the server, 0 if none
 	bool isActivated_;
 	bool connectingServerPipe_;
-	UINT connectServerTimerId_;
-
-	static std::unordered_map<UINT_PTR, Client*> timerIdToClients_;
 };
 
 }
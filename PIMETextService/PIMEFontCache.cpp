@@ -0,0 +1,123 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#include "PIMEFontCache.h"
+
+using namespace std;
+
+namespace PIME {
+
+// static
+FontCache& FontCache::instance() {
+	static FontCache cache;
+	return cache;
+}
+
+FontCache::FontCache() :
+	dpi_(0) {
+}
+
+FontCache::~FontCache() {
+	for (auto& item : fonts_) {
+		::DeleteObject(item.second.font);
+	}
+}
+
+HFONT FontCache::acquire(const std::wstring& faceName, int pointSize) {
+	lock_guard<mutex> lock(mutex_);
+	int dpi = dpiLocked();
+	Key key(faceName, pointSize, dpi);
+	auto it = fonts_.find(key);
+	if (it != fonts_.end()) {
+		++it->second.refCount;
+		return it->second.font;
+	}
+
+	// font for candidate and mesasge windows
+	LOGFONT lf;
+	GetObject(GetStockObject(DEFAULT_GUI_FONT), sizeof(lf), &lf);
+	lf.lfHeight = -MulDiv(pointSize, dpi, 72);
+	lf.lfWeight = FW_NORMAL;
+	if (!faceName.empty()) { // apply the font name
+		wcsncpy(lf.lfFaceName, faceName.c_str(), 31);
+		lf.lfFaceName[31] = '\0';
+	}
+	HFONT font = CreateFontIndirect(&lf);
+	if (font) {
+		Entry entry = { font, 1 };
+		fonts_[key] = entry;
+		fontKeys_[font] = key;
+	}
+	return font;
+}
+
+void FontCache::release(HFONT font) {
+	lock_guard<mutex> lock(mutex_);
+	auto key_it = fontKeys_.find(font);
+	if (key_it == fontKeys_.end())
+		return;
+	auto it = fonts_.find(key_it->second);
+	if (--it->second.refCount == 0) {
+		::DeleteObject(font);
+		fonts_.erase(it);
+		fontKeys_.erase(key_it);
+	}
+}
+
+int FontCache::dpi() {
+	lock_guard<mutex> lock(mutex_);
+	return dpiLocked();
+}
+
+int FontCache::dpiLocked() {
+	if (dpi_ == 0) {
+		// getting a screen DC is expensive so we only do it when display settings are changed.
+		HDC hdc = GetDC(NULL);
+		if (hdc) {
+			dpi_ = GetDeviceCaps(hdc, LOGPIXELSY);
+			ReleaseDC(NULL, hdc);
+		}
+		if (dpi_ == 0)
+			return 72; // failed to get DPI, use the point size as pixel size directly.
+	}
+	return dpi_;
+}
+
+void FontCache::invalidateDpi() {
+	lock_guard<mutex> lock(mutex_);
+	dpi_ = 0;
+}
+
+
+DisplayChangeListener::DisplayChangeListener() {
+	create(HWND_DESKTOP, WS_POPUP);
+}
+
+// virtual
+LRESULT DisplayChangeListener::wndProc(UINT msg, WPARAM wp, LPARAM lp) {
+	switch (msg) {
+	case WM_DISPLAYCHANGE:
+	case WM_SETTINGCHANGE:
+		FontCache::instance().invalidateDpi();
+		break;
+	}
+	return Ime::Window::wndProc(msg, wp, lp);
+}
+
+} // namespace PIME
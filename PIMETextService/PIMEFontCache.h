@@ -0,0 +1,82 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#ifndef PIME_FONT_CACHE_H
+#define PIME_FONT_CACHE_H
+
+#include <libIME/Window.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+namespace PIME {
+
+// Process-wide cache of fonts used by the candidate and message windows.
+// All TextService instances in the process (one for each GUI thread) share the same fonts.
+// Fonts are ref-counted and keyed by face name, point size, and screen DPI.
+class FontCache {
+public:
+	static FontCache& instance();
+
+	// get a font with the specified face name and point size for current DPI.
+	// An empty face name means the default GUI font.
+	// The font should be returned with release() when it's no longer used.
+	HFONT acquire(const std::wstring& faceName, int pointSize);
+	void release(HFONT font);
+
+	// logical DPI of the screen. The value is cached until invalidateDpi() is called.
+	int dpi();
+
+	// called when display settings are changed
+	void invalidateDpi();
+
+private:
+	FontCache();
+	~FontCache();
+
+	typedef std::tuple<std::wstring, int, int> Key; // face name, point size, DPI
+
+	struct Entry {
+		HFONT font;
+		int refCount;
+	};
+
+	int dpiLocked();
+
+	std::mutex mutex_;
+	std::map<Key, Entry> fonts_;
+	std::unordered_map<HFONT, Key> fontKeys_;
+	int dpi_; // 0 if unknown
+};
+
+
+// A hidden top-level window receiving broadcast display change messages for FontCache.
+class DisplayChangeListener : public Ime::Window {
+public:
+	DisplayChangeListener();
+
+protected:
+	virtual LRESULT wndProc(UINT msg, WPARAM wp, LPARAM lp);
+};
+
+} // namespace PIME
+
+#endif // PIME_FONT_CACHE_H
@@ -0,0 +1,209 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#include "PIMEIconCache.h"
+
+using namespace std;
+
+namespace PIME {
+
+// max number of cached icons which are not used by any language bar buttons
+static constexpr size_t MAX_UNUSED_ICONS = 64;
+
+// static
+IconCache& IconCache::instance() {
+	static IconCache cache;
+	return cache;
+}
+
+IconCache::IconCache() :
+	preloadThreadRunning_(false) {
+}
+
+IconCache::~IconCache() {
+	for (auto& item : icons_) {
+		::DestroyIcon(item.second.icon);
+	}
+}
+
+// static
+bool IconCache::getLastWriteTime(const std::wstring& path, uint64_t& time) {
+	WIN32_FILE_ATTRIBUTE_DATA attrs;
+	if (!::GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &attrs))
+		return false;
+	time = (uint64_t(attrs.ftLastWriteTime.dwHighDateTime) << 32) | attrs.ftLastWriteTime.dwLowDateTime;
+	return true;
+}
+
+// static
+HICON IconCache::loadIcon(const std::wstring& path) {
+	return (HICON)LoadImageW(NULL, path.c_str(), IMAGE_ICON, 0, 0, LR_DEFAULTCOLOR | LR_LOADFROMFILE);
+}
+
+HICON IconCache::acquire(const std::wstring& path) {
+	Key key(path, 0);
+	getLastWriteTime(path, key.second); // the time stays 0 if the file does not exist
+	{
+		lock_guard<mutex> lock(mutex_);
+		auto it = icons_.find(key);
+		if (it != icons_.end()) { // found in the cache
+			Entry& entry = it->second;
+			++entry.refCount;
+			lru_.splice(lru_.begin(), lru_, entry.lruPos);
+			return entry.icon;
+		}
+	}
+
+	// not in the cache, load it without holding the lock
+	HICON icon = loadIcon(path);
+	if (!icon)
+		return NULL;
+
+	lock_guard<mutex> lock(mutex_);
+	auto it = icons_.find(key);
+	if (it != icons_.end()) { // the icon is loaded by the preload thread in the meantime
+		::DestroyIcon(icon);
+		Entry& entry = it->second;
+		++entry.refCount;
+		lru_.splice(lru_.begin(), lru_, entry.lruPos);
+		return entry.icon;
+	}
+	insertLocked(key, icon, 1);
+	return icon;
+}
+
+void IconCache::release(HICON icon) {
+	if (!icon)
+		return;
+	lock_guard<mutex> lock(mutex_);
+	auto key_it = iconKeys_.find(icon);
+	if (key_it == iconKeys_.end())
+		return;
+	auto it = icons_.find(key_it->second);
+	if (it->second.refCount > 0 && --it->second.refCount == 0)
+		evictLocked();
+}
+
+void IconCache::insertLocked(const Key& key, HICON icon, int refCount) {
+	lru_.push_front(key);
+	Entry entry = { icon, refCount, lru_.begin() };
+	icons_[key] = entry;
+	iconKeys_[icon] = key;
+	evictLocked();
+}
+
+// remove least recently used icons which are not used by any buttons
+void IconCache::evictLocked() {
+	size_t unused = 0;
+	for (auto& item : icons_) {
+		if (item.second.refCount == 0)
+			++unused;
+	}
+	for (auto lru_it = lru_.end(); unused > MAX_UNUSED_ICONS && lru_it != lru_.begin();) {
+		--lru_it;
+		auto it = icons_.find(*lru_it);
+		if (it->second.refCount == 0) {
+			iconKeys_.erase(it->second.icon);
+			::DestroyIcon(it->second.icon);
+			icons_.erase(it);
+			lru_it = lru_.erase(lru_it);
+			--unused;
+		}
+	}
+}
+
+void IconCache::preloadDirectory(const std::wstring& iconPath) {
+	std::wstring dirPath = iconPath;
+	auto sep = dirPath.find_last_of(L"\\/");
+	if (sep == dirPath.npos)
+		return;
+	dirPath.resize(sep);
+
+	lock_guard<mutex> lock(mutex_);
+	for (const auto& queued : preloadQueue_) {
+		if (queued == dirPath)
+			return;
+	}
+	preloadQueue_.push_back(dirPath);
+	if (!preloadThreadRunning_) {
+		// The thread holds a reference to our DLL so it's not unloaded while the thread is running.
+		HMODULE module = NULL;
+		if (::GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS, (LPCWSTR)&IconCache::preloadThread, &module)) {
+			HANDLE thread = ::CreateThread(NULL, 0, preloadThread, module, 0, NULL);
+			if (thread) {
+				::CloseHandle(thread);
+				preloadThreadRunning_ = true;
+			}
+			else {
+				::FreeLibrary(module);
+				preloadQueue_.clear();
+			}
+		}
+	}
+}
+
+// static
+DWORD WINAPI IconCache::preloadThread(LPVOID param) {
+	IconCache& cache = instance();
+	for (;;) {
+		std::wstring dirPath;
+		{
+			lock_guard<mutex> lock(cache.mutex_);
+			if (cache.preloadQueue_.empty()) {
+				cache.preloadThreadRunning_ = false;
+				break;
+			}
+			dirPath = cache.preloadQueue_.front();
+			cache.preloadQueue_.pop_front();
+		}
+		cache.preloadFiles(dirPath);
+	}
+	::FreeLibraryAndExitThread((HMODULE)param, 0);
+	return 0;
+}
+
+void IconCache::preloadFiles(const std::wstring& dirPath) {
+	WIN32_FIND_DATAW findData = { 0 };
+	HANDLE hFind = ::FindFirstFileW((dirPath + L"\\*.ico").c_str(), &findData);
+	if (hFind == INVALID_HANDLE_VALUE)
+		return;
+	do {
+		if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			continue;
+		Key key(dirPath + L"\\" + findData.cFileName,
+			(uint64_t(findData.ftLastWriteTime.dwHighDateTime) << 32) | findData.ftLastWriteTime.dwLowDateTime);
+		{
+			lock_guard<mutex> lock(mutex_);
+			if (icons_.find(key) != icons_.end()) // already cached
+				continue;
+		}
+		HICON icon = loadIcon(key.first);
+		if (!icon)
+			continue;
+		lock_guard<mutex> lock(mutex_);
+		if (icons_.find(key) != icons_.end()) { // loaded by acquire() in the meantime
+			::DestroyIcon(icon);
+			continue;
+		}
+		insertLocked(key, icon, 0);
+	} while (::FindNextFileW(hFind, &findData));
+	::FindClose(hFind);
+}
+
+} // namespace PIME
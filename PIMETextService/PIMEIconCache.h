@@ -0,0 +1,83 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#ifndef PIME_ICON_CACHE_H
+#define PIME_ICON_CACHE_H
+
+#include <Windows.h>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace PIME {
+
+// Process-wide cache of icons used by language bar buttons.
+// Icons are keyed by file path and modification time so they persist across activations
+// of the text services but are reloaded when the files are changed.
+// Icons not used by any button are evicted in LRU order when the cache is full.
+class IconCache {
+public:
+	static IconCache& instance();
+
+	// get the icon loaded from the file. The icon is loaded synchronously if it's not cached.
+	// The icon should be returned with release() when it's no longer used.
+	HICON acquire(const std::wstring& path);
+	void release(HICON icon);
+
+	// load all icons in the same directory as the specified icon file in a background thread.
+	// Buttons of an input method usually switch between icons in the same directory.
+	void preloadDirectory(const std::wstring& iconPath);
+
+private:
+	IconCache();
+	~IconCache();
+
+	typedef std::pair<std::wstring, uint64_t> Key; // file path, last write time
+
+	struct Entry {
+		HICON icon;
+		int refCount;
+		std::list<Key>::iterator lruPos;
+	};
+
+	static bool getLastWriteTime(const std::wstring& path, uint64_t& time);
+	static HICON loadIcon(const std::wstring& path);
+	void insertLocked(const Key& key, HICON icon, int refCount);
+	void evictLocked();
+
+	static DWORD WINAPI preloadThread(LPVOID param);
+	void preloadFiles(const std::wstring& dirPath);
+
+	std::mutex mutex_;
+	std::map<Key, Entry> icons_;
+	std::unordered_map<HICON, Key> iconKeys_;
+	std::list<Key> lru_; // most recently used icons first
+
+	std::deque<std::wstring> preloadQueue_; // directories waiting to be preloaded
+	bool preloadThreadRunning_;
+};
+
+} // namespace PIME
+
+#endif // PIME_ICON_CACHE_H
@@ -20,6 +20,7 @@
 
 #include "PIMELangBarButton.h"
 #include "PIMETextService.h"
+#include "PIMEIconCache.h"
 #include "libIME/Utils.h"
 
 // this is the GUID of the IME mode icon in Windows 8
@@ -31,15 +32,14 @@ static const char WINDOWS_MODE_ICON_ID[] = "windows-mode-icon";
 
 namespace PIME {
 
-// static
-std::unordered_map<std::wstring, HICON> LangBarButton::iconCache_; // cache loaded icons
-
 LangBarButton::LangBarButton(TextService* service, const std::string& id, const GUID& guid, UINT commandId, const wchar_t* text, DWORD style):
 	Ime::LangBarButton(service, guid, commandId, text, style),
-	id_(id) {
+	id_(id),
+	icon_(NULL) {
 }
 
 LangBarButton::~LangBarButton() {
+	IconCache::instance().release(icon_);
 }
 
 LangBarButton* LangBarButton::fromJson(TextService* service, const Json::Value& info) {
@@ -73,16 +73,13 @@ void LangBarButton::updateFromJson(const Json::Value& info) {
 	const Json::Value& iconValue = info["icon"];
 	if (iconValue.isString()) {
 		std::wstring iconPath = utf8ToUtf16(iconValue.asCString());
-		HICON icon = NULL;
-		auto icon_it = iconCache_.find(iconPath);
-		if (icon_it != iconCache_.end()) // found in the cache
-			icon = icon_it->second;
-		else { // not in the cache
-			icon = (HICON)LoadImageW(NULL, iconPath.c_str(), IMAGE_ICON, 0, 0, LR_DEFAULTCOLOR | LR_LOADFROMFILE);
-			iconCache_[iconPath] = icon; // cache the icon
-		}
-		if (icon)
+		IconCache& iconCache = IconCache::instance();
+		HICON icon = iconCache.acquire(iconPath);
+		if (icon) {
 			setIcon(icon);
+			iconCache.release(icon_); // release the old icon after it's replaced
+			icon_ = icon;
+		}
 	}
 
 	const Json::Value& cmdValue = info["commandId"];
@@ -129,13 +126,6 @@ void LangBarButton::updateFromJson(const Json::Value& info) {
 }
 
 
-void LangBarButton::clearIconCache() {
-	for (auto it = iconCache_.begin(); it != iconCache_.end(); ++it) {
-		DestroyIcon(it->second);
-	}
-	iconCache_.clear();
-}
-
 STDMETHODIMP LangBarButton::OnClick(TfLBIClick click, POINT pt, const RECT *prcArea) {
 	// special handling for right click on windows 8 mode icon
 	if (id_ == WINDOWS_MODE_ICON_ID && click == TF_LBI_CLK_RIGHT) {
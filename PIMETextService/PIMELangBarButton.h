@@ -23,7 +23,6 @@
 #include <libIME/LangBarButton.h>
 #include <json/json.h>
 #include <string>
-#include <unordered_map>
 
 namespace PIME {
 
@@ -40,8 +39,6 @@ public:
 		return id_;
 	}
 
-	static void clearIconCache();
-
 	// ITfLangBarItemButton
 	STDMETHODIMP OnClick(TfLBIClick click, POINT pt, const RECT *prcArea);
 	STDMETHODIMP InitMenu(ITfMenu *pMenu);
@@ -51,7 +48,7 @@ protected:
 
 private:
 	std::string id_;
-	static std::unordered_map<std::wstring, HICON> iconCache_; // cache loaded icons
+	HICON icon_; // icon from IconCache
 };
 
 } // namespace PIME
@@ -0,0 +1,340 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#include "PIMELauncherConnection.h"
+#include <chrono>
+#include <memory>
+#include <random>
+
+using namespace std;
+
+namespace PIME {
+
+// how long a GUI thread waits for a newly started connection attempt
+static constexpr DWORD CONNECT_WAIT_MS = 100;
+// delays between connection attempts: 100 ms, 200 ms, 400 ms, ..., 5 seconds at most
+static constexpr DWORD MIN_RETRY_DELAY_MS = 100;
+static constexpr DWORD MAX_RETRY_DELAY_MS = 5000;
+// stop retrying if no clients need the connection for a while, so the DLL can be unloaded
+static constexpr uint64_t CONNECT_IDLE_TIMEOUT_MS = 60 * 1000;
+
+// static
+LauncherConnection& LauncherConnection::instance() {
+	static LauncherConnection connection;
+	return connection;
+}
+
+LauncherConnection::LauncherConnection() :
+	pipe_(INVALID_HANDLE_VALUE),
+	readingPipe_(INVALID_HANDLE_VALUE),
+	closingPipe_(INVALID_HANDLE_VALUE),
+	writeEvent_(CreateEventW(NULL, TRUE, FALSE, NULL)),
+	readEvent_(CreateEventW(NULL, TRUE, FALSE, NULL)),
+	generation_(0),
+	connectThreadRunning_(false),
+	lastConnectTime_(0),
+	nextSessionId_(1) { // session 0 is used by older clients not supporting sessions
+}
+
+LauncherConnection::~LauncherConnection() {
+	closePipe();
+	CloseHandle(writeEvent_);
+	CloseHandle(readEvent_);
+}
+
+unsigned int LauncherConnection::connect() {
+	unique_lock<mutex> lock(mutex_);
+	if (pipe_ != INVALID_HANDLE_VALUE)
+		return generation_;
+
+	lastConnectTime_ = ::GetTickCount64();
+	if (!connectThreadRunning_ && startConnectThread()) {
+		// The launcher is usually ready, so wait a little for the first attempt to avoid
+		// dropping the request. Retries after failures are never waited for.
+		connectedCondition_.wait_for(lock, chrono::milliseconds(CONNECT_WAIT_MS), [this]() {
+			return pipe_ != INVALID_HANDLE_VALUE;
+		});
+	}
+	return pipe_ != INVALID_HANDLE_VALUE ? generation_ : 0;
+}
+
+// called with the mutex locked
+bool LauncherConnection::startConnectThread() {
+	// The thread holds a reference to our DLL so it's not unloaded while the thread is running.
+	HMODULE module = NULL;
+	if (!::GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS, (LPCWSTR)&LauncherConnection::connectThread, &module))
+		return false;
+	HANDLE thread = ::CreateThread(NULL, 0, connectThread, module, 0, NULL);
+	if (!thread) {
+		::FreeLibrary(module);
+		return false;
+	}
+	::CloseHandle(thread);
+	connectThreadRunning_ = true;
+	return true;
+}
+
+// static
+DWORD WINAPI LauncherConnection::connectThread(LPVOID param) {
+	LauncherConnection& conn = instance();
+	wstring serverPipeName = getPipeName(L"Launcher");
+	for (unsigned int attempt = 0;; ++attempt) {
+		// try to connect to the server. this might block for a while if the server is busy.
+		HANDLE pipe = connectPipe(serverPipeName.c_str());
+
+		unique_lock<mutex> lock(conn.mutex_);
+		if (pipe != INVALID_HANDLE_VALUE) { // successfully connected to the server
+			conn.pipe_ = pipe;
+			if (++conn.generation_ == 0) // 0 is reserved for "not connected"
+				++conn.generation_;
+			conn.connectedCondition_.notify_all();
+			break;
+		}
+		if (::GetTickCount64() - conn.lastConnectTime_ > CONNECT_IDLE_TIMEOUT_MS)
+			break;
+		lock.unlock();
+		::Sleep(backoffDelay(attempt));
+	}
+	{
+		lock_guard<mutex> lock(conn.mutex_);
+		conn.connectThreadRunning_ = false;
+	}
+	::FreeLibraryAndExitThread((HMODULE)param, 0);
+	return 0;
+}
+
+// exponential backoff with jitter, so clients in many processes do not retry at the same time
+// static
+DWORD LauncherConnection::backoffDelay(unsigned int attempt) {
+	static thread_local minstd_rand random(::GetCurrentProcessId() ^ ::GetTickCount());
+	DWORD delay = attempt < 16 ? (MIN_RETRY_DELAY_MS << attempt) : MAX_RETRY_DELAY_MS;
+	if (delay > MAX_RETRY_DELAY_MS)
+		delay = MAX_RETRY_DELAY_MS;
+	// pick a random delay between delay/2 and delay
+	return delay / 2 + random() % (delay / 2 + 1);
+}
+
+bool LauncherConnection::transact(unsigned int generation, unsigned int sessionId, const std::string& request, std::string& reply) {
+	unique_lock<mutex> lock(mutex_);
+	if (pipe_ == INVALID_HANDLE_VALUE || generation != generation_ || waiters_.count(sessionId) != 0)
+		return false;
+
+	// message format: "<session id>|<json string>"
+	char prefix[16];
+	int prefixLen = snprintf(prefix, sizeof(prefix), "%u|", sessionId);
+	frame_.assign(prefix, prefixLen);
+	frame_ += request;
+	// The mutex is only held while writing the request. The launcher reads the requests without
+	// waiting for the backends, so this does not wait for the replies of other sessions.
+	if (!writeMessage(frame_)) {
+		// the pipe connection is broken
+		closePipe();
+		return false;
+	}
+
+	Waiter waiter{ &reply, false, false };
+	waiters_[sessionId] = &waiter;
+	while (!waiter.done) {
+		if (readingPipe_ != INVALID_HANDLE_VALUE) {
+			// another session is reading, and hands our reply to us when it arrives.
+			replyCondition_.wait(lock);
+			continue;
+		}
+		// nobody is reading, so we read the replies until ours arrives.
+		HANDLE pipe = pipe_;
+		readingPipe_ = pipe;
+		std::string message;
+		lock.unlock();
+		bool success = readMessage(pipe, message);
+		lock.lock();
+		readingPipe_ = INVALID_HANDLE_VALUE;
+		if (pipe == closingPipe_) { // closed by closePipe() while we're reading
+			CloseHandle(pipe);
+			closingPipe_ = INVALID_HANDLE_VALUE;
+		}
+		else if (!success || !dispatchReply(message)) {
+			// The pipe connection is broken, or the reply is not for any request in flight,
+			// which means the replies are out of sync with the requests.
+			// Closing the pipe starts a new generation, so the sessions are initialized again.
+			closePipe();
+		}
+		// wake up the sessions which got their replies, and let one of the others read the next reply
+		replyCondition_.notify_all();
+	}
+	return waiter.success;
+}
+
+// hand the reply to the session waiting for it. Returns false if no session waits for it.
+// called with the mutex locked
+bool LauncherConnection::dispatchReply(const std::string& message) {
+	// the reply is in the same format as the request: "<session id>|<json string>"
+	unsigned int sessionId = 0;
+	size_t pos = 0;
+	while (pos < message.length() && message[pos] >= '0' && message[pos] <= '9') {
+		sessionId = sessionId * 10 + (message[pos] - '0');
+		++pos;
+	}
+	if (pos == 0 || pos >= message.length() || message[pos] != '|')
+		return false;
+	auto it = waiters_.find(sessionId);
+	if (it == waiters_.end())
+		return false;
+	Waiter* waiter = it->second;
+	waiter->reply->assign(message, pos + 1, string::npos);
+	waiter->done = true;
+	waiter->success = true;
+	waiters_.erase(it);
+	return true;
+}
+
+void LauncherConnection::closeSession(unsigned int generation, unsigned int sessionId) {
+	std::string reply;
+	transact(generation, sessionId, "{\"method\":\"close\"}", reply);
+}
+
+void LauncherConnection::disconnect(unsigned int generation) {
+	lock_guard<mutex> lock(mutex_);
+	if (generation == generation_)
+		closePipe();
+}
+
+// called with the mutex locked
+void LauncherConnection::closePipe() {
+	if (pipe_ != INVALID_HANDLE_VALUE) {
+		DisconnectNamedPipe(pipe_);
+		if (pipe_ == readingPipe_) {
+			// A thread is blocked in reading the pipe without the mutex.
+			// Cancel the read and let the reader close the handle after it returns.
+			CancelIoEx(pipe_, NULL);
+			closingPipe_ = pipe_;
+		}
+		else {
+			CloseHandle(pipe_);
+		}
+		pipe_ = INVALID_HANDLE_VALUE;
+	}
+	// the replies of the requests in flight will never come
+	for (auto& item : waiters_) {
+		item.second->done = true;
+		item.second->success = false;
+	}
+	waiters_.clear();
+	replyCondition_.notify_all();
+}
+
+// write a message to the pipe. called with the mutex locked
+bool LauncherConnection::writeMessage(const std::string& message) {
+	OVERLAPPED overlapped = {};
+	overlapped.hEvent = writeEvent_;
+	if (!WriteFile(pipe_, message.data(), (DWORD)message.length(), NULL, &overlapped) && GetLastError() != ERROR_IO_PENDING)
+		return false;
+	DWORD wlen = 0;
+	return GetOverlappedResult(pipe_, &overlapped, &wlen, TRUE) && wlen == message.length();
+}
+
+// read a whole message from the pipe in message-read mode. called by the reader without the mutex
+bool LauncherConnection::readMessage(HANDLE pipe, std::string& message) {
+	char buf[4096];
+	for (;;) {
+		OVERLAPPED overlapped = {};
+		overlapped.hEvent = readEvent_;
+		if (!ReadFile(pipe, buf, sizeof(buf), NULL, &overlapped)) {
+			DWORD error = GetLastError();
+			if (error != ERROR_IO_PENDING && error != ERROR_MORE_DATA)
+				return false;
+		}
+		DWORD rlen = 0;
+		BOOL success = GetOverlappedResult(pipe, &overlapped, &rlen, TRUE);
+		if (!success && GetLastError() != ERROR_MORE_DATA) {
+			// the pipe is broken, or the read is cancelled by closePipe()
+			return false;
+		}
+		message.append(buf, rlen);
+		if (success) // otherwise, the message has more data to read
+			return true;
+	}
+}
+
+// establish a connection to the specified pipe and returns its handle
+// static
+HANDLE LauncherConnection::connectPipe(const wchar_t* pipeName) {
+	bool hasErrors = false;
+	HANDLE pipe = INVALID_HANDLE_VALUE;
+	for (;;) {
+		// opened for overlapped I/O, so a request can be written while a reply is being read
+		pipe = CreateFile(pipeName, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, NULL);
+		if (pipe != INVALID_HANDLE_VALUE) {
+			// the pipe is successfully created
+			// security check: make sure that we're connecting to the correct server
+			ULONG serverPid;
+			if (GetNamedPipeServerProcessId(pipe, &serverPid)) {
+				// FIXME: check the command line of the server?
+				// See this: http://www.codeproject.com/Articles/19685/Get-Process-Info-with-NtQueryInformationProcess
+				// Too bad! Undocumented Windows internal API might be needed here. :-(
+			}
+			break;
+		}
+		// being busy is not really an error since we just need to wait.
+		if (GetLastError() != ERROR_PIPE_BUSY) {
+			hasErrors = true; // otherwise, pipe creation fails
+			break;
+		}
+		// All pipe instances are busy, so wait for 2 seconds.
+		if (!WaitNamedPipe(pipeName, 2000)) {
+			hasErrors = true;
+			break;
+		}
+	}
+
+	if (!hasErrors) {
+		// The pipe is connected; change to message-read mode.
+		DWORD mode = PIPE_READMODE_MESSAGE;
+		if (!SetNamedPipeHandleState(pipe, &mode, NULL, NULL)) {
+			hasErrors = true;
+		}
+	}
+
+	// the pipe is created, but errors happened, destroy it.
+	if (hasErrors && pipe != INVALID_HANDLE_VALUE) {
+		DisconnectNamedPipe(pipe);
+		CloseHandle(pipe);
+		pipe = INVALID_HANDLE_VALUE;
+	}
+	return pipe;
+}
+
+
+// static
+wstring LauncherConnection::getPipeName(const wchar_t* base_name) {
+	wstring pipeName = L"\\\\.\\pipe\\";
+	DWORD len = 0;
+	::GetUserNameW(NULL, &len); // get the required size of the buffer
+	if (len <= 0)
+		return wstring();
+	// add username to the pipe path so it won't clash with the other users' pipes
+	unique_ptr<wchar_t[]> username(new wchar_t[len]);
+	if (!::GetUserNameW(username.get(), &len))
+		return wstring();
+	pipeName += username.get();
+	pipeName += L"\\PIME\\";
+	pipeName += base_name;
+	return pipeName;
+}
+
+} // namespace PIME
@@ -0,0 +1,109 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#ifndef _PIME_LAUNCHER_CONNECTION_H_
+#define _PIME_LAUNCHER_CONNECTION_H_
+
+#include <Windows.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace PIME {
+
+// The pipe connection to PIMELauncher shared by all PIME::Client instances in the process.
+// Each client opens a logical session on the connection and its messages are framed as
+// "<session id>|<JSON string>", so switching language profiles only needs a new session
+// instead of a new pipe connection.
+// Sessions in different GUI threads have their requests in flight at the same time. The pipe is
+// opened for overlapped I/O so a request can be written while a reply is being read. One of the
+// waiting threads reads the replies and hands each of them to the session with its id, so a slow
+// backend of one session does not block the other sessions.
+class LauncherConnection {
+public:
+	static LauncherConnection& instance();
+
+	// allocate a new session id which is unique in the process
+	unsigned int newSessionId() {
+		return nextSessionId_++;
+	}
+
+	// Ensure that we're connected to the launcher.
+	// Returns the generation of the connection, which is increased every time a new pipe
+	// connection is established, or 0 if we're not connected yet.
+	// Sessions opened on an older generation are unknown to the launcher and should be initialized again.
+	// The connection is established in a background thread, retrying with exponential backoff,
+	// so the GUI thread calling this is never blocked by a busy or restarting launcher.
+	unsigned int connect();
+
+	// send a request of the session and receive its reply.
+	// Returns false if the connection is broken or is not the specified generation.
+	// Each session has at most one request in flight.
+	bool transact(unsigned int generation, unsigned int sessionId, const std::string& request, std::string& reply);
+
+	// close a session opened on the specified generation of the connection
+	void closeSession(unsigned int generation, unsigned int sessionId);
+
+	// close the connection if it is still the specified generation
+	void disconnect(unsigned int generation);
+
+private:
+	LauncherConnection();
+	~LauncherConnection();
+
+	static DWORD WINAPI connectThread(LPVOID param);
+	static DWORD backoffDelay(unsigned int attempt);
+	bool startConnectThread();
+
+	// a session waiting for its reply
+	struct Waiter {
+		std::string* reply;
+		bool done;
+		bool success;
+	};
+
+	static HANDLE connectPipe(const wchar_t* pipeName);
+	static std::wstring getPipeName(const wchar_t* base_name);
+	bool writeMessage(const std::string& message);
+	bool readMessage(HANDLE pipe, std::string& message);
+	bool dispatchReply(const std::string& message);
+	void closePipe();
+
+	std::mutex mutex_; // clients in different GUI threads share the pipe
+	HANDLE pipe_;
+	HANDLE readingPipe_; // the pipe a waiting thread is reading a reply from, if any
+	HANDLE closingPipe_; // closed by the reader after its read is cancelled
+	std::unordered_map<unsigned int, Waiter*> waiters_; // session id => waiter
+	std::condition_variable replyCondition_; // a reply is dispatched or nobody is reading
+	HANDLE writeEvent_; // events of the overlapped I/O: writes are done with the mutex locked,
+	HANDLE readEvent_;  // and there is only one reader at a time
+	unsigned int generation_;
+	bool connectThreadRunning_;
+	uint64_t lastConnectTime_; // last time a client asks for the connection
+	std::condition_variable connectedCondition_;
+	std::atomic<unsigned int> nextSessionId_;
+	std::string frame_; // buffer for framing requests
+};
+
+} // namespace PIME
+
+#endif // _PIME_LAUNCHER_CONNECTION_H_
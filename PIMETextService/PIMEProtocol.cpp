@@ -0,0 +1,829 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#include "PIMEProtocol.h"
+#include <cstring>
+#include <json/json.h>
+
+using namespace std;
+
+namespace PIME {
+
+// size of a key event request is about 800 bytes, mostly taken by the keyStates array
+static constexpr size_t INITIAL_REQUEST_BUF_SIZE = 2048;
+
+RequestWriter::RequestWriter() {
+	buf_.reserve(INITIAL_REQUEST_BUF_SIZE);
+}
+
+RequestWriter& RequestWriter::begin(const char* method, unsigned int seqNum) {
+	buf_.clear();
+	buf_ += "{\"method\":";
+	appendString(method);
+	buf_ += ",\"seqNum\":";
+	appendUInt(seqNum);
+	return *this;
+}
+
+RequestWriter& RequestWriter::add(const char* name, bool value) {
+	appendKey(name);
+	buf_ += value ? "true" : "false";
+	return *this;
+}
+
+RequestWriter& RequestWriter::add(const char* name, int value) {
+	appendKey(name);
+	if (value < 0) {
+		buf_ += '-';
+		appendUInt(0u - static_cast<unsigned int>(value));
+	}
+	else {
+		appendUInt(static_cast<unsigned int>(value));
+	}
+	return *this;
+}
+
+RequestWriter& RequestWriter::add(const char* name, unsigned int value) {
+	appendKey(name);
+	appendUInt(value);
+	return *this;
+}
+
+RequestWriter& RequestWriter::add(const char* name, const char* value) {
+	appendKey(name);
+	appendString(value);
+	return *this;
+}
+
+RequestWriter& RequestWriter::addByteArray(const char* name, const unsigned char* values, size_t len) {
+	appendKey(name);
+	buf_ += '[';
+	for (size_t i = 0; i < len; ++i) {
+		if (i > 0)
+			buf_ += ',';
+		appendUInt(values[i]);
+	}
+	buf_ += ']';
+	return *this;
+}
+
+const std::string& RequestWriter::end() {
+	buf_ += '}';
+	return buf_;
+}
+
+void RequestWriter::appendKey(const char* name) {
+	// keys are always written after "method" and "seqNum", so a separator is always needed.
+	buf_ += ",\"";
+	buf_ += name; // all of our keys are plain ASCII and need no escaping
+	buf_ += "\":";
+}
+
+void RequestWriter::appendUInt(unsigned int value) {
+	char digits[16];
+	char* p = digits + sizeof(digits);
+	do {
+		*--p = '0' + (value % 10);
+		value /= 10;
+	} while (value != 0);
+	buf_.append(p, digits + sizeof(digits) - p);
+}
+
+void RequestWriter::appendString(const char* str) {
+	static const char hexDigits[] = "0123456789abcdef";
+	buf_ += '"';
+	const char* run = str; // start of the characters which need no escaping
+	for (const char* p = str; *p; ++p) {
+		unsigned char ch = static_cast<unsigned char>(*p);
+		if (ch >= 0x20 && ch != '"' && ch != '\\')
+			continue;
+		buf_.append(run, p - run);
+		run = p + 1;
+		switch (ch) {
+		case '"':
+			buf_ += "\\\"";
+			break;
+		case '\\':
+			buf_ += "\\\\";
+			break;
+		case '\n':
+			buf_ += "\\n";
+			break;
+		case '\r':
+			buf_ += "\\r";
+			break;
+		case '\t':
+			buf_ += "\\t";
+			break;
+		default: // other control characters
+			buf_ += "\\u00";
+			buf_ += hexDigits[ch >> 4];
+			buf_ += hexDigits[ch & 0xf];
+		}
+	}
+	buf_ += run;
+	buf_ += '"';
+}
+
+
+// One-pass parser of reply messages
+// The text is not modified. Strings are unescaped to the output buffer, which should be at
+// least as long as the text.
+class Reply::Parser {
+public:
+	Parser(char* begin, char* end, char* out, Reply& reply) :
+		p_(begin), end_(end), out_(out), reply_(reply) {
+	}
+
+	bool parseReply();
+
+private:
+	enum ValueType {
+		TYPE_INVALID,
+		TYPE_NULL,
+		TYPE_BOOL,
+		TYPE_NUMBER,
+		TYPE_STRING,
+		TYPE_ARRAY,
+		TYPE_OBJECT
+	};
+
+	// the decoded value of a scalar
+	struct Scalar {
+		ValueType type;
+		bool isInt;
+		long long intValue;
+		bool boolValue; // converted to bool for any type of scalars
+	};
+
+	static uint32_t fieldFromKey(const StringRef& key);
+
+	void skipSpaces() {
+		while (p_ < end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\n' || *p_ == '\r'))
+			++p_;
+	}
+
+	bool consume(char ch) {
+		skipSpaces();
+		if (p_ < end_ && *p_ == ch) {
+			++p_;
+			return true;
+		}
+		return false;
+	}
+
+	ValueType peekType();
+	bool parseMember(uint32_t field);
+	bool parseString(StringRef& result);
+	bool parseScalar(Scalar& result);
+	bool parseRaw(StringRef& result);
+	bool parseStringArray(std::vector<StringRef>& result);
+	bool parseMessage();
+	bool parseCandidateChanges();
+	bool skipValue();
+	bool skipString();
+	bool skipLiteral(const char* literal);
+	bool skipNumber(Scalar* result);
+	static void appendUtf8(char*& dst, uint32_t codePoint);
+	bool parseHex4(uint32_t& value);
+
+	char* p_;
+	char* end_;
+	char* out_;  // where the next unescaped string is written
+	Reply& reply_;
+};
+
+struct KeyField {
+	const char* key;
+	size_t length;
+	uint32_t field;
+};
+
+#define KEY_FIELD(key, field)	{ key, sizeof(key) - 1, Reply::field }
+
+// keys sent with almost every reply are listed first
+static const KeyField knownKeys[] = {
+	KEY_FIELD("success", SUCCESS),
+	KEY_FIELD("seqNum", SEQ_NUM),
+	KEY_FIELD("return", RETURN),
+	KEY_FIELD("compositionString", COMPOSITION_STRING),
+	KEY_FIELD("compositionCursor", COMPOSITION_CURSOR),
+	KEY_FIELD("candidateList", CANDIDATE_LIST),
+	KEY_FIELD("candidateCursor", CANDIDATE_CURSOR),
+	KEY_FIELD("showCandidates", SHOW_CANDIDATES),
+	KEY_FIELD("candidatePage", CANDIDATE_PAGE),
+	KEY_FIELD("candidateCount", CANDIDATE_COUNT),
+	KEY_FIELD("candidateChanges", CANDIDATE_CHANGES),
+	KEY_FIELD("candidateGeneration", CANDIDATE_GENERATION),
+	KEY_FIELD("commitString", COMMIT_STRING),
+	KEY_FIELD("setSelKeys", SET_SEL_KEYS),
+	KEY_FIELD("showMessage", SHOW_MESSAGE),
+	KEY_FIELD("hideMessage", HIDE_MESSAGE),
+	KEY_FIELD("addButton", ADD_BUTTON),
+	KEY_FIELD("removeButton", REMOVE_BUTTON),
+	KEY_FIELD("changeButton", CHANGE_BUTTON),
+	KEY_FIELD("addPreservedKey", ADD_PRESERVED_KEY),
+	KEY_FIELD("removePreservedKey", REMOVE_PRESERVED_KEY),
+	KEY_FIELD("openKeyboard", OPEN_KEYBOARD),
+	KEY_FIELD("customizeUI", CUSTOMIZE_UI),
+	KEY_FIELD("localEcho", LOCAL_ECHO),
+	KEY_FIELD("localEchoKeys", LOCAL_ECHO_KEYS),
+	KEY_FIELD("trace", TRACE)
+};
+
+#undef KEY_FIELD
+
+// static
+uint32_t Reply::Parser::fieldFromKey(const StringRef& key) {
+	for (const auto& known : knownKeys) {
+		if (known.length == key.length && memcmp(known.key, key.data, key.length) == 0)
+			return known.field;
+	}
+	return 0;
+}
+
+bool Reply::Parser::parseReply() {
+	if (!consume('{'))
+		return false;
+	if (consume('}'))
+		return true;
+	do {
+		skipSpaces();
+		StringRef key;
+		if (!parseString(key) || !consume(':'))
+			return false;
+		if (!parseMember(fieldFromKey(key)))
+			return false;
+	} while (consume(','));
+	return consume('}');
+}
+
+Reply::Parser::ValueType Reply::Parser::peekType() {
+	skipSpaces();
+	if (p_ >= end_)
+		return TYPE_INVALID;
+	switch (*p_) {
+	case '{':
+		return TYPE_OBJECT;
+	case '[':
+		return TYPE_ARRAY;
+	case '"':
+		return TYPE_STRING;
+	case 't':
+	case 'f':
+		return TYPE_BOOL;
+	case 'n':
+		return TYPE_NULL;
+	default:
+		if (*p_ == '-' || (*p_ >= '0' && *p_ <= '9'))
+			return TYPE_NUMBER;
+	}
+	return TYPE_INVALID;
+}
+
+// Decode the value of a member of the reply object.
+// Values with unexpected types are skipped as if they are not present, like the checks
+// done with Json::Value::isXXX() before.
+bool Reply::Parser::parseMember(uint32_t field) {
+	ValueType type = peekType();
+	Scalar scalar;
+	switch (field) {
+	case SUCCESS:
+	case SEQ_NUM:
+	case SHOW_CANDIDATES:
+	case HIDE_MESSAGE:
+	case OPEN_KEYBOARD:
+	case LOCAL_ECHO:
+	case TRACE:
+	case CANDIDATE_CURSOR:
+	case COMPOSITION_CURSOR:
+	case CANDIDATE_PAGE:
+	case CANDIDATE_COUNT:
+	case CANDIDATE_GENERATION:
+		if (type == TYPE_STRING || type == TYPE_ARRAY || type == TYPE_OBJECT)
+			return skipValue();
+		if (!parseScalar(scalar))
+			return false;
+		switch (field) {
+		case SUCCESS:
+			reply_.success = scalar.boolValue;
+			break;
+		case SEQ_NUM:
+			if (!scalar.isInt)
+				return true;
+			reply_.seqNum = static_cast<unsigned int>(scalar.intValue);
+			break;
+		case SHOW_CANDIDATES:
+		case HIDE_MESSAGE:
+		case OPEN_KEYBOARD:
+		case LOCAL_ECHO:
+		case TRACE:
+			if (scalar.type != TYPE_BOOL)
+				return true;
+			if (field == SHOW_CANDIDATES)
+				reply_.showCandidates = scalar.boolValue;
+			else if (field == OPEN_KEYBOARD)
+				reply_.openKeyboard = scalar.boolValue;
+			else if (field == LOCAL_ECHO)
+				reply_.localEcho = scalar.boolValue;
+			else
+				reply_.trace = scalar.boolValue;
+			break;
+		case CANDIDATE_CURSOR:
+		case COMPOSITION_CURSOR:
+			if (!scalar.isInt)
+				return true;
+			if (field == CANDIDATE_CURSOR)
+				reply_.candidateCursor = static_cast<int>(scalar.intValue);
+			else
+				reply_.compositionCursor = static_cast<int>(scalar.intValue);
+			break;
+		case CANDIDATE_PAGE:
+		case CANDIDATE_COUNT:
+			if (!scalar.isInt || scalar.intValue < 0)
+				return true;
+			if (field == CANDIDATE_PAGE)
+				reply_.candidatePage = static_cast<int>(scalar.intValue);
+			else
+				reply_.candidateCount = static_cast<int>(scalar.intValue);
+			break;
+		case CANDIDATE_GENERATION:
+			if (!scalar.isInt || scalar.intValue < 0 || scalar.intValue > UINT32_MAX)
+				return true;
+			reply_.candidateGeneration = static_cast<uint32_t>(scalar.intValue);
+			break;
+		}
+		break;
+	case RETURN:
+		if (type == TYPE_ARRAY || type == TYPE_OBJECT || type == TYPE_STRING) {
+			if (!parseRaw(reply_.returnJson))
+				return false;
+		}
+		else {
+			char* start = p_;
+			if (!parseScalar(scalar))
+				return false;
+			reply_.returnValue = scalar.boolValue;
+			reply_.returnJson.data = start;
+			reply_.returnJson.length = p_ - start;
+		}
+		break;
+	case SET_SEL_KEYS:
+	case COMMIT_STRING:
+	case COMPOSITION_STRING:
+		if (type != TYPE_STRING)
+			return skipValue();
+		if (!parseString(field == SET_SEL_KEYS ? reply_.selKeys :
+			field == COMMIT_STRING ? reply_.commitString : reply_.compositionString))
+			return false;
+		break;
+	case CANDIDATE_LIST:
+		if (type != TYPE_ARRAY)
+			return skipValue();
+		if (!parseStringArray(reply_.candidateList))
+			return false;
+		break;
+	case CANDIDATE_CHANGES:
+		if (type != TYPE_ARRAY)
+			return skipValue();
+		if (!parseCandidateChanges())
+			return false;
+		break;
+	case SHOW_MESSAGE:
+		if (type != TYPE_OBJECT)
+			return skipValue();
+		return parseMessage();
+	case ADD_BUTTON:
+	case REMOVE_BUTTON:
+	case CHANGE_BUTTON:
+	case ADD_PRESERVED_KEY:
+	case REMOVE_PRESERVED_KEY:
+		if (type != TYPE_ARRAY)
+			return skipValue();
+		if (!parseRaw(field == ADD_BUTTON ? reply_.addButton :
+			field == REMOVE_BUTTON ? reply_.removeButton :
+			field == CHANGE_BUTTON ? reply_.changeButton :
+			field == ADD_PRESERVED_KEY ? reply_.addPreservedKey : reply_.removePreservedKey))
+			return false;
+		break;
+	case CUSTOMIZE_UI:
+	case LOCAL_ECHO_KEYS:
+		if (type != TYPE_OBJECT)
+			return skipValue();
+		if (!parseRaw(field == CUSTOMIZE_UI ? reply_.customizeUI : reply_.localEchoKeys))
+			return false;
+		break;
+	default: // unknown keys
+		return skipValue();
+	}
+	reply_.fields_ |= field;
+	return true;
+}
+
+// parse "showMessage": {"message": <string>, "duration": <int>}
+bool Reply::Parser::parseMessage() {
+	bool hasMessage = false;
+	bool hasDuration = false;
+	consume('{');
+	if (!consume('}')) {
+		do {
+			skipSpaces();
+			StringRef key;
+			if (!parseString(key) || !consume(':'))
+				return false;
+			ValueType type = peekType();
+			if (strcmp(key.data, "message") == 0 && type == TYPE_STRING) {
+				if (!parseString(reply_.message))
+					return false;
+				hasMessage = true;
+			}
+			else if (strcmp(key.data, "duration") == 0 && type == TYPE_NUMBER) {
+				Scalar scalar;
+				if (!parseScalar(scalar))
+					return false;
+				if (scalar.isInt) {
+					reply_.messageDuration = static_cast<int>(scalar.intValue);
+					hasDuration = true;
+				}
+			}
+			else if (!skipValue()) {
+				return false;
+			}
+		} while (consume(','));
+		if (!consume('}'))
+			return false;
+	}
+	if (hasMessage && hasDuration)
+		reply_.fields_ |= SHOW_MESSAGE;
+	return true;
+}
+
+// parse "candidateChanges": [[<start>, <string>, <string>, ...], ...]
+bool Reply::Parser::parseCandidateChanges() {
+	reply_.candidateChanges.clear();
+	reply_.candidateRanges.clear();
+	consume('[');
+	if (consume(']'))
+		return true;
+	do {
+		Scalar start;
+		if (!consume('[') || peekType() != TYPE_NUMBER || !parseScalar(start))
+			return false;
+		if (!start.isInt || start.intValue < 0)
+			return false;
+		CandidateRange range;
+		range.start = static_cast<int>(start.intValue);
+		range.first = reply_.candidateChanges.size();
+		while (consume(',')) {
+			StringRef item;
+			if (peekType() != TYPE_STRING || !parseString(item))
+				return false;
+			reply_.candidateChanges.push_back(item);
+		}
+		if (!consume(']'))
+			return false;
+		range.count = reply_.candidateChanges.size() - range.first;
+		reply_.candidateRanges.push_back(range);
+	} while (consume(','));
+	return consume(']');
+}
+
+bool Reply::Parser::parseStringArray(std::vector<StringRef>& result) {
+	result.clear();
+	consume('[');
+	if (consume(']'))
+		return true;
+	do {
+		StringRef item;
+		if (peekType() == TYPE_STRING) {
+			if (!parseString(item))
+				return false;
+		}
+		else if (!skipValue()) { // non-string items are treated as empty strings
+			return false;
+		}
+		result.push_back(item);
+	} while (consume(','));
+	return consume(']');
+}
+
+// Unescape the string to the output buffer. The unescaped string with its terminating '\0' is
+// never longer than the escaped one with the quotes, so the buffer never overflows.
+bool Reply::Parser::parseString(StringRef& result) {
+	if (p_ >= end_ || *p_ != '"')
+		return false;
+	++p_;
+	char* dst = out_;
+	char* start = dst;
+	while (p_ < end_) {
+		char ch = *p_++;
+		if (ch == '"') {
+			*dst = '\0';
+			result.data = start;
+			result.length = dst - start;
+			out_ = dst + 1;
+			return true;
+		}
+		if (ch != '\\') {
+			*dst++ = ch;
+			continue;
+		}
+		if (p_ >= end_)
+			return false;
+		switch (*p_++) {
+		case '"':
+			*dst++ = '"';
+			break;
+		case '\\':
+			*dst++ = '\\';
+			break;
+		case '/':
+			*dst++ = '/';
+			break;
+		case 'b':
+			*dst++ = '\b';
+			break;
+		case 'f':
+			*dst++ = '\f';
+			break;
+		case 'n':
+			*dst++ = '\n';
+			break;
+		case 'r':
+			*dst++ = '\r';
+			break;
+		case 't':
+			*dst++ = '\t';
+			break;
+		case 'u': {
+			uint32_t codePoint;
+			if (!parseHex4(codePoint))
+				return false;
+			// characters outside the BMP are escaped as UTF-16 surrogate pairs: \uXXXX\uXXXX
+			if (codePoint >= 0xD800 && codePoint <= 0xDBFF &&
+				end_ - p_ >= 6 && p_[0] == '\\' && p_[1] == 'u') {
+				char* savedPos = p_;
+				p_ += 2;
+				uint32_t low;
+				if (parseHex4(low) && low >= 0xDC00 && low <= 0xDFFF)
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+				else
+					p_ = savedPos;
+			}
+			appendUtf8(dst, codePoint);
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+	return false;
+}
+
+bool Reply::Parser::parseHex4(uint32_t& value) {
+	if (end_ - p_ < 4)
+		return false;
+	value = 0;
+	for (int i = 0; i < 4; ++i) {
+		char ch = *p_++;
+		value <<= 4;
+		if (ch >= '0' && ch <= '9')
+			value |= ch - '0';
+		else if (ch >= 'a' && ch <= 'f')
+			value |= ch - 'a' + 10;
+		else if (ch >= 'A' && ch <= 'F')
+			value |= ch - 'A' + 10;
+		else
+			return false;
+	}
+	return true;
+}
+
+// static
+void Reply::Parser::appendUtf8(char*& dst, uint32_t codePoint) {
+	if (codePoint < 0x80) {
+		*dst++ = static_cast<char>(codePoint);
+	}
+	else if (codePoint < 0x800) {
+		*dst++ = static_cast<char>(0xC0 | (codePoint >> 6));
+		*dst++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+	else if (codePoint < 0x10000) {
+		*dst++ = static_cast<char>(0xE0 | (codePoint >> 12));
+		*dst++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		*dst++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+	else {
+		*dst++ = static_cast<char>(0xF0 | (codePoint >> 18));
+		*dst++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+		*dst++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		*dst++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+}
+
+bool Reply::Parser::parseScalar(Scalar& result) {
+	result.type = peekType();
+	result.isInt = false;
+	result.intValue = 0;
+	result.boolValue = false;
+	switch (result.type) {
+	case TYPE_NULL:
+		return skipLiteral("null");
+	case TYPE_BOOL:
+		result.boolValue = (*p_ == 't');
+		return skipLiteral(result.boolValue ? "true" : "false");
+	case TYPE_NUMBER:
+		return skipNumber(&result);
+	default:
+		return false;
+	}
+}
+
+// Skip a value and return its raw JSON text. The text is not modified or null-terminated.
+bool Reply::Parser::parseRaw(StringRef& result) {
+	skipSpaces();
+	char* start = p_;
+	if (!skipValue())
+		return false;
+	result.data = start;
+	result.length = p_ - start;
+	return true;
+}
+
+bool Reply::Parser::skipValue() {
+	switch (peekType()) {
+	case TYPE_OBJECT:
+		++p_;
+		if (consume('}'))
+			return true;
+		do {
+			skipSpaces();
+			if (!skipString() || !consume(':') || !skipValue())
+				return false;
+		} while (consume(','));
+		return consume('}');
+	case TYPE_ARRAY:
+		++p_;
+		if (consume(']'))
+			return true;
+		do {
+			if (!skipValue())
+				return false;
+		} while (consume(','));
+		return consume(']');
+	case TYPE_STRING:
+		return skipString();
+	case TYPE_BOOL:
+		return skipLiteral(*p_ == 't' ? "true" : "false");
+	case TYPE_NULL:
+		return skipLiteral("null");
+	case TYPE_NUMBER:
+		return skipNumber(nullptr);
+	default:
+		return false;
+	}
+}
+
+bool Reply::Parser::skipString() {
+	if (p_ >= end_ || *p_ != '"')
+		return false;
+	++p_;
+	while (p_ < end_) {
+		char ch = *p_++;
+		if (ch == '"')
+			return true;
+		if (ch == '\\')
+			++p_;
+	}
+	return false;
+}
+
+bool Reply::Parser::skipLiteral(const char* literal) {
+	size_t len = strlen(literal);
+	if (size_t(end_ - p_) < len || memcmp(p_, literal, len) != 0)
+		return false;
+	p_ += len;
+	return true;
+}
+
+bool Reply::Parser::skipNumber(Scalar* result) {
+	char* start = p_;
+	bool negative = false;
+	long long value = 0;
+	bool isInt = true;
+	if (p_ < end_ && *p_ == '-') {
+		negative = true;
+		++p_;
+	}
+	if (p_ >= end_ || *p_ < '0' || *p_ > '9')
+		return false;
+	while (p_ < end_ && *p_ >= '0' && *p_ <= '9') {
+		value = value * 10 + (*p_ - '0');
+		++p_;
+	}
+	bool nonZero = (value != 0);
+	if (p_ < end_ && *p_ == '.') {
+		isInt = false;
+		++p_;
+		while (p_ < end_ && *p_ >= '0' && *p_ <= '9') {
+			if (*p_ != '0')
+				nonZero = true;
+			++p_;
+		}
+	}
+	if (p_ < end_ && (*p_ == 'e' || *p_ == 'E')) {
+		isInt = false;
+		++p_;
+		if (p_ < end_ && (*p_ == '+' || *p_ == '-'))
+			++p_;
+		while (p_ < end_ && *p_ >= '0' && *p_ <= '9')
+			++p_;
+	}
+	if (result != nullptr) {
+		result->isInt = isInt;
+		result->intValue = negative ? -value : value;
+		result->boolValue = nonZero;
+	}
+	return p_ > start;
+}
+
+
+Reply::Reply() {
+	clear();
+}
+
+void Reply::clear() {
+	fields_ = 0;
+	success = false;
+	seqNum = 0;
+	returnValue = false;
+	returnJson = StringRef();
+	selKeys = StringRef();
+	message = StringRef();
+	messageDuration = 0;
+	showCandidates = false;
+	candidateList.clear();
+	candidateCursor = 0;
+	candidatePage = 0;
+	candidateCount = 0;
+	candidateChanges.clear();
+	candidateRanges.clear();
+	candidateGeneration = 0;
+	commitString = StringRef();
+	compositionString = StringRef();
+	compositionCursor = 0;
+	openKeyboard = false;
+	localEcho = false;
+	trace = false;
+	addButton = StringRef();
+	removeButton = StringRef();
+	changeButton = StringRef();
+	addPreservedKey = StringRef();
+	removePreservedKey = StringRef();
+	customizeUI = StringRef();
+	localEchoKeys = StringRef();
+}
+
+bool Reply::parse() {
+	if (parseText())
+		return true;
+	// The text is left untouched by the failed parse. Let jsoncpp try the relaxed syntax it
+	// accepts and decode its normalized output instead.
+	Json::Value root;
+	Json::Reader reader;
+	if (!reader.parse(text_, root, false) || !root.isObject())
+		return false;
+	text_ = Json::FastWriter().write(root);
+	return parseText();
+}
+
+bool Reply::parseText() {
+	clear();
+	// every string takes at least its two quotes in the text, leaving room for its '\0'
+	strings_.resize(text_.length() + 1);
+	char* begin = &text_[0];
+	Parser parser(begin, begin + text_.length(), &strings_[0], *this);
+	if (!parser.parseReply()) {
+		clear();
+		return false;
+	}
+	return true;
+}
+
+} // namespace PIME
@@ -0,0 +1,208 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#ifndef _PIME_PROTOCOL_H_
+#define _PIME_PROTOCOL_H_
+
+// Encoder and decoder for the JSON messages exchanged between PIME::Client and the backends.
+// This file does not depend on Windows or libIME so it can be built and profiled on other platforms.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PIME {
+
+// Streaming writer for request messages.
+// The request is written directly into an internal buffer which is reused across requests.
+class RequestWriter {
+public:
+	RequestWriter();
+
+	// start a new request object: {"method":"<method>","seqNum":<seqNum>
+	RequestWriter& begin(const char* method, unsigned int seqNum);
+
+	RequestWriter& add(const char* name, bool value);
+	RequestWriter& add(const char* name, int value);
+	RequestWriter& add(const char* name, unsigned int value);
+	RequestWriter& add(const char* name, const char* value);
+	RequestWriter& add(const char* name, const std::string& value) {
+		return add(name, value.c_str());
+	}
+
+	// write an array of unsigned bytes as JSON numbers, such as the keyStates of a key event
+	RequestWriter& addByteArray(const char* name, const unsigned char* values, size_t len);
+
+	// close the request object and return the serialized text
+	const std::string& end();
+
+	const std::string& text() const {
+		return buf_;
+	}
+
+private:
+	void appendKey(const char* name);
+	void appendUInt(unsigned int value);
+	void appendString(const char* str);
+
+	std::string buf_;
+};
+
+
+// A reference to a string inside the buffers of the reply.
+// Strings are unescaped to the string buffer and null-terminated so data can be passed to C APIs directly.
+struct StringRef {
+	const char* data;
+	size_t length;
+
+	StringRef() : data(""), length(0) {
+	}
+
+	bool empty() const {
+		return length == 0;
+	}
+
+	std::string str() const {
+		return std::string(data, length);
+	}
+};
+
+
+// Decoded reply message.
+// Known keys are decoded in one pass over the reply text. Values rarely sent by the backends
+// (language buttons, preserved keys, UI customization, and menus) are kept as raw JSON text
+// so the caller can parse them with jsoncpp only when they are present.
+class Reply {
+public:
+	enum Field {
+		SUCCESS = 1 << 0,
+		SEQ_NUM = 1 << 1,
+		RETURN = 1 << 2,
+		SET_SEL_KEYS = 1 << 3,
+		SHOW_MESSAGE = 1 << 4,
+		HIDE_MESSAGE = 1 << 5,
+		SHOW_CANDIDATES = 1 << 6,
+		CANDIDATE_LIST = 1 << 7,
+		CANDIDATE_CURSOR = 1 << 8,
+		COMMIT_STRING = 1 << 9,
+		COMPOSITION_STRING = 1 << 10,
+		COMPOSITION_CURSOR = 1 << 11,
+		ADD_BUTTON = 1 << 12,
+		REMOVE_BUTTON = 1 << 13,
+		CHANGE_BUTTON = 1 << 14,
+		ADD_PRESERVED_KEY = 1 << 15,
+		REMOVE_PRESERVED_KEY = 1 << 16,
+		OPEN_KEYBOARD = 1 << 17,
+		CUSTOMIZE_UI = 1 << 18,
+		CANDIDATE_PAGE = 1 << 19,
+		CANDIDATE_COUNT = 1 << 20,
+		CANDIDATE_CHANGES = 1 << 21,
+		LOCAL_ECHO = 1 << 22,
+		LOCAL_ECHO_KEYS = 1 << 23,
+		CANDIDATE_GENERATION = 1 << 24,
+		TRACE = 1 << 25
+	};
+
+	// a range of candidates replaced by "candidateChanges"
+	struct CandidateRange {
+		int start;  // index of the first replaced candidate
+		size_t first;  // index of the first new item in candidateChanges
+		size_t count;  // number of replaced candidates
+	};
+
+	Reply();
+
+	// buffer holding the text of the reply message
+	std::string& text() {
+		return text_;
+	}
+
+	// Parse the reply text in one pass. If the strict parser fails, the text is parsed again
+	// with jsoncpp, which also accepts comments and other relaxed syntax.
+	// Returns false if the text is not a valid JSON object.
+	bool parse();
+
+	void clear();
+
+	bool has(Field field) const {
+		return (fields_ & field) != 0;
+	}
+
+	bool success;
+	unsigned int seqNum;
+
+	// "return": returnValue is its value converted to bool, returnJson is the raw JSON text.
+	bool returnValue;
+	StringRef returnJson;
+
+	StringRef selKeys;
+	StringRef message;  // "showMessage": {"message": ..., "duration": ...}
+	int messageDuration;
+	bool showCandidates;
+	std::vector<StringRef> candidateList;
+	int candidateCursor;
+
+	// Delta encoded candidate list, sent instead of candidateList by backends supporting it.
+	// "candidatePage": id of the candidate list after applying this reply
+	// "candidateCount": number of candidates in the new list
+	// "candidateChanges": [[start, "cand", "cand", ...], ...] replaced ranges of the old list
+	int candidatePage;
+	int candidateCount;
+	std::vector<StringRef> candidateChanges;
+	std::vector<CandidateRange> candidateRanges;
+
+	// "candidateGeneration": the candidate list is written to the shared memory section with this
+	// generation instead of being sent in the reply, see PIMECandidatePage.h
+	uint32_t candidateGeneration;
+
+	StringRef commitString;
+	StringRef compositionString;
+	int compositionCursor;
+	bool openKeyboard;
+
+	// "localEcho": whether the next plain keystroke in localEchoKeys only appends its key name
+	// to the composition string, so the client may handle it without asking the backend first.
+	bool localEcho;
+
+	// "trace": added by the launcher when request tracing is enabled
+	bool trace;
+
+	// raw JSON text of values handled by jsoncpp
+	StringRef addButton;
+	StringRef removeButton;
+	StringRef changeButton;
+	StringRef addPreservedKey;
+	StringRef removePreservedKey;
+	StringRef customizeUI;
+	StringRef localEchoKeys;  // "localEchoKeys": {"<key>": "<key name>", ...}
+
+private:
+	class Parser;
+
+	bool parseText();
+
+	std::string text_;
+	std::string strings_;  // unescaped strings referenced by the StringRef fields
+	uint32_t fields_;
+};
+
+} // namespace PIME
+
+#endif // _PIME_PROTOCOL_H_
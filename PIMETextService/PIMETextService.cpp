@@ -41,6 +41,7 @@ TextService::TextService(ImeModule* module):
 	candidateListElementId_(0),
 	candidateWindow_(nullptr),
 	showingCandidates_(false),
+	fontDpi_(0),
 	updateFont_(false),
 	candPerRow_(10),
 	selKeys_(L"1234567890"),
@@ -48,12 +49,9 @@ TextService::TextService(ImeModule* module):
 	candFontSize_(12) {
 
 	// font for candidate and mesasge windows
-	font_ = (HFONT)GetStockObject(DEFAULT_GUI_FONT);
-	LOGFONT lf;
-	GetObject(font_, sizeof(lf), &lf);
-	lf.lfHeight = candFontHeight(); // FIXME: make this configurable
-	lf.lfWeight = FW_NORMAL;
-	font_ = CreateFontIndirect(&lf);
+	FontCache& fontCache = FontCache::instance();
+	fontDpi_ = fontCache.dpi();
+	font_ = fontCache.acquire(candFontName_, candFontSize_);
 }
 
 TextService::~TextService(void) {
@@ -66,13 +64,16 @@ TextService::~TextService(void) {
 
 	if (candidateWindow_) {
 		hideCandidates();
+		candidateWindow_ = nullptr;
 	}
 
-	if(messageWindow_)
+	if(messageWindow_) {
 		hideMessage();
+		messageWindow_ = nullptr;
+	}
 
 	if(font_)
-		::DeleteObject(font_);
+		FontCache::instance().release(font_);
 }
 
 // virtual
@@ -229,11 +230,14 @@ void TextService::onLangProfileDeactivated(REFIID lang) {
 }
 
 void TextService::createCandidateWindow(Ime::EditSession* session) {
+	// the candidate window is kept after being hidden and reused for later compositions.
 	if (!candidateWindow_) {
 		candidateWindow_ = new Ime::CandidateWindow(this, session); // assigning to smart ptr also inrease ref count
 		candidateWindow_->Release();  // decrease ref count caused by new
 
 		candidateWindow_->setFont(font_);
+	}
+	if (!validCandidateListElementId_) {
 		Ime::ComQIPtr<ITfUIElementMgr> elementMgr = threadMgr();
 		if (elementMgr) {
 			BOOL pbShow = false;
@@ -245,27 +249,30 @@ void TextService::createCandidateWindow(Ime::EditSession* session) {
 	}
 }
 
+// apply changes of the font settings or screen DPI to the candidate and message windows
+void TextService::applyFontChanges() {
+	FontCache& fontCache = FontCache::instance();
+	int dpi = fontCache.dpi();
+	if (!updateFont_ && dpi == fontDpi_)
+		return;
+	HFONT oldFont = font_;
+	font_ = fontCache.acquire(candFontName_, candFontSize_);
+	fontDpi_ = dpi;
+	if (messageWindow_)
+		messageWindow_->setFont(font_);
+	if (candidateWindow_)
+		candidateWindow_->setFont(font_);
+	if (oldFont)
+		fontCache.release(oldFont); // release old font after no windows are using it
+	updateFont_ = false;
+}
+
 void TextService::updateCandidates(Ime::EditSession* session) {
 	createCandidateWindow(session);
 	candidateWindow_->clear();
 
-	// FIXME: is this the right place to do it?
-	if (updateFont_) {
-		// font for candidate and mesasge windows
-		LOGFONT lf;
-		GetObject(font_, sizeof(lf), &lf);
-		::DeleteObject(font_); // delete old font
-		lf.lfHeight = candFontHeight(); // apply the new size
-		if (!candFontName_.empty()) { // apply new font name
-			wcsncpy(lf.lfFaceName, candFontName_.c_str(), 31);
-		}
-		font_ = CreateFontIndirect(&lf); // create new font
-		// if (messageWindow_)
-		//	messageWindow_->setFont(font_);
-		if (candidateWindow_)
-			candidateWindow_->setFont(font_);
-		updateFont_ = false;
-	}
+	// font changes are applied only when the window is going to be updated
+	applyFontChanges();
 
 	candidateWindow_->setUseCursor(candUseCursor_);
 	candidateWindow_->setCandPerRow(candPerRow_);
@@ -342,7 +349,14 @@ void TextService::hideCandidates() {
 		}
 	}
 	if (candidateWindow_) {
-		candidateWindow_ = nullptr;
+		if (isImmersive()) {
+			// in Windows store apps, the window is owned by the composition window of
+			// the current context, so it cannot be reused for later compositions.
+			candidateWindow_ = nullptr;
+		}
+		else {
+			candidateWindow_->hide();
+		}
 	}
 	showingCandidates_ = false;
 }
@@ -350,10 +364,20 @@ void TextService::hideCandidates() {
 // message window
 void TextService::showMessage(Ime::EditSession* session, std::wstring message, int duration) {
 	// remove previous message if there's any
-	hideMessage();
-	// FIXME: reuse the window whenever possible
-	messageWindow_ = make_unique<Ime::MessageWindow>(this, session);
-	messageWindow_->setFont(font_);
+	if (messageTimerId_) {
+		::KillTimer(messageWindow_->hwnd(), messageTimerId_);
+		messageTimerId_ = 0;
+	}
+	// the message window is kept after being hidden and reused for later messages.
+	if (messageWindow_ && isImmersive()) {
+		// in Windows store apps, the window is owned by the composition window of the current context
+		messageWindow_ = nullptr;
+	}
+	if (!messageWindow_) {
+		messageWindow_ = make_unique<Ime::MessageWindow>(this, session);
+		messageWindow_->setFont(font_);
+	}
+	applyFontChanges();
 	messageWindow_->setText(message);
 	
 	int x = 0, y = 0;
@@ -387,7 +411,10 @@ void TextService::hideMessage() {
 		messageTimerId_ = 0;
 	}
 	if(messageWindow_) {
-		messageWindow_ = nullptr;
+		if (isImmersive())
+			messageWindow_ = nullptr;
+		else
+			messageWindow_->hide();
 	}
 }
 
@@ -410,17 +437,6 @@ void CALLBACK TextService::onMessageTimeout(HWND hwnd, UINT msg, UINT_PTR id, DW
 void TextService::updateLangButtons() {
 }
 
-int TextService::candFontHeight() {
-	int candFontHeight_ = candFontSize_;
-	HDC hdc = GetDC(NULL);
-	if (hdc)
-	{
-		candFontHeight_ = -MulDiv(candFontSize_, GetDeviceCaps(hdc, LOGPIXELSY), 72);
-		ReleaseDC(NULL, hdc);
-	}
-	return candFontHeight_;
-}
-
 void TextService::closeClient() {
 	// deactive currently active language profile
 	if (client_) {
@@ -430,6 +446,8 @@ void TextService::closeClient() {
 		// detroy UI resources
 		hideMessage();
 		hideCandidates();
+		messageWindow_ = nullptr;
+		candidateWindow_ = nullptr;
 	}
 }
 
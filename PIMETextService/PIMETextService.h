@@ -28,6 +28,7 @@
 #include "PIMEImeModule.h"
 #include <sys/types.h>
 #include "PIMEClient.h"
+#include "PIMEFontCache.h"
 #include <memory>
 
 
@@ -144,7 +145,7 @@ private:
 	void updateLangButtons(); // update status of language bar buttons
 
 	void createCandidateWindow(Ime::EditSession* session);
-	int candFontHeight();
+	void applyFontChanges();
 
 	void closeClient();
 
@@ -156,8 +157,10 @@ private:
 	std::vector<std::wstring> candidates_; // current candidate list
 	std::unique_ptr<Ime::MessageWindow> messageWindow_;
 	UINT messageTimerId_;
-	HFONT font_;
+	HFONT font_; // shared font from FontCache
+	int fontDpi_; // screen DPI when font_ is created
 	bool updateFont_;
+	DisplayChangeListener displayChangeListener_;
 	int candPerRow_;
 	std::wstring selKeys_;
 	bool candUseCursor_;
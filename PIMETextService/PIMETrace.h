@@ -0,0 +1,223 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+#ifndef _PIME_TRACE_H_
+#define _PIME_TRACE_H_
+
+// Lightweight tracing of requests shared by PIMETextService and PIMELauncher.
+// Events are identified by the client session and the sequence number of the request, and are
+// recorded into a lock-free ring buffer owned by the recording thread. A collector drains the
+// buffers of all threads later. When tracing is disabled, recording costs one relaxed atomic load.
+// Timestamps are in microseconds of the performance counter, which is shared by all processes.
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <chrono>
+#include <functional>
+#include <thread>
+#endif
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace PIME {
+namespace Trace {
+
+struct Event {
+	const char* name;  // must be a string literal
+	uint64_t context;  // the client session of the request
+	uint32_t seqNum;
+	uint32_t threadId;
+	uint64_t begin;
+	uint64_t end;
+};
+
+// current monotonic time in microseconds
+inline uint64_t now() {
+#ifdef _WIN32
+	static const uint64_t frequency = [] {
+		LARGE_INTEGER freq;
+		::QueryPerformanceFrequency(&freq);
+		return static_cast<uint64_t>(freq.QuadPart);
+	}();
+	LARGE_INTEGER counter;
+	::QueryPerformanceCounter(&counter);
+	uint64_t ticks = static_cast<uint64_t>(counter.QuadPart);
+	return (ticks / frequency) * 1000000 + (ticks % frequency) * 1000000 / frequency;
+#else
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+inline uint32_t currentThreadId() {
+#ifdef _WIN32
+	return ::GetCurrentThreadId();
+#else
+	return static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+}
+
+inline std::atomic<bool>& enabledFlag() {
+	static std::atomic<bool> flag{ false };
+	return flag;
+}
+
+inline bool enabled() {
+	return enabledFlag().load(std::memory_order_relaxed);
+}
+
+inline void setEnabled(bool enable) {
+	enabledFlag().store(enable, std::memory_order_relaxed);
+}
+
+// Single producer single consumer ring buffer of events.
+// The owning thread pushes events, and the collector pops them. Events are dropped when it's full.
+class Ring {
+public:
+	static constexpr size_t CAPACITY = 4096;  // must be a power of 2
+
+	Ring() : head_(0), tail_(0), threadId_(currentThreadId()), events_(CAPACITY) {
+	}
+
+	void push(const char* name, uint64_t context, uint32_t seqNum, uint64_t begin, uint64_t end) {
+		size_t tail = tail_.load(std::memory_order_relaxed);
+		if (tail - head_.load(std::memory_order_acquire) >= CAPACITY)
+			return;
+		Event& event = events_[tail & (CAPACITY - 1)];
+		event.name = name;
+		event.context = context;
+		event.seqNum = seqNum;
+		event.threadId = threadId_;
+		event.begin = begin;
+		event.end = end;
+		tail_.store(tail + 1, std::memory_order_release);
+	}
+
+	// move all events to output, returns the number of events moved
+	size_t pop(std::vector<Event>& output) {
+		size_t head = head_.load(std::memory_order_relaxed);
+		size_t tail = tail_.load(std::memory_order_acquire);
+		for (size_t i = head; i != tail; ++i) {
+			output.push_back(events_[i & (CAPACITY - 1)]);
+		}
+		head_.store(tail, std::memory_order_release);
+		return tail - head;
+	}
+
+private:
+	std::atomic<size_t> head_;
+	std::atomic<size_t> tail_;
+	uint32_t threadId_;
+	std::vector<Event> events_;
+};
+
+// rings of all threads which ever recorded an event
+class Registry {
+public:
+	static Registry& instance() {
+		static Registry registry;
+		return registry;
+	}
+
+	// ring of the calling thread, registered when an event is recorded the first time
+	Ring& threadRing() {
+		thread_local std::shared_ptr<Ring> ring;
+		if (!ring) {
+			ring = std::make_shared<Ring>();
+			std::lock_guard<std::mutex> lock(mutex_);
+			rings_.push_back(ring);
+		}
+		return *ring;
+	}
+
+	// collect events of all threads, rings of exited threads are released once drained.
+	size_t drain(std::vector<Event>& output) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		size_t count = 0;
+		for (auto it = rings_.begin(); it != rings_.end();) {
+			count += (*it)->pop(output);
+			if (it->use_count() == 1)  // the thread is gone
+				it = rings_.erase(it);
+			else
+				++it;
+		}
+		return count;
+	}
+
+private:
+	std::mutex mutex_;
+	std::vector<std::shared_ptr<Ring>> rings_;
+};
+
+inline void record(const char* name, uint64_t context, uint32_t seqNum, uint64_t begin, uint64_t end) {
+	Registry::instance().threadRing().push(name, context, seqNum, begin, end);
+}
+
+// record the time spent in a scope if tracing is enabled
+class Scope {
+public:
+	Scope(const char* name, uint64_t context, uint32_t seqNum) :
+		name_(name), context_(context), seqNum_(seqNum), begin_(enabled() ? now() : 0) {
+	}
+
+	~Scope() {
+		if (begin_ != 0)
+			record(name_, context_, seqNum_, begin_, now());
+	}
+
+private:
+	const char* name_;
+	uint64_t context_;
+	uint32_t seqNum_;
+	uint64_t begin_;
+};
+
+// append events as a JSON array: [[threadId, "name", context, seqNum, begin, end], ...]
+inline void appendJson(std::string& output, const std::vector<Event>& events) {
+	output += '[';
+	for (size_t i = 0; i < events.size(); ++i) {
+		const Event& event = events[i];
+		if (i > 0)
+			output += ',';
+		output += '[';
+		output += std::to_string(event.threadId);
+		output += ",\"";
+		output += event.name;
+		output += "\",";
+		output += std::to_string(event.context);
+		output += ',';
+		output += std::to_string(event.seqNum);
+		output += ',';
+		output += std::to_string(event.begin);
+		output += ',';
+		output += std::to_string(event.end);
+		output += ']';
+	}
+	output += ']';
+}
+
+} // namespace Trace
+} // namespace PIME
+
+#endif // _PIME_TRACE_H_
@@ -12,6 +12,13 @@ if (services.length == 0) {
   process.exit(1);
 }
 
+// Input methods to load in advance are passed by PIMELauncher in a comma separated list.
+// All services are already loaded above, so just report the ones found.
+(process.env.PIME_PRELOAD || '').split(',').filter((guid) => guid).forEach((guid) => {
+  let found = services.some((service) => service['guid'].toLowerCase() === guid.toLowerCase());
+  process.stdout.write(`PIME_READY|${guid}|${JSON.stringify({success: found, time: 0})}\n`);
+});
+
 let server = NIME.createServer((request) => {
 
   let service = null;
@@ -27,6 +27,8 @@ import winsound
 import threading
 from ctypes import windll
 from .cin import Cin
+from . import tableregistry
+from . import frequency
 from .rcin import RCin
 from .hcin import HCin
 from .swkb import swkb
@@ -35,7 +37,6 @@ from .dsymbols import dsymbols
 from .fsymbols import fsymbols
 from .msymbols import msymbols
 from .flangs import flangs
-from .phrase import phrase
 from .userphrase import userphrase
 from .emoji import emoji
 from .extendtable import extendtable
@@ -85,6 +86,13 @@ class CinBase:
     def initTextService(self, cbTS, TextService):
         cbTS.TextService = TextService
         cbTS.TextService.setSelKeys(cbTS, self.candselKeys)
+        # 讓 TextService 在每次回應時詢問 client 端是否可自行顯示下一個字根
+        cbTS.canEchoLocally = lambda: self.canEchoLocally(cbTS)
+        # 預先載入輸入法時，等待背景執行緒載入碼表
+        cbTS.waitUntilReady = lambda: self.waitUntilReady(cbTS)
+        cbTS.localEcho = False
+        # 候選清單可多達 candMaxItems 個，改以共享記憶體傳給 client 端
+        cbTS.enableSharedCandidates()
         # 使用 OpenCC 繁體中文轉簡體
         cbTS.opencc = None
 
@@ -108,6 +116,8 @@ class CinBase:
         cbTS.easySymbolsWithShift = False
         cbTS.showPhrase = False
         cbTS.sortByPhrase = False
+        cbTS.sortByFrequency = False
+        cbTS.frequency = None
         cbTS.compositionBufferMode = False
         cbTS.autoMoveCursorInBrackets = False
         cbTS.imeReverseLookup = False
@@ -259,6 +269,10 @@ class CinBase:
             type = "menu"
         )
 
+        # 字根直接由 client 端顯示於編輯區，不等待輸入法回應
+        if cbTS.localEcho and hasattr(cbTS, 'cin'):
+            cbTS.setLocalEchoKeys(self.getLocalEchoKeys(cbTS))
+
 
     # 使用者離開輸入法
     def onDeactivate(self, cbTS):
@@ -269,6 +283,8 @@ class CinBase:
         cbTS.removeButton("switch-lang")
         cbTS.removeButton("switch-shape")
         cbTS.removeButton("settings")
+        if cbTS.localEchoKeys:
+            cbTS.setLocalEchoKeys(None)
         if cbTS.client.isWindows8Above:
             cbTS.removeButton("windows-mode-icon")
 
@@ -411,6 +427,50 @@ class CinBase:
             cbTS.hideMessageOnKeyUp = True
         return False
 
+    # 可由 client 端自行顯示的字根: 只包含英文字母，且不含萬用字元
+    def getLocalEchoKeys(self, cbTS):
+        keys = {}
+        for key in "abcdefghijklmnopqrstuvwxyz":
+            if key != cbTS.selWildcardChar and cbTS.cin.isInKeyName(key):
+                keys[key] = cbTS.cin.getKeyName(key)
+        return keys
+
+
+    # 等待碼表載入完成
+    def waitUntilReady(self, cbTS):
+        cinLoader = getattr(cbTS, "cinLoader", None)
+        if cinLoader:
+            cinLoader.join()
+
+
+    # 目前組字字根的游標，每多打一個字根只需前進一個 trie 節點
+    def getKeyCursor(self, cbTS):
+        cursor = getattr(cbTS, "keyCursor", None)
+        if cursor is None or cursor.cin is not cbTS.cin:
+            cursor = cbTS.keyCursor = cbTS.cin.keyCursor()
+        return cursor.moveTo(cbTS.compositionChar)
+
+
+    # 下一個字根鍵是否只會將字根加到編輯區的結尾
+    # 只在最單純的組字狀態回傳 True，其他模式一律由輸入法處理
+    def canEchoLocally(self, cbTS):
+        if not cbTS.localEcho or not hasattr(cbTS, 'cin'):
+            return False
+        if cbTS.langMode != CHINESE_MODE or cbTS.shapeMode != HALFSHAPE_MODE or cbTS.keyboardLayout != 0:
+            return False
+        if cbTS.imeDirName in ("chephonetic", "chepinyin", "chedayi"):
+            return False
+        if cbTS.compositionBufferMode or cbTS.autoClearCompositionChar or cbTS.capsStates:
+            return False
+        if cbTS.showCandidates or cbTS.isShowPhraseCandidates or cbTS.tempEnglishMode:
+            return False
+        if not cbTS.closemenu or cbTS.menumode or cbTS.multifunctionmode or cbTS.menusymbolsmode:
+            return False
+        if cbTS.ctrlsymbolsmode or cbTS.dayisymbolsmode or cbTS.selcandmode or cbTS.phrasemode or cbTS.homophonemode:
+            return False
+        return len(cbTS.compositionChar) < cbTS.maxCharLength
+
+
     def onKeyDown(self, cbTS, keyEvent, CinTable, RCinTable, HCinTable):
         charCode = keyEvent.charCode
         keyCode = keyEvent.keyCode
@@ -1433,17 +1493,17 @@ class CinBase:
 
             if cbTS.homophoneQuery and cbTS.homophonemode and cbTS.homophoneChar == cbTS.compositionChar:
                 candidates = cbTS.homophonecandidates
-            elif cbTS.cin.isInCharDef(cbTS.compositionChar) and cbTS.closemenu and not cbTS.ctrlsymbolsmode and not cbTS.dayisymbolsmode:
+            elif self.getKeyCursor(cbTS).isKey() and cbTS.closemenu and not cbTS.ctrlsymbolsmode and not cbTS.dayisymbolsmode:
                 candidates = cbTS.cin.getCharDef(cbTS.compositionChar)
-                if cbTS.sortByPhrase and candidates:
-                    candidates = self.sortByPhrase(cbTS, copy.deepcopy(candidates))
+                if (cbTS.sortByPhrase or cbTS.sortByFrequency) and candidates:
+                    candidates = self.sortCandidates(cbTS, cbTS.cin.getMutableCharDef(cbTS.compositionChar))
                 if cbTS.compositionBufferMode and not cbTS.selcandmode:
                     cbTS.compositionBufferType = "default"
             elif cbTS.imeDirName == "chepinyin" and cbTS.cinFileList[cbTS.cfg.selCinType] == "thpinyin.json" and not cbTS.ctrlsymbolsmode:
                 if cbTS.cin.isInCharDef(cbTS.compositionChar + "1") and cbTS.closemenu and not cbTS.ctrlsymbolsmode:
                     candidates = cbTS.cin.getCharDef(cbTS.compositionChar + '1')
-                    if cbTS.sortByPhrase and candidates:
-                        candidates = self.sortByPhrase(cbTS, copy.deepcopy(candidates))
+                    if (cbTS.sortByPhrase or cbTS.sortByFrequency) and candidates:
+                        candidates = self.sortCandidates(cbTS, cbTS.cin.getMutableCharDef(cbTS.compositionChar + '1'))
                     if cbTS.compositionBufferMode and not cbTS.selcandmode:
                         cbTS.compositionBufferType = "default"
             elif cbTS.fullShapeSymbols and cbTS.fsymbols.isInCharDef(cbTS.compositionChar) and cbTS.closemenu:
@@ -1478,8 +1538,9 @@ class CinBase:
                     if cbTS.compositionBufferMode and not cbTS.selcandmode:
                         cbTS.compositionBufferType = "default"
                 cbTS.isWildcardChardefs = True
+                # getWildcardCharDefs() 每次都產生新的 list，可以直接重新排列
                 if cbTS.sortByPhrase and candidates:
-                    candidates = self.sortByPhrase(cbTS, copy.deepcopy(candidates))
+                    candidates = self.sortByPhrase(cbTS, candidates)
 
         # 組字編輯模式
         if cbTS.compositionBufferMode and cbTS.isComposing() and cbTS.compositionChar == "" and cbTS.closemenu and not cbTS.multifunctionmode and not cbTS.phrasemode and not cbTS.selcandmode:
@@ -1580,15 +1641,15 @@ class CinBase:
                         if cbTS.cin.isInCharDef(sellist[1]):
                             cbTS.compositionChar = sellist[1]
                             candidates = cbTS.cin.getCharDef(sellist[1])
-                            if cbTS.sortByPhrase and candidates:
-                                candidates = self.sortByPhrase(cbTS, copy.deepcopy(candidates))
+                            if (cbTS.sortByPhrase or cbTS.sortByFrequency) and candidates:
+                                candidates = self.sortCandidates(cbTS, cbTS.cin.getMutableCharDef(sellist[1]))
                             cbTS.selcandmode = True
                     else:
                         if cbTS.cin.isHaveKey(cbTS.compositionBufferString[cbTS.compositionBufferCursor]):
                             cbTS.compositionChar = cbTS.cin.getKey(cbTS.compositionBufferString[cbTS.compositionBufferCursor])
                             candidates = cbTS.cin.getCharDef(cbTS.compositionChar)
-                            if cbTS.sortByPhrase and candidates:
-                                candidates = self.sortByPhrase(cbTS, copy.deepcopy(candidates))
+                            if (cbTS.sortByPhrase or cbTS.sortByFrequency) and candidates:
+                                candidates = self.sortCandidates(cbTS, cbTS.cin.getMutableCharDef(cbTS.compositionChar))
                             cbTS.selcandmode = True
                         else:
                             cbTS.selcandmode = False
@@ -1631,8 +1692,8 @@ class CinBase:
                                 cbTS.setCompositionCursor(len(cbTS.compositionString))
                             if cbTS.cin.isInCharDef(cbTS.compositionChar):
                                 candidates = cbTS.cin.getCharDef(cbTS.compositionChar)
-                                if cbTS.sortByPhrase and candidates:
-                                    candidates = self.sortByPhrase(cbTS, copy.deepcopy(candidates))
+                                if (cbTS.sortByPhrase or cbTS.sortByFrequency) and candidates:
+                                    candidates = self.sortCandidates(cbTS, cbTS.cin.getMutableCharDef(cbTS.compositionChar))
                 # 如果是碼表標點
                 if cbTS.cin.isInKeyName(cbTS.compositionChar[0]):
                     if cbTS.cin.getKeyName(cbTS.compositionChar[0]) in cbTS.directCommitSymbolList:
@@ -1656,8 +1717,8 @@ class CinBase:
                                     cbTS.setCompositionCursor(len(cbTS.compositionString))
                             if cbTS.cin.isInCharDef(cbTS.compositionChar):
                                 candidates = cbTS.cin.getCharDef(cbTS.compositionChar)
-                                if cbTS.sortByPhrase and candidates:
-                                    candidates = self.sortByPhrase(cbTS, copy.deepcopy(candidates))
+                                if (cbTS.sortByPhrase or cbTS.sortByFrequency) and candidates:
+                                    candidates = self.sortCandidates(cbTS, cbTS.cin.getMutableCharDef(cbTS.compositionChar))
 
             if cbTS.langMode == CHINESE_MODE and cbTS.dayisymbolsmode and len(cbTS.compositionChar) == 1 and (keyCode == VK_SPACE or keyCode == VK_RETURN):
                 candidates = cbTS.cin.getCharDef(cbTS.compositionChar)
@@ -2042,18 +2103,7 @@ class CinBase:
             if self.isNumberChar(keyCode) and keyEvent.isKeyDown(VK_SHIFT) and not cbTS.imeDirName == "chedayi":
                 charCode = keyCode
                 charStr = chr(charCode)
-            phrasecandidates = []
-            if cbTS.userphrase.isInCharDef(cbTS.lastCommitString):
-                phrasecandidates = cbTS.userphrase.getCharDef(cbTS.lastCommitString)
-            if PhraseData.phrase.isInCharDef(cbTS.lastCommitString):
-                if len(phrasecandidates) == 0:
-                    phrasecandidates = PhraseData.phrase.getCharDef(cbTS.lastCommitString)
-                else:
-                    if not cbTS.isShowPhraseCandidates:
-                        plist = PhraseData.phrase.getCharDef(cbTS.lastCommitString)
-                        for pstr in plist:
-                            if not pstr in phrasecandidates:
-                                phrasecandidates.append(pstr)
+            phrasecandidates = PhraseData.phrase.getPhrases(cbTS.lastCommitString, cbTS.userphrase, cbTS.isShowPhraseCandidates)
 
             if phrasecandidates:
                 candCursor = cbTS.candidateCursor  # 目前的游標位置
@@ -2190,8 +2240,8 @@ class CinBase:
                             if cbTS.directShowCand and not cbTS.dayisymbolsmode:
                                 if cbTS.cin.isInCharDef(cbTS.compositionChar):
                                     candidates = cbTS.cin.getCharDef(cbTS.compositionChar)
-                                    if cbTS.sortByPhrase and candidates:
-                                        candidates = self.sortByPhrase(cbTS, copy.deepcopy(candidates))
+                                    if (cbTS.sortByPhrase or cbTS.sortByFrequency) and candidates:
+                                        candidates = self.sortCandidates(cbTS, cbTS.cin.getMutableCharDef(cbTS.compositionChar))
                                 if candidates:
                                     pagecandidates = list(self.chunks(candidates, cbTS.candPerPage))
                                     cbTS.setCandidateList(pagecandidates[currentCandPage])
@@ -2734,28 +2784,23 @@ class CinBase:
             charStr = chr(charCode)
         return charStr
 
-    def sortByPhrase(self, cbTS, candidates):
-        sortbyphraselist = []
-        if cbTS.userphrase.isInCharDef(cbTS.lastCommitString):
-            sortbyphraselist = cbTS.userphrase.getCharDef(cbTS.lastCommitString)
-        if PhraseData.phrase.isInCharDef(cbTS.lastCommitString):
-            if len(sortbyphraselist) == 0:
-                sortbyphraselist = PhraseData.phrase.getCharDef(cbTS.lastCommitString)
-            else:
-                plist = PhraseData.phrase.getCharDef(cbTS.lastCommitString)
-                for pstr in plist:
-                    if not pstr in sortbyphraselist:
-                        sortbyphraselist.append(pstr)
-
-        i = 0
-        if len(sortbyphraselist) > 0:
-            for pStr in sortbyphraselist:
-                if pStr in candidates:
-                    candidates.remove(pStr)
-                    candidates.insert(i, pStr)
-                    i += 1
+    # 依選字次數及聯想字詞重新排列候選字，candidates 會直接被修改
+    # 聯想字詞和前一個輸出的字有關，所以排在常用的字之前
+    def sortCandidates(self, cbTS, candidates):
+        if cbTS.sortByFrequency:
+            store = self.getFrequencyStore(cbTS)
+            if store is not None:
+                store.sortCandidates(cbTS.compositionChar, candidates)
+        if cbTS.sortByPhrase:
+            self.sortByPhrase(cbTS, candidates)
         return candidates
 
+    # 依聯想字詞重新排列候選字，candidates 會直接被修改
+    def sortByPhrase(self, cbTS, candidates):
+        if PhraseData.phrase is None:
+            return candidates
+        return PhraseData.phrase.sortCandidates(cbTS.lastCommitString, candidates, cbTS.userphrase)
+
     # List 分段
     def chunks(self, l, n):
         for i in range(0, len(l), n):
@@ -2804,7 +2849,19 @@ class CinBase:
         cbTS.setCompositionString(cbTS.compositionBufferString)
         cbTS.setCompositionCursor(cbTS.compositionBufferCursor)
 
+    # 選字次數檔 (frequency.dat)，同一個輸入法的 TextService 共用
+    def getFrequencyStore(self, cbTS):
+        if cbTS.frequency is None:
+            cbTS.frequency = frequency.openStore(os.path.join(cbTS.cfg.getConfigDir(), "frequency.dat"))
+        return cbTS.frequency
+
     def setOutputString(self, cbTS, RCinTable, commitStr):
+        # 記錄選字次數，萬用字元及同音字的候選字不是用目前的字根查到的
+        if cbTS.sortByFrequency and cbTS.compositionChar and not cbTS.isWildcardChardefs and not cbTS.isHomophoneChardefs:
+            store = self.getFrequencyStore(cbTS)
+            if store is not None:
+                store.record(cbTS.compositionChar, commitStr)
+
         # 如果使用萬用字元解碼
         if cbTS.isWildcardChardefs:
             if not cbTS.client.isUiLess:
@@ -3084,6 +3141,9 @@ class CinBase:
         # 優先以聯想字詞排序候選清單?
         cbTS.sortByPhrase = cfg.sortByPhrase
 
+        # 依選字次數排序候選清單?
+        cbTS.sortByFrequency = cfg.sortByFrequency
+
         # 拆錯字碼時自動清除輸入字串?
         cbTS.autoClearCompositionChar = cfg.autoClearCompositionChar
 
@@ -3136,6 +3196,9 @@ class CinBase:
         # 訊息顯示時間?
         cbTS.messageDurationTime = cfg.messageDurationTime
 
+        # 字根直接顯示於編輯區 (不等待輸入法回應)?
+        cbTS.localEcho = cfg.localEcho
+
         if cbTS.imeDirName == "chedayi":
             cbTS.selDayiSymbolCharType = cfg.selDayiSymbolCharType
 
@@ -3146,6 +3209,7 @@ class CinBase:
         cfg.update() # 更新設定檔狀態
         reLoadCinTable = False
         updateExtendTable = False
+        applyExtendTable = False
 
         if hasattr(cbTS, 'cin'):
             if hasattr(cbTS.cin, 'cincount'):
@@ -3160,19 +3224,17 @@ class CinBase:
             if not CinTable.ignorePrivateUseArea == cfg.ignorePrivateUseArea:
                 reLoadCinTable = True
 
+            # 擴展碼表在查詢時才合併 (ExtendedCharDefs)，修改或切換擴展碼表不需重新載入碼表
             if cfg.reLoadTable:
                 updateExtendTable = True
-                reLoadCinTable = True
                 cfg.reLoadTable = False
                 cfg.save()
 
             if not CinTable.userExtendTable == cfg.userExtendTable:
                 updateExtendTable = True
-                reLoadCinTable = True
 
             if not CinTable.priorityExtendTable == cfg.priorityExtendTable:
-                if cfg.userExtendTable:
-                    reLoadCinTable = True
+                applyExtendTable = True
 
         if cfg.imeReverseLookup or cbTS.imeReverseLookup:
             # 載入反查輸入法碼表
@@ -3196,7 +3258,7 @@ class CinBase:
             # 只有偵測到設定檔變更，需要套用新設定
             self.applyConfig(cbTS)
 
-        if reLoadCinTable or updateExtendTable:
+        if reLoadCinTable or updateExtendTable or applyExtendTable:
             datadirs = (cfg.getConfigDir(), cfg.getDataDir())
             if updateExtendTable:
                 if hasattr(cbTS, 'extendtable'):
@@ -3236,16 +3298,17 @@ class LoadPhraseData(threading.Thread):
     def run(self):
         self.PhraseData.loading = True
         cfg = self.cbTS.cfg
-        datadirs = (cfg.getConfigDir(), cfg.getDataDir())
 
         if hasattr(self.PhraseData.phrase, '__del__'):
             self.PhraseData.phrase.__del__()
 
         self.PhraseData.phrase = None
 
-        phrasePath = cfg.findFile(datadirs, "phrase.json")
-        with io.open(phrasePath, 'r', encoding='utf8') as fs:
-            self.PhraseData.phrase = phrase(fs)
+        # 使用者設定目錄中的 phrase.json 優先，否則載入內建的聯想字詞庫 (data/phrase.cin 編譯成的 bin/phrase.bin)
+        phrasePath = cfg.findFile((cfg.getConfigDir(),), "phrase.json")
+        if phrasePath is None:
+            phrasePath = os.path.join(cfg.getDataDir(), "phrase.cin")
+        self.PhraseData.phrase = tableregistry.openPhrase(phrasePath)
         self.PhraseData.loading = False
 
 
@@ -3254,12 +3317,14 @@ class LoadCinTable(threading.Thread):
         threading.Thread.__init__(self)
         self.cbTS = cbTS
         self.CinTable = CinTable
+        # 在建立執行緒時就標記為載入中，避免其他 TextService 在執行緒開始前重複載入碼表
+        self.CinTable.loading = True
+        cbTS.cinLoader = self
 
     def run(self):
         if DEBUG_MODE:
             self.cbTS.debug.setStartTimer("LoadCinTable")
 
-        self.CinTable.loading = True
         if self.cbTS.cfg.selCinType >= len(self.cbTS.cinFileList):
             self.cbTS.cfg.selCinType = 0
         selCinFile = self.cbTS.cinFileList[self.cbTS.cfg.selCinType]
@@ -3276,10 +3341,13 @@ class LoadCinTable(threading.Thread):
             self.cbTS.cin = None
             self.CinTable.cin = None
 
-            with io.open(jsonPath, 'r', encoding='utf8') as fs:
-                self.cbTS.cin = Cin(fs, self.cbTS.imeDirName, self.cbTS.ignorePrivateUseArea)
+            # 碼表由 tableregistry 在整個程序只載入一次，所有輸入法共用 (有編譯過的碼表時以 mmap 載入)
+            self.cbTS.cin = tableregistry.openCin(jsonPath, self.cbTS.imeDirName, self.cbTS.ignorePrivateUseArea)
             self.CinTable.cin = self.cbTS.cin
             self.CinTable.curCinType = self.cbTS.cfg.selCinType
+        elif self.CinTable.cin is not None:
+            # 只更新擴展碼表時，套用到所有 TextService 共用的碼表
+            self.cbTS.cin = self.CinTable.cin
 
         if not hasattr(self.cbTS, 'extendtable'):
             if self.cbTS.cfg.userExtendTable:
@@ -3329,10 +3397,9 @@ class LoadRCinTable(threading.Thread):
 
         self.RCinTable.cin = None
 
-        if os.path.exists(jsonPath):
+        if os.path.exists(tableregistry.getTablePath(jsonPath)):
             self.cbTS.RCinFileNotExist = False
-            with io.open(jsonPath, 'r', encoding='utf8') as fs:
-                self.RCinTable.cin = RCin(fs, self.cbTS.imeDirName)
+            self.RCinTable.cin = tableregistry.openRCin(jsonPath, self.cbTS.imeDirName)
         else:
             self.cbTS.RCinFileNotExist = True
             
@@ -3363,8 +3430,7 @@ class LoadHCinTable(threading.Thread):
 
         self.HCinTable.cin = None
 
-        with io.open(jsonPath, 'r', encoding='utf8') as fs:
-            self.HCinTable.cin = HCin(fs, self.cbTS.imeDirName)
+        self.HCinTable.cin = tableregistry.openHCin(jsonPath, self.cbTS.imeDirName)
         self.HCinTable.curCinType = self.cbTS.cfg.selHCinType
         self.HCinTable.loading = False
 
@@ -4,6 +4,7 @@ import os
 import re
 import json
 import copy
+from collections.abc import Mapping
 
 
 class Cin(object):
@@ -47,29 +48,36 @@ class Cin(object):
         self.charsetRange['cjkCId'] = [int('0xFA2E', 16), int('0xFB00', 16)]
         self.charsetRange['cjkCIS'] = [int('0x2F800', 16), int('0x2FA20', 16)]
 
-        self.__dict__.update(json.load(fs))
+        self.load(fs)
+        # 碼表本身的 chardefs，擴展碼表只在查詢時合併，不會修改它
+        self.basechardefs = self.chardefs
+        self.saveCountFile()
 
-        if self.ignorePrivateUseArea:
-            for key in self.privateuse:
-                newvalue = list(self.chardefs[key])
-                for value in self.privateuse[key]:
-                    if value in newvalue:
-                        newvalue.remove(value)
-                self.chardefs[key] = newvalue
 
-        self.saveCountFile()
+    # 載入 json 格式的碼表，NativeCin 改為使用編譯過的碼表
+    # fs 也可以是 TableRegistry 載入的共用碼表 (SharedTable)，已依 ignorePrivateUseArea 過濾
+    def load(self, fs):
+        if hasattr(fs, "read"):
+            self.__dict__.update(json.load(fs))
+            if self.ignorePrivateUseArea:
+                self.chardefs = PrivateUseCharDefs(self.chardefs, self.privateuse)
+        else:
+            self.__dict__.update(fs.fields)
+            self.chardefs = fs.chardefs
 
 
     def __del__(self):
         del self.keynames
         del self.cincount
         del self.chardefs
+        del self.basechardefs
         del self.privateuse
         del self.dupchardefs
 
         self.keynames = {}
         self.cincount = {}
         self.chardefs = {}
+        self.basechardefs = {}
         self.privateuse = {}
         self.dupchardefs = {}
 
@@ -113,6 +121,12 @@ class Cin(object):
         return self.chardefs[key]
 
 
+    # 可以直接重新排列的候選字 list (依選字次數或聯想字詞排序時使用)
+    # chardefs 的 list 是碼表本身的，而且由共用同一個碼表的輸入法共用，所以要複製一份
+    def getMutableCharDef(self, key):
+        return list(self.chardefs[key])
+
+
     def haveNextCharDef(self, key):
         chardefslist = []
         for chardef in self.chardefs:
@@ -123,17 +137,22 @@ class Cin(object):
         return chardefslist
 
 
+    # 組字字根的游標，每個 session 一個，NativeCin 改為使用編譯過碼表的 trie
+    def keyCursor(self):
+        return KeyCursor(self)
+
+
     def getWildcardCharDefs(self, CompositionChar, WildcardChar, candMaxItems):
         wildcardchardefs = []
         matchchardefs = {}
         lowFrequencyChardefs = {}
-        highFrequencyCharSetList = ["bopomofo", "bopomofoTone", "cjk", "big5F", "big5LF", "big5S"]
+        highFrequencyCharSetList = ["bopomofo", "bopomofoTone", "cjk", "big5F", "big5LF", "big5S", "big5Other"]
         lowFrequencyCharSetList = ["cjkExtA", "cjkExtB", "cjkExtC", "cjkExtD", "cjkExtE", "cjkExtF", "cjkCIibm", "pua", "cjkOther"]
 
         highFrequencyWordCount = 0
         lowFrequencyWordCount = 0
 
-        for i in range(7):
+        for i in range(len(lowFrequencyCharSetList)):
             lowFrequencyChardefs[i] = []
 
         keyLength = len(CompositionChar)
@@ -194,21 +213,13 @@ class Cin(object):
         return result
 
 
+    # 以 ExtendedCharDefs 在查詢時合併擴展碼表，碼表的 list 不會被修改
+    # 切換擴展碼表、優先順序或修改 extendtable.dat 時只需重新呼叫，不用重新載入碼表
     def updateCinTable(self, userExtendTable, priorityExtendTable, extendtable, ignorePrivateUseArea):
-        if userExtendTable:
-            for key in extendtable.chardefs:
-                for root in extendtable.chardefs[key]:
-                    if priorityExtendTable:
-                        i = extendtable.chardefs[key].index(root)
-                        try:
-                            self.chardefs[key.lower()].insert(i, root)
-                        except KeyError:
-                            self.chardefs[key.lower()] = [root]
-                    else:
-                        try:
-                            self.chardefs[key.lower()].append(root)
-                        except KeyError:
-                            self.chardefs[key.lower()] = [root]
+        if userExtendTable and extendtable.chardefs:
+            self.chardefs = ExtendedCharDefs(self.basechardefs, extendtable.chardefs, priorityExtendTable)
+        else:
+            self.chardefs = self.basechardefs
 
 
     def saveCountFile(self):
@@ -289,4 +300,165 @@ class Cin(object):
         return "cjkOther"
 
 
-__all__ = ["Cin"]
+class PrivateUseCharDefs(Mapping):
+    # 忽略 Unicode 私用區及 CJK 相容區的 chardefs，查詢時才濾掉 privateuse 中的字，不用複製整個碼表
+
+    def __init__(self, base, privateuse):
+        self.base = base
+        self.privateuse = privateuse
+        self.filtered = {}  # 已過濾過的字根
+
+
+    def __getitem__(self, key):
+        if key not in self.privateuse:
+            return self.base[key]
+        try:
+            return self.filtered[key]
+        except KeyError:
+            pass
+        values = list(self.base[key])
+        for value in self.privateuse[key]:
+            if value in values:
+                values.remove(value)
+        self.filtered[key] = values
+        return values
+
+
+    def __contains__(self, key):
+        return key in self.base
+
+
+    def __iter__(self):
+        return iter(self.base)
+
+
+    # isHaveKey() 等掃描整個碼表的查詢直接走訪 base，只替換含有私用區字的字根
+    def items(self):
+        privateuse = self.privateuse
+        for key, values in self.base.items():
+            yield key, self[key] if key in privateuse else values
+
+
+    def __len__(self):
+        return len(self.base)
+
+
+class ExtendedCharDefs(Mapping):
+    # 碼表 (base) 加上擴展碼表 (extend) 的 chardefs，base 保持不變，可與其他設定共用
+    # 擴展碼表的字串加在原有字串之後，優先載入時則插入到原有字串之前
+    # 擴展碼表新增的字根 (addedKeys) 排在碼表所有字根之後
+
+    def __init__(self, base, extend, priority):
+        self.base = base
+        self.extend = extend
+        self.priority = priority
+        self.addedKeys = [key for key in extend if key not in base]
+        self.merged = {}  # 已合併過的字根
+
+
+    def __getitem__(self, key):
+        if key not in self.extend:
+            return self.base[key]
+        try:
+            return self.merged[key]
+        except KeyError:
+            pass
+        values = list(self.base[key]) if key in self.base else []
+        roots = self.extend[key]
+        for root in roots:
+            if self.priority:
+                values.insert(roots.index(root), root)
+            else:
+                values.append(root)
+        self.merged[key] = values
+        return values
+
+
+    def __contains__(self, key):
+        return key in self.extend or key in self.base
+
+
+    def __iter__(self):
+        for key in self.base:
+            yield key
+        for key in self.addedKeys:
+            yield key
+
+
+    def __len__(self):
+        return len(self.base) + len(self.addedKeys)
+
+
+class KeyCursor(object):
+    # 目前的組字字根是否為字根、還有多少字根以它開頭
+    # json 碼表直接查 chardefs，cintable.NativeKeyCursor 則依打的字根逐一前進 trie 節點
+
+    def __init__(self, cin):
+        self.cin = cin
+        self.keys = ""
+
+
+    def moveTo(self, keys):
+        self.keys = keys
+        return self
+
+
+    def isKey(self):
+        return self.keys in self.cin.chardefs
+
+
+    # 以目前字根開頭的前 maxCount 個字根 (包含目前字根)
+    def getKeys(self, maxCount):
+        keys = []
+        for chardef in self.cin.chardefs:
+            if chardef.startswith(self.keys):
+                keys.append(chardef)
+                if len(keys) >= maxCount:
+                    break
+        return keys
+
+
+    # 再打字根還可能組成的字根數
+    def continuationCount(self):
+        count = len([chardef for chardef in self.cin.chardefs if chardef.startswith(self.keys)])
+        return count - 1 if self.isKey() else count
+
+
+    def hasContinuation(self):
+        return len(self.getKeys(2)) > (1 if self.isKey() else 0)
+
+
+def moveToFront(candidates, front):
+    """
+    把 front 中的候選字依序移到最前面，其餘候選字維持原來的順序
+    每個候選字只移動它第一次出現的位置，結果和依序 remove() 再 insert() 相同，但只需掃過候選字一次
+    front 中重複的字只算第一次，不在 candidates 之中的字則略過
+    candidates 會直接被重新排列，必須是呼叫者可以修改的 list
+    """
+    pending = {}  # 還沒找到的字 => 在 front 中的順序
+    for cand in front:
+        pending.setdefault(cand, len(pending))
+    moved = []  # (在 front 中的順序, 在 candidates 中的位置)
+    for i, cand in enumerate(candidates):
+        order = pending.pop(cand, None)
+        if order is not None:
+            moved.append((order, i))
+            if not pending:
+                break
+    if not moved:
+        return candidates
+
+    # last 之後的候選字位置不變，之前的候選字由後往前移到被移動的字之後，再把被移動的字放到最前面
+    last = moved[-1][1]
+    positions = set(i for order, i in moved)
+    values = [candidates[i] for order, i in sorted(moved)]
+    write = last
+    for read in range(last, -1, -1):
+        if read not in positions:
+            candidates[write] = candidates[read]
+            write -= 1
+    candidates[:len(values)] = values
+    return candidates
+
+
+__all__ = ["Cin", "PrivateUseCharDefs", "ExtendedCharDefs", "KeyCursor", "moveToFront"]
@@ -0,0 +1,417 @@
+from __future__ import print_function
+from __future__ import unicode_literals
+import os
+import sys
+import json
+from collections.abc import Mapping
+from ctypes import CDLL, c_void_p, c_char_p, c_int, c_uint, create_string_buffer, string_at
+
+from .cin import Cin, KeyCursor
+from .rcin import RCin
+from .hcin import HCin
+from .phrase import phrase
+
+# ctypes binding of PIMECinTable, the native reader of the compiled cin tables (bin/*.bin).
+# The tables are memory-mapped, so loading one takes a few milliseconds instead of parsing
+# the json file, and the pages are shared by all processes using the same table.
+# If the library or the compiled table is not available, cinbase loads the json tables instead.
+
+_lib = None
+try:
+    if sys.platform == "win32": # Windows
+        _lib = CDLL(os.path.join(os.path.dirname(__file__), "PIMECinTable.dll"))
+    else: # UNIX-like systems
+        _lib = CDLL(os.path.join(os.path.dirname(__file__), "libPIMECinTable.so"))
+except OSError:
+    pass
+
+if _lib:
+    _lib.cin_table_open.restype = c_void_p
+    _lib.cin_table_open.argtypes = [c_char_p]
+    _lib.cin_table_close.restype = None
+    _lib.cin_table_close.argtypes = [c_void_p]
+    _lib.cin_table_get_meta.argtypes = [c_void_p, c_int, c_char_p, c_int]
+    _lib.cin_table_key_count.argtypes = [c_void_p]
+    _lib.cin_table_has_key.argtypes = [c_void_p, c_char_p, c_int]
+    _lib.cin_table_get_values.argtypes = [c_void_p, c_char_p, c_int, c_int, c_char_p, c_int]
+    _lib.cin_table_get_key_name.argtypes = [c_void_p, c_char_p, c_int, c_char_p, c_int]
+    _lib.cin_table_get_keys.argtypes = [c_void_p, c_char_p, c_int]
+    _lib.cin_table_get_prefix_keys.argtypes = [c_void_p, c_char_p, c_int, c_int, c_char_p, c_int]
+    _lib.cin_table_find_keys_with_value.argtypes = [c_void_p, c_char_p, c_int, c_int, c_int, c_char_p, c_int]
+    _lib.cin_table_trie_root.argtypes = [c_void_p]
+    _lib.cin_table_trie_next.argtypes = [c_void_p, c_int, c_char_p, c_int]
+    _lib.cin_table_trie_is_key.argtypes = [c_void_p, c_int]
+    _lib.cin_table_trie_key_count.argtypes = [c_void_p, c_int]
+    _lib.cin_table_trie_get_keys.argtypes = [c_void_p, c_int, c_int, c_char_p, c_int]
+    _lib.cin_table_match_wildcard.argtypes = [c_void_p, c_char_p, c_int, c_char_p, c_int, c_int, c_int, c_char_p, c_int]
+    _lib.cin_char_set.argtypes = [c_uint]
+
+# fields of cin_table_get_meta()
+META_ENAME = 0
+META_CNAME = 1
+META_SELKEY = 2
+META_CINCOUNT = 3
+
+# flags
+SKIP_PRIVATE_USE = 1
+
+BUFFER_SIZE = 1024
+
+# names of the values of cin_char_set() (CinCharSet), as returned by Cin.getCharSet()
+CHARSET_NAMES = ["cjkOther", "bopomofo", "cjk", "big5F", "big5LF", "big5Other", "cjkExtA", "cjkExtB",
+                 "cjkExtC", "cjkExtD", "cjkExtE", "cjkExtF", "cjkCIibm", "pua"]
+
+
+def isAvailable():
+    return _lib is not None
+
+
+def getBinFile(jsonFile):
+    # the compiled table of json/xxx.json is bin/xxx.bin
+    name = os.path.splitext(os.path.basename(jsonFile))[0] + ".bin"
+    return os.path.join(os.path.dirname(__file__), "bin", name)
+
+
+def getCharSet(char):
+    # Cin.getCharSet() with the generated table of PIMECinTable
+    return CHARSET_NAMES[_lib.cin_char_set(ord(char))]
+
+
+def _call(func, *args):
+    # call a function writing '\0' terminated strings to a buffer, and returns the list of
+    # the strings, or None if the function returns -1.
+    buf = create_string_buffer(BUFFER_SIZE)
+    size = func(*args, buf, BUFFER_SIZE)
+    if size > BUFFER_SIZE:
+        buf = create_string_buffer(size)
+        size = func(*args, buf, size)
+    if size < 0:
+        return None
+    return string_at(buf, size).decode("utf-8").split("\0")[:-1]
+
+
+class CinTable(object):
+    # a compiled cin table opened by PIMECinTable
+
+    def __init__(self, path):
+        self.handle = _lib.cin_table_open(path.encode("utf-8"))
+        if not self.handle:
+            raise IOError("cannot open the compiled cin table " + path)
+
+    def __del__(self):
+        self.close()
+
+    def close(self):
+        if getattr(self, "handle", None):
+            _lib.cin_table_close(self.handle)
+            self.handle = None
+
+    def getMeta(self, field):
+        return _call(_lib.cin_table_get_meta, self.handle, field)[0]
+
+    def keyCount(self):
+        return _lib.cin_table_key_count(self.handle)
+
+    def hasKey(self, key):
+        data = key.encode("utf-8")
+        return _lib.cin_table_has_key(self.handle, data, len(data)) != 0
+
+    def getValues(self, key, flags):
+        data = key.encode("utf-8")
+        return _call(_lib.cin_table_get_values, self.handle, data, len(data), flags)
+
+    def getKeyName(self, key):
+        data = key.encode("utf-8")
+        names = _call(_lib.cin_table_get_key_name, self.handle, data, len(data))
+        return names[0] if names else None
+
+    def getKeys(self):
+        return _call(_lib.cin_table_get_keys, self.handle)
+
+    def getPrefixKeys(self, prefix, maxCount):
+        data = prefix.encode("utf-8")
+        return _call(_lib.cin_table_get_prefix_keys, self.handle, data, len(data), maxCount)
+
+    def findKeysWithValue(self, value, flags, maxCount):
+        data = value.encode("utf-8")
+        return _call(_lib.cin_table_find_keys_with_value, self.handle, data, len(data), flags, maxCount)
+
+    # nodes of the trie of the keys, -1 if there's no such node or the table has no trie
+    def trieRoot(self):
+        return _lib.cin_table_trie_root(self.handle)
+
+    def trieNext(self, node, char):
+        data = char.encode("utf-8")
+        return _lib.cin_table_trie_next(self.handle, node, data, len(data))
+
+    def trieIsKey(self, node):
+        return _lib.cin_table_trie_is_key(self.handle, node) != 0
+
+    def trieKeyCount(self, node):
+        return _lib.cin_table_trie_key_count(self.handle, node)
+
+    def trieKeys(self, node, maxCount):
+        return _call(_lib.cin_table_trie_get_keys, self.handle, node, maxCount)
+
+    def matchWildcard(self, pattern, wildcard, flags, maxCount):
+        data = pattern.encode("utf-8")
+        wildcardData = wildcard.encode("utf-8")
+        return _call(_lib.cin_table_match_wildcard, self.handle, data, len(data), wildcardData, len(wildcardData), flags, maxCount)
+
+
+class NativeCharDefs(Mapping):
+    # read-only dict-like view of the chardefs of a compiled table, used by the methods of Cin
+    # which iterate over all chardefs. The extend table is merged by an ExtendedCharDefs
+    # wrapping this view, so the view and the mapped table are never changed.
+
+    # the same attributes as ExtendedCharDefs, for the lookups which check the extend table
+    extend = {}
+    addedKeys = []
+
+    # base is the unfiltered view of the same table, which has the same keys
+    def __init__(self, table, flags, base=None):
+        self.table = table
+        self.flags = flags
+        self.base = base
+        self.sortedKeys = None
+
+    def __getitem__(self, key):
+        values = self.table.getValues(key, self.flags)
+        if values is None:
+            raise KeyError(key)
+        return values
+
+    def __contains__(self, key):
+        return self.table.hasKey(key)
+
+    def __iter__(self):
+        # same order as the json tables: sorted keys
+        if self.base is not None:
+            return iter(self.base)
+        return self.iterKeys()
+
+    def iterKeys(self):
+        if self.sortedKeys is None:
+            self.sortedKeys = self.table.getKeys()
+        for key in self.sortedKeys:
+            yield key
+
+    def __len__(self):
+        return self.table.keyCount()
+
+
+class NativeLookup(object):
+    # lookups shared by NativeCin, NativeRCin, and NativeHCin, which replace the ones of
+    # Cin, RCin, and HCin scanning all chardefs
+
+    # shared is the SharedTable of tableregistry, in which the compiled table is opened once
+    # per process, and its chardefs are the view of the variant (flags)
+    def loadTable(self, shared):
+        table = shared.table
+        self.table = table
+        self.ename = table.getMeta(META_ENAME)
+        self.cname = table.getMeta(META_CNAME)
+        self.selkey = table.getMeta(META_SELKEY)
+        self.cincount = json.loads(table.getMeta(META_CINCOUNT))
+        self.flags = shared.flags
+        self.chardefs = shared.chardefs
+        self.basechardefs = self.chardefs
+
+
+    def __del__(self):
+        # LoadCinTable calls __del__() of the old table when reloading while other threads may
+        # still use it, so the table is unmapped by CinTable.__del__() after the last reference
+        # is released instead of here.
+        pass
+
+
+    def isInKeyName(self, key):
+        return self.table.getKeyName(key) is not None
+
+
+    def getKeyName(self, key):
+        name = self.table.getKeyName(key)
+        if name is None:
+            raise KeyError(key)
+        return name
+
+
+    def isInCharDef(self, key):
+        return key in self.chardefs
+
+
+    def getCharDef(self, key):
+        return self.chardefs[key]
+
+
+    def getMutableCharDef(self, key):
+        # getValues() creates a new list on each call, only the values merged with the extend
+        # table are cached by ExtendedCharDefs
+        values = self.chardefs[key]
+        return list(values) if key in self.chardefs.extend else values
+
+
+    # the keys having the value, in the order of chardefs, found with the inverted index
+    def keysWithValue(self, val, maxCount=0x7fffffff):
+        keys = self.table.findKeysWithValue(val, self.flags, maxCount)
+        chardefs = self.chardefs
+        if chardefs.extend:
+            keys += [key for key, roots in chardefs.extend.items() if val in roots and key not in keys]
+            keys.sort(key=lambda key: self.keyOrder(chardefs, key))
+        return keys[:maxCount]
+
+
+    # sort key of the iteration order of chardefs
+    def keyOrder(self, chardefs, key):
+        if self.table.hasKey(key):
+            return (0, key.encode("utf-8"), 0)
+        return (1, b"", chardefs.addedKeys.index(key))
+
+
+    def isHaveKey(self, val):
+        return True if self.keysWithValue(val, 1) else False
+
+
+    def getKey(self, val):
+        return self.keysWithValue(val, 1)[0]
+
+
+    def haveNextCharDef(self, key):
+        if len(key) != 1:
+            return [chardef for chardef in self.chardefs if key == chardef[:1]][:2]
+        return self.keyCursor().moveTo(key).getKeys(2)
+
+
+    def keyCursor(self):
+        if self.table.trieRoot() < 0:  # compiled without the trie
+            return KeyCursor(self)
+        return NativeKeyCursor(self)
+
+
+    def encodeChar(self, root, notFound):
+        nunbers = ['①', '②', '③', '④', '⑤', '⑥', '⑦', '⑧', '⑨', '⑩']
+        i = 0
+        result = root + ':'
+        for chardef in self.keysWithValue(root):
+            for char in self.chardefs[chardef]:
+                if char == root:
+                    result += '　' + nunbers[i]
+                    if i < 9:
+                        i = i + 1
+                    for str in chardef:
+                        result += self.getKeyName(str)
+
+        if result == root + ':':
+            result = notFound
+        return result
+
+
+class NativeKeyCursor(KeyCursor):
+    # KeyCursor following the trie of the keys. The nodes of the typed keys are kept, so typing
+    # one more key only advances one node, and deleting the last key goes back one node.
+
+    def __init__(self, lookup):
+        KeyCursor.__init__(self, lookup)
+        self.table = lookup.table
+        self.nodes = [self.table.trieRoot()]
+
+
+    def moveTo(self, keys):
+        common = 0
+        while common < len(self.keys) and common < len(keys) and self.keys[common] == keys[common]:
+            common += 1
+        del self.nodes[common + 1:]
+        for char in keys[common:]:
+            node = self.nodes[-1]
+            self.nodes.append(self.table.trieNext(node, char) if node >= 0 else -1)
+        self.keys = keys
+        return self
+
+
+    # keys added by the extend table, which are not in the trie. The extend table of the
+    # current chardefs is used, so the cursor follows updateCinTable().
+    def addedKeys(self):
+        return [key for key in self.cin.chardefs.addedKeys if key.startswith(self.keys)]
+
+
+    def isKey(self):
+        return self.table.trieIsKey(self.nodes[-1]) or self.keys in self.cin.chardefs.extend
+
+
+    def getKeys(self, maxCount):
+        keys = self.table.trieKeys(self.nodes[-1], maxCount) if self.nodes[-1] >= 0 else []
+        if len(keys) < maxCount:
+            keys += self.addedKeys()
+        return keys[:maxCount]
+
+
+    def continuationCount(self):
+        count = self.table.trieKeyCount(self.nodes[-1]) + len(self.addedKeys())
+        return count - 1 if self.isKey() else count
+
+
+    def hasContinuation(self):
+        return self.continuationCount() > 0
+
+
+class NativeCin(NativeLookup, Cin):
+    # Cin backed by a compiled table
+
+    def load(self, shared):
+        self.loadTable(shared)
+
+
+    def getCharEncode(self, root):
+        return self.encodeChar(root, '查無字根...')
+
+
+    def getCharSet(self, root):
+        return getCharSet(root)
+
+
+    def getWildcardCharDefs(self, CompositionChar, WildcardChar, candMaxItems):
+        if self.chardefs.extend:
+            # the values of the extend table are not in the compiled table
+            return Cin.getWildcardCharDefs(self, CompositionChar, WildcardChar, candMaxItems)
+        return self.table.matchWildcard(CompositionChar, WildcardChar, self.flags, candMaxItems)
+
+
+class NativeRCin(NativeLookup, RCin):
+    # RCin (table of reverse lookups) backed by a compiled table
+
+    def load(self, shared):
+        self.loadTable(shared)
+
+
+    def getCharEncode(self, root):
+        return self.encodeChar(root, '')
+
+
+class NativeHCin(NativeLookup, HCin):
+    # HCin (table of homophones) backed by a compiled table
+
+    def load(self, shared):
+        self.loadTable(shared)
+
+
+    def getKeyList(self, val):
+        return self.keysWithValue(val)
+
+
+    def getCharEncode(self, root):
+        return self.encodeChar(root, '')
+
+
+class NativePhrase(phrase):
+    # table of associated phrases compiled from data/phrase.cin, looked up by the last commit string
+
+    def load(self, shared):
+        self.table = shared.table
+        self.chardefs = shared.chardefs
+
+
+    def getKeyNames(self):
+        return list(self.chardefs)
+
+
+__all__ = ["isAvailable", "getBinFile", "getCharSet", "CinTable", "NativeCin", "NativeRCin", "NativeHCin", "NativePhrase"]
@@ -56,6 +56,7 @@ class CinBaseConfig:
         self.easySymbolsWithShift = False
         self.showPhrase = False
         self.sortByPhrase = True
+        self.sortByFrequency = False
         self.supportWildcard = True
         self.compositionBufferMode = False
         self.autoMoveCursorInBrackets = False
@@ -71,6 +72,7 @@ class CinBaseConfig:
         self.messageDurationTime = 3
         self.keyboardType = 0
         self.selDayiSymbolCharType = 0
+        self.localEcho = False
 
         self.ignoreSaveList = ["ignoreSaveList", "curdir", "cinFileList", "selCinFile", "imeDirName", "_version", "_lastUpdateTime"]
         self.curdir = os.path.abspath(os.path.dirname(__file__))
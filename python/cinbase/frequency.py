@@ -0,0 +1,338 @@
+from __future__ import print_function
+from __future__ import unicode_literals
+import os
+import mmap
+import zlib
+import struct
+import atexit
+import hashlib
+import threading
+import traceback
+
+from .cin import moveToFront
+
+# Per-user counts of the selected candidates, used to move the candidates chosen often to the
+# front of the candidate list (sortByFrequency).
+#
+# The counts are kept in a hash table in a memory-mapped file of the config directory, which is
+# keyed by the hash of the composition keys. Each slot holds the counts of up to SLOT_ENTRIES
+# values of the key, keyed by the hash of the value. When the slot is full, the entry with the
+# lowest count is replaced unless it still sorts the candidates. The counts decay by half every
+# HALF_LIFE selections, so the candidates which are not chosen any more fall back to the order
+# of the table.
+#
+# record() only queues the selection in memory. The writer thread applies the queued selections
+# to the file in batches, and the queued selections are merged with the file at lookup time.
+# The lookups on the keystroke path only take lock for a slot read. The writer holds writeLock
+# while it applies a batch and takes lock only to store each slot and to swap the grown file.
+
+FILE_MAGIC = b"PIMEFRQ1"
+FILE_VERSION = 1
+HEADER = struct.Struct("<8sIIIIQ")      # magic, version, slot count, used slots, reserved, tick
+SLOT_HEAD = struct.Struct("<QII")       # key hash (0 for empty slots), tick, entry count
+ENTRY = struct.Struct("<If")            # value hash, count
+SLOT_ENTRIES = 8
+SLOT_SIZE = SLOT_HEAD.size + SLOT_ENTRIES * ENTRY.size
+INITIAL_SLOTS = 1024                    # power of 2
+MAX_LOAD = 0.7
+
+HALF_LIFE = 10000                       # selections
+DECAY = 0.5 ** (1.0 / HALF_LIFE)
+MIN_COUNT = 2.0                         # a candidate is moved after it's chosen twice recently
+RECENT = HALF_LIFE // 10                # selections within which the MIN_COUNT choices are recent
+PROMOTE_COUNT = MIN_COUNT * 0.5 ** (RECENT / HALF_LIFE)  # MIN_COUNT decayed over RECENT selections
+
+BATCH_SIZE = 32                         # queued selections written at once
+WRITE_INTERVAL = 10                     # seconds between the writes of the queued selections
+MAX_WRITE_FAILURES = 3                  # the store is disabled after the writes fail repeatedly
+
+
+def keyHash(key):
+    # 64-bit hash of the composition keys, never 0 which marks the empty slots
+    return int.from_bytes(hashlib.blake2b(key.encode("utf-8"), digest_size=8).digest(), "little") or 1
+
+
+def valueHash(value):
+    return zlib.crc32(value.encode("utf-8"))
+
+
+class FrequencyStore(object):
+
+    def __init__(self, path):
+        self.path = path
+        self.lock = threading.Lock()        # the map and the queued selections
+        self.writeLock = threading.Lock()   # the writes of the file, held by one writer at a time
+        self.pending = {}  # key => {value: count}, the selections not written yet
+        self.pendingCount = 0
+        self.writing = {}  # the selections being written, removed when their slots are stored
+        self.file = None
+        self.map = None
+        self.open()
+        self.writeEvent = threading.Event()
+        self.writer = threading.Thread(target=self.writeLoop, daemon=True)
+        self.writer.start()
+
+
+    def open(self):
+        if not os.path.exists(self.path) or not self.isValid():
+            os.replace(self.create(INITIAL_SLOTS, [], 0), self.path)
+        self.file = open(self.path, "r+b")
+        self.map = mmap.mmap(self.file.fileno(), 0, access=mmap.ACCESS_WRITE)
+        magic, version, self.slotCount, self.usedSlots, reserved, self.tick = HEADER.unpack_from(self.map, 0)
+
+
+    def isValid(self):
+        with open(self.path, "rb") as f:
+            data = f.read(HEADER.size)
+        if len(data) < HEADER.size:
+            return False
+        magic, version, slotCount, usedSlots, reserved, tick = HEADER.unpack(data)
+        return (magic == FILE_MAGIC and version == FILE_VERSION and slotCount and not slotCount & (slotCount - 1)
+                and os.path.getsize(self.path) == HEADER.size + slotCount * SLOT_SIZE)
+
+
+    def create(self, slotCount, slots, tick):
+        # writes a new file with the slots, a list of (key hash, tick, entries), and returns its
+        # temporary path to be moved to path
+        data = bytearray(HEADER.size + slotCount * SLOT_SIZE)
+        HEADER.pack_into(data, 0, FILE_MAGIC, FILE_VERSION, slotCount, len(slots), 0, tick)
+        for khash, slotTick, entries in slots:
+            index = khash & (slotCount - 1)
+            while SLOT_HEAD.unpack_from(data, HEADER.size + index * SLOT_SIZE)[0]:
+                index = (index + 1) & (slotCount - 1)
+            self.packSlot(data, HEADER.size + index * SLOT_SIZE, khash, slotTick, entries)
+        tempPath = self.path + ".tmp"
+        with open(tempPath, "wb") as f:
+            f.write(data)
+        return tempPath
+
+
+    def close(self):
+        if self.map is not None:
+            self.map.close()
+            self.file.close()
+            self.map = None
+            self.file = None
+
+
+    def packSlot(self, data, offset, khash, tick, entries):
+        SLOT_HEAD.pack_into(data, offset, khash, tick, len(entries))
+        offset += SLOT_HEAD.size
+        for vhash, count in entries:
+            ENTRY.pack_into(data, offset, vhash, count)
+            offset += ENTRY.size
+
+
+    def findSlot(self, khash):
+        # offset of the slot of the key, or of the empty slot where the key should be added
+        mask = self.slotCount - 1
+        index = khash & mask
+        while True:
+            offset = HEADER.size + index * SLOT_SIZE
+            slotHash = SLOT_HEAD.unpack_from(self.map, offset)[0]
+            if slotHash == khash or slotHash == 0:
+                return offset, slotHash != 0
+            index = (index + 1) & mask
+
+
+    def readSlot(self, offset):
+        khash, tick, entryCount = SLOT_HEAD.unpack_from(self.map, offset)
+        offset += SLOT_HEAD.size
+        return tick, [ENTRY.unpack_from(self.map, offset + i * ENTRY.size) for i in range(entryCount)]
+
+
+    # records that value is chosen from the candidates of key
+    def record(self, key, value):
+        with self.lock:
+            if self.map is None:  # disabled
+                return
+            values = self.pending.setdefault(key, {})
+            values[value] = values.get(value, 0) + 1
+            self.pendingCount += 1
+            if self.pendingCount >= BATCH_SIZE:
+                self.writeEvent.set()
+
+
+    # the decayed counts of the values of key, including the queued selections
+    def getCounts(self, key):
+        khash = keyHash(key)
+        counts = {}
+        with self.lock:
+            if self.map is not None:
+                offset, found = self.findSlot(khash)
+                if found:
+                    slotTick, entries = self.readSlot(offset)
+                    decay = DECAY ** (self.tick - slotTick)
+                    for vhash, count in entries:
+                        counts[vhash] = count * decay
+            queued = [self.writing.get(key), self.pending.get(key)]
+        for values in queued:
+            for value, count in (values or {}).items():
+                vhash = valueHash(value)
+                counts[vhash] = counts.get(vhash, 0.0) + count
+        return counts
+
+
+    def sortCandidates(self, key, candidates):
+        """
+        Moves the candidates chosen at least MIN_COUNT times recently to the front, the ones
+        chosen most first, and keeps the order of the table for the others. candidates is
+        reordered in place. The counts are compared with PROMOTE_COUNT, so the candidates stay
+        in front while the other keys are typed, until the count decays for RECENT selections.
+        """
+        counts = {vhash: count for vhash, count in self.getCounts(key).items() if count >= PROMOTE_COUNT}
+        if not counts:
+            return candidates
+        found = {}  # value => (count, position in the table)
+        for i, cand in enumerate(candidates):
+            vhash = valueHash(cand)
+            if vhash in counts:
+                found[cand] = (-counts.pop(vhash), i)
+                if not counts:
+                    break
+        if not found:
+            return candidates
+        return moveToFront(candidates, sorted(found, key=found.get))
+
+
+    def writeLoop(self):
+        failures = 0
+        while self.map is not None:
+            self.writeEvent.wait(WRITE_INTERVAL)
+            self.writeEvent.clear()
+            try:
+                self.flush()
+                failures = 0
+            except Exception as e:
+                # the selections are queued again by flush() and retried in the next write
+                print("ERROR:", e, self.path)
+                traceback.print_exc()
+                failures += 1
+                if failures >= MAX_WRITE_FAILURES:
+                    print("ERROR: disable sortByFrequency of", self.path)
+                    self.disable()
+
+
+    # writes the queued selections to the file
+    # Only the writer changes the map, so it reads the map without lock.
+    def flush(self):
+        with self.writeLock:
+            with self.lock:
+                if not self.pending or self.map is None:
+                    return
+                self.writing = self.pending
+                self.pending = {}
+                self.pendingCount = 0
+            try:
+                for key, values in list(self.writing.items()):
+                    # keeps empty slots for the keys which are not in the file yet
+                    if self.usedSlots >= self.slotCount * MAX_LOAD:
+                        self.grow()
+                    self.addCounts(key, values)
+                HEADER.pack_into(self.map, 0, FILE_MAGIC, FILE_VERSION, self.slotCount, self.usedSlots, 0, self.tick)
+                self.map.flush()
+            except Exception:
+                self.requeue()
+                raise
+
+
+    # queues the selections not written by the failed flush() again
+    def requeue(self):
+        with self.lock:
+            for key, values in self.writing.items():
+                pendingValues = self.pending.setdefault(key, {})
+                for value, count in values.items():
+                    pendingValues[value] = pendingValues.get(value, 0) + count
+                    self.pendingCount += count
+            self.writing = {}
+
+
+    # stops recording after the file cannot be written, and drops the queued selections
+    def disable(self):
+        with self.writeLock, self.lock:
+            self.pending = {}
+            self.pendingCount = 0
+            self.writing = {}
+            try:
+                self.close()
+            except Exception:
+                traceback.print_exc()
+            self.map = None
+            self.file = None
+
+
+    def addCounts(self, key, values):
+        khash = keyHash(key)
+        tick = self.tick + sum(values.values())
+        offset, found = self.findSlot(khash)
+        entries = []
+        if found:
+            slotTick, entries = self.readSlot(offset)
+            decay = DECAY ** (tick - slotTick)
+            entries = [[vhash, count * decay] for vhash, count in entries]
+        for value, count in values.items():
+            vhash = valueHash(value)
+            entry = next((entry for entry in entries if entry[0] == vhash), None)
+            if entry is not None:
+                entry[1] += count
+            elif len(entries) < SLOT_ENTRIES:
+                entries.append([vhash, float(count)])
+            else:
+                # replaces the value chosen least, unless it still sorts the candidates
+                least = min(range(len(entries)), key=lambda i: entries[i][1])
+                if entries[least][1] < max(count, PROMOTE_COUNT):
+                    entries[least] = [vhash, float(count)]
+        with self.lock:
+            self.packSlot(self.map, offset, khash, tick, entries)
+            self.tick = tick
+            if not found:
+                self.usedSlots += 1
+            del self.writing[key]
+
+
+    def grow(self):
+        # the lookups only wait for the swap of the files
+        slots = []
+        for index in range(self.slotCount):
+            offset = HEADER.size + index * SLOT_SIZE
+            khash = SLOT_HEAD.unpack_from(self.map, offset)[0]
+            if khash:
+                slotTick, entries = self.readSlot(offset)
+                slots.append((khash, slotTick, entries))
+        tempPath = self.create(self.slotCount * 2, slots, self.tick)
+        with self.lock:
+            # the mapped file cannot be replaced on Windows
+            self.close()
+            try:
+                os.replace(tempPath, self.path)
+            finally:
+                self.open()
+
+
+_stores = {}
+_storesLock = threading.Lock()
+
+
+def openStore(path):
+    # the store of the file shared by all TextService of the input method, or None if the file
+    # cannot be used
+    with _storesLock:
+        if path not in _stores:
+            try:
+                _stores[path] = FrequencyStore(path)
+            except (OSError, ValueError, struct.error):
+                _stores[path] = None
+        return _stores[path]
+
+
+@atexit.register
+def _flushStores():
+    for store in list(_stores.values()):
+        if store is not None:
+            try:
+                store.flush()
+            except Exception:
+                pass
+
+
+__all__ = ["FrequencyStore", "openStore"]
@@ -20,7 +20,12 @@ class HCin(object):
         self.keynames = {}
         self.chardefs = {}
 
-        self.__dict__.update(json.load(fs))
+        self.load(fs)
+
+    # 載入 json 格式的碼表，NativeHCin 改為使用編譯過的碼表
+    # fs 也可以是 TableRegistry 載入的共用碼表 (SharedTable)
+    def load(self, fs):
+        self.__dict__.update(json.load(fs) if hasattr(fs, "read") else fs.fields)
 
 
     def __del__(self):
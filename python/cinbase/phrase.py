@@ -4,6 +4,8 @@ import os
 import re
 import json
 
+from .cin import moveToFront
+
 
 class phrase(object):
 
@@ -13,7 +15,35 @@ class phrase(object):
     def __init__(self, fs):
         self.keynames = []
         self.chardefs = {}
-        self.__dict__.update(json.load(fs))
+        self.load(fs)
+
+
+    # 內建的聯想字詞庫 data/phrase.cin，或使用者設定目錄中 json 格式的 phrase.json
+    # cintable.NativePhrase 改為使用編譯過的 bin/phrase.bin
+    def load(self, fs):
+        if getattr(fs, "name", "").endswith(".json"):
+            self.__dict__.update(json.load(fs))
+            return
+
+        # %chardef begin 之後每一行是「前一個字 後接字詞」，同一個字的後接字詞依序排列
+        inChardef = False
+        for line in fs:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            if line.startswith('%chardef'):
+                inChardef = 'begin' in line
+                continue
+            if not inChardef:
+                continue
+            key, value = (re.split('[ \t]+', line, 1) + [''])[:2]
+            try:
+                values = self.chardefs[key]
+            except KeyError:
+                values = self.chardefs[key] = []
+                self.keynames.append(key)
+            if value and value not in values:
+                values.append(value)
 
 
     def __del__(self):
@@ -28,7 +58,7 @@ class phrase(object):
 
 
     def getCharDef(self, key):
-        """ 
+        """
         will return a list conaining all possible result
         """
         return self.chardefs[key]
@@ -38,4 +68,45 @@ class phrase(object):
         return self.keynames
 
 
+    def getPhrases(self, lastCommitString, userphrase, userOnly=False):
+        """
+        接在 lastCommitString 之後的聯想字詞：使用者詞庫 (userphrase.dat) 的字詞在前，再接著內建詞庫的字詞
+        userOnly 為 True 時，使用者詞庫有字詞就只傳回使用者詞庫的字詞
+        傳回的 list 可能是詞庫本身的 list，不可修改
+        """
+        phrases = []
+        if userphrase is not None and userphrase.isInCharDef(lastCommitString):
+            phrases = userphrase.getCharDef(lastCommitString)
+        plist = []
+        if self.isInCharDef(lastCommitString) and not (userOnly and phrases):
+            plist = self.getCharDef(lastCommitString)
+        if not phrases:
+            return plist
+
+        # 使用者詞庫只是疊加在內建詞庫之上，合併到新的 list，不修改使用者詞庫
+        # 使用者詞庫是使用者自己編輯的，可能有重複的字詞，只保留第一個
+        merged = []
+        seen = set()
+        for pstr in phrases + plist:
+            if pstr not in seen:
+                seen.add(pstr)
+                merged.append(pstr)
+        return merged
+
+
+    def sortCandidates(self, lastCommitString, candidates, userphrase):
+        """
+        依照聯想字詞的順序把候選字中的聯想字詞移到最前面，其餘候選字維持原來的順序
+        candidates 會直接被重新排列，必須是呼叫者可以修改的 list
+        """
+        phrases = self.getPhrases(lastCommitString, userphrase)
+        if not phrases:
+            return candidates
+        present = set(candidates)
+        front = [pstr for pstr in phrases if pstr in present]
+        if not front:
+            return candidates
+        return moveToFront(candidates, front)
+
+
 __all__ = ["phrase"]
@@ -0,0 +1,168 @@
+from __future__ import print_function
+from __future__ import unicode_literals
+import io
+import os
+import json
+import threading
+import weakref
+
+from .cin import Cin, PrivateUseCharDefs
+from .rcin import RCin
+from .hcin import HCin
+from .phrase import phrase
+from . import cintable
+
+# Process-wide registry of the loaded cin tables.
+# All cinbase input methods run in the same backend process, and each of them loads a main
+# table (Cin), a table of reverse lookups (RCin), and a table of homophones (HCin), so the same
+# file is often loaded several times, like checj.json as the main table of checj and the table
+# of reverse lookups of other input methods. The registry loads each file once, and the Cin,
+# RCin, and HCin objects of all input methods share it.
+#
+# Entries are keyed by (file, variant). The variant is a view of the unfiltered entry instead of
+# another copy of the table: SKIP_PRIVATE_USE hides the values in the privateuse list for
+# ignorePrivateUseArea. Each object holds a TableHandle, and an entry is unloaded when the last
+# handle is closed.
+
+VARIANT_ALL = 0
+VARIANT_SKIP_PRIVATE_USE = cintable.SKIP_PRIVATE_USE
+
+
+class SharedTable(object):
+    # the data of an entry, which is never changed after loading
+    #   table: CinTable of the compiled table, or None for the json tables
+    #   fields: the fields of the json table, or None for the compiled tables
+    #   chardefs: the chardefs of the variant
+    #   flags: the variant
+    def __init__(self, table, fields, chardefs, flags, base=None):
+        self.table = table
+        self.fields = fields
+        self.chardefs = chardefs
+        self.flags = flags
+        self.base = base  # handle of the unfiltered entry of a variant
+
+
+class TableHandle(object):
+    # a reference to an entry of the registry
+
+    def __init__(self, registry, key, shared):
+        self.registry = registry
+        self.key = key
+        self.shared = shared
+        self.closed = False
+
+
+    def close(self):
+        if not self.closed:
+            self.closed = True
+            self.registry.release(self.key)
+
+
+class TableEntry(object):
+    def __init__(self):
+        self.shared = None
+        self.refCount = 0
+        self.loadLock = threading.Lock()  # loads each entry once without blocking other entries
+
+
+class TableRegistry(object):
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.entries = {}  # (path, variant) => TableEntry
+
+
+    # returns a TableHandle of the table, which is loaded if it's not in the registry yet
+    def open(self, path, variant=VARIANT_ALL):
+        key = (os.path.normcase(os.path.abspath(path)), variant)
+        with self.lock:
+            entry = self.entries.get(key)
+            if entry is None:
+                entry = self.entries[key] = TableEntry()
+            entry.refCount += 1
+        try:
+            with entry.loadLock:
+                if entry.shared is None:
+                    entry.shared = self.load(key[0], variant)
+        except Exception:
+            self.release(key)
+            raise
+        return TableHandle(self, key, entry.shared)
+
+
+    def release(self, key):
+        with self.lock:
+            entry = self.entries[key]
+            entry.refCount -= 1
+            if entry.refCount > 0:
+                return
+            del self.entries[key]
+        # the objects still using the data keep it until they are released
+        if entry.shared is not None and entry.shared.base is not None:
+            entry.shared.base.close()
+
+
+    def load(self, path, variant):
+        if variant != VARIANT_ALL:
+            base = self.open(path, VARIANT_ALL)
+            shared = base.shared
+            if shared.table is not None:
+                chardefs = cintable.NativeCharDefs(shared.table, variant, shared.chardefs)
+            else:
+                chardefs = PrivateUseCharDefs(shared.fields["chardefs"], shared.fields.get("privateuse", {}))
+            return SharedTable(shared.table, shared.fields, chardefs, variant, base)
+        if path.endswith(".bin"):
+            table = cintable.CinTable(path)
+            return SharedTable(table, None, cintable.NativeCharDefs(table, VARIANT_ALL), VARIANT_ALL)
+        with io.open(path, 'r', encoding='utf8') as fs:
+            fields = json.load(fs)
+        return SharedTable(None, fields, fields.get("chardefs", {}), VARIANT_ALL)
+
+
+registry = TableRegistry()
+
+
+def getTablePath(jsonPath):
+    # the compiled table of the json table if PIMECinTable can load it, or the json table
+    binPath = cintable.getBinFile(jsonPath)
+    if cintable.isAvailable() and os.path.exists(binPath):
+        return binPath
+    return jsonPath
+
+
+def _create(cls, nativeCls, path, variant, *args):
+    handle = registry.open(getTablePath(path), variant)
+    try:
+        table = (nativeCls if handle.shared.table is not None else cls)(handle.shared, *args)
+    except Exception:
+        handle.close()
+        raise
+    # released after the last reference to the table, which may be used by other threads after
+    # the loaders replace it
+    weakref.finalize(table, handle.close)
+    return table
+
+
+def openCin(jsonPath, imeDirName, ignorePrivateUseArea):
+    variant = VARIANT_SKIP_PRIVATE_USE if ignorePrivateUseArea else VARIANT_ALL
+    return _create(Cin, cintable.NativeCin, jsonPath, variant, imeDirName, ignorePrivateUseArea)
+
+
+def openRCin(jsonPath, imeDirName):
+    return _create(RCin, cintable.NativeRCin, jsonPath, VARIANT_ALL, imeDirName)
+
+
+def openHCin(jsonPath, imeDirName):
+    return _create(HCin, cintable.NativeHCin, jsonPath, VARIANT_ALL, imeDirName)
+
+
+def openPhrase(path):
+    # data/phrase.cin is compiled to bin/phrase.bin. The phrase.json of the users, or phrase.cin
+    # without PIMECinTable, is parsed by phrase.
+    if path.endswith(".cin") and getTablePath(path) != path:
+        return _create(None, cintable.NativePhrase, path, VARIANT_ALL)
+    with io.open(path, 'r', encoding='utf8') as fs:
+        return phrase(fs)
+
+
+__all__ = ["TableRegistry", "registry", "getTablePath", "openCin", "openRCin", "openHCin", "openPhrase"]
@@ -155,6 +155,13 @@ class CinToJson(object):
 
 
     def run(self, file, filePath, sortByCharset):
+        self.parse(file, filePath, sortByCharset)
+        self.saveJsonFile(self.jsonFile)
+
+
+    # 解析 cin 檔，結果存在 self.chardefs 等屬性中
+    # PIMECinTable/CinCompiler.cpp 以相同的規則編譯 bin 碼表，修改時兩邊要一致
+    def parse(self, file, filePath, sortByCharset):
         self.jsonFile = re.sub('\.cin$', '', file) + '.json'
         self.sortByCharset = sortByCharset
         state = PARSING_HEAD_STATE
@@ -263,7 +270,6 @@ class CinToJson(object):
             if DEBUG_MODE:
                 print("排序字元集!")
             self.mergeDicts(self.big5F, self.big5LF, self.big5S, self.big5Other, self.bopomofo, self.cjk, self.cjkExtA, self.cjkExtB, self.cjkExtC, self.cjkExtD, self.cjkExtE, self.cjkExtF, self.cjkCIibm, self.cjkOther, self.phrases, self.privateuse)
-        self.saveJsonFile(self.jsonFile)
 
 
     def mergeDicts(self, *chardefsdicts):
@@ -0,0 +1,130 @@
+from __future__ import print_function
+from __future__ import unicode_literals
+import os
+
+from cintojson import CinToJson
+
+# 產生 PIMECinTable/CinCharSetTable.cpp，所有 Unicode 碼位 (U+0000 - U+10FFFF) 的字元分類
+# 分類與 CinToJson.getCharSet() 相同 (字元集範圍及 Big5 編碼)，修改分類後需重新執行
+# PIMECinCompiler 依分類排序字元及統計 cincount，cinCharSetOf() 再由分類得到 Cin.getCharSet() 的字元集
+#
+# 用法:
+#   python gencharset.py
+
+MAX_CODEPOINT = 0x10FFFF
+BLOCK_SHIFT = 8
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+CURDIR = os.path.abspath(os.path.dirname(__file__))
+OUTPUT_FILE = os.path.join(CURDIR, os.pardir, os.pardir, os.pardir, "PIMECinTable", "CinCharSetTable.cpp")
+
+
+# CinCharClass，見 PIMECinTable/CinCharSet.h
+CHAR_OTHER = 0
+CHAR_BOPOMOFO = 1
+CHAR_CJK = 2
+CHAR_BIG5_F = 3
+CHAR_BIG5_LF = 4
+CHAR_BIG5_S = 5
+CHAR_BIG5_OTHER = 6
+CHAR_CJK_EXT_A = 7
+CHAR_CJK_EXT_B = 8
+CHAR_CJK_EXT_C = 9
+CHAR_CJK_EXT_D = 10
+CHAR_CJK_EXT_E = 11
+CHAR_CJK_EXT_F = 12
+CHAR_CJK_CI_IBM = 13
+CHAR_PRIVATE_USE = 14
+CHAR_CJK_CI = 15
+CHAR_CJK_CIS = 16
+
+
+# 與 CinToJson.getCharSet() 相同的分類
+def getCharClass(charsetRange, char):
+    matchint = ord(char)
+    if matchint <= charsetRange['cjk'][1]:
+        if (matchint in range(charsetRange['bopomofo'][0], charsetRange['bopomofo'][1]) or
+            matchint in charsetRange['bopomofoTone']):
+            return CHAR_BOPOMOFO
+        elif matchint in range(charsetRange['cjk'][0], charsetRange['cjk'][1]):
+            try:
+                big5codeint = int(char.encode('big5').hex(), 16)
+            except UnicodeEncodeError:
+                return CHAR_CJK
+            if big5codeint in range(charsetRange['big5F'][0], charsetRange['big5F'][1]):
+                return CHAR_BIG5_F
+            elif big5codeint in range(charsetRange['big5LF'][0], charsetRange['big5LF'][1]):
+                return CHAR_BIG5_LF
+            elif big5codeint in range(charsetRange['big5S'][0], charsetRange['big5S'][1]):
+                return CHAR_BIG5_S
+            return CHAR_BIG5_OTHER
+        elif matchint in range(charsetRange['cjkExtA'][0], charsetRange['cjkExtA'][1]):
+            return CHAR_CJK_EXT_A
+    else:
+        for name, charClass in (('cjkExtB', CHAR_CJK_EXT_B), ('cjkExtC', CHAR_CJK_EXT_C), ('cjkExtD', CHAR_CJK_EXT_D),
+                                ('cjkExtE', CHAR_CJK_EXT_E), ('cjkExtF', CHAR_CJK_EXT_F)):
+            if matchint in range(charsetRange[name][0], charsetRange[name][1]):
+                return charClass
+        if matchint in charsetRange['cjkCIb']:
+            return CHAR_CJK_CI_IBM
+        for name in ('pua', 'puaA', 'puaB'):
+            if matchint in range(charsetRange[name][0], charsetRange[name][1]):
+                return CHAR_PRIVATE_USE
+        if (matchint in range(charsetRange['cjkCIa'][0], charsetRange['cjkCIa'][1]) or
+            matchint in charsetRange['cjkCIc'] or
+            matchint in range(charsetRange['cjkCId'][0], charsetRange['cjkCId'][1])):
+            return CHAR_CJK_CI
+        if matchint in range(charsetRange['cjkCIS'][0], charsetRange['cjkCIS'][1]):
+            return CHAR_CJK_CIS
+    return CHAR_OTHER
+
+
+# 二層表: 每 256 個碼位一個區塊，內容相同的區塊只存一次
+def build_table():
+    charsetRange = CinToJson().charsetRange
+    blocks = []
+    blockIndex = []
+    blockIds = {}
+    for start in range(0, MAX_CODEPOINT + 1, BLOCK_SIZE):
+        block = bytes(getCharClass(charsetRange, chr(codepoint)) for codepoint in range(start, start + BLOCK_SIZE))
+        if block not in blockIds:
+            blockIds[block] = len(blocks)
+            blocks.append(block)
+        blockIndex.append(blockIds[block])
+    return blocks, blockIndex
+
+
+def format_values(values, indent):
+    lines = []
+    for i in range(0, len(values), 32):
+        lines.append(indent + ", ".join(str(value) for value in values[i:i + 32]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    blocks, blockIndex = build_table()
+    with open(OUTPUT_FILE, "w", newline="\n") as f:
+        f.write("// Generated by python/cinbase/tools/gencharset.py, do not edit.\n")
+        f.write("// CinCharClass of all code points, classified the same as CinToJson.getCharSet() in\n")
+        f.write("// python/cinbase/tools/cintojson.py.\n\n")
+        f.write('#include "CinCharSet.h"\n\n')
+        f.write("namespace PIME {\n\n")
+        f.write("static const uint8_t charClassBlocks[%d][%d] = {\n" % (len(blocks), BLOCK_SIZE))
+        for block in blocks:
+            f.write("\t{\n%s\n\t},\n" % format_values(list(block), "\t\t"))
+        f.write("};\n\n")
+        f.write("static const uint16_t charClassBlockIndex[%d] = {\n" % len(blockIndex))
+        f.write(format_values(blockIndex, "\t") + "\n")
+        f.write("};\n\n")
+        f.write("CinCharClass cinCharClassOf(uint32_t codepoint) {\n")
+        f.write("\tif (codepoint > 0x%X) {\n" % MAX_CODEPOINT)
+        f.write("\t\treturn CIN_CHAR_OTHER;\n")
+        f.write("\t}\n")
+        f.write("\treturn CinCharClass(charClassBlocks[charClassBlockIndex[codepoint >> %d]][codepoint & 0x%x]);\n" % (BLOCK_SHIFT, BLOCK_SIZE - 1))
+        f.write("}\n\n")
+        f.write("} // namespace PIME\n")
+    print("%d blocks, %d bytes" % (len(blocks), len(blocks) * BLOCK_SIZE + len(blockIndex) * 2))
+
+
+if __name__ == "__main__":
+    main()
@@ -15,8 +15,15 @@
 # License along with this library; if not, write to the Free Software
 # Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 
+import atexit
+import collections
+import concurrent.futures
 import json
+import os
+import queue
 import sys
+import threading
+import time
 import traceback
 
 if __name__ == "__main__":
@@ -36,6 +43,8 @@ class Client(object):
         self.isMetroApp = msg["isMetroApp"]
         self.isUiLess = msg["isUiLess"]
         self.isUiLess = msg["isConsole"]
+        # name of the shared memory section for candidate lists, if offered by the client
+        self.candidateSection = msg.get("candidateSection", "")
         # create the text service
         self.service = textServiceMgr.createService(self, self.guid)
         return (self.service is not None)
@@ -58,11 +67,94 @@ class Client(object):
         return reply
 
 
+# number of threads handling requests. Requests of a client are still handled one at a time
+# and in order, so each text service instance only runs in one thread at a time.
+MAX_WORKER_THREADS = 8
+
+
+class SerialExecutor(object):
+    # Run the tasks submitted to it one by one in the order of submission, using the threads
+    # of a shared thread pool. Executors of different clients run concurrently.
+    def __init__(self, pool):
+        self.pool = pool
+        self.lock = threading.Lock()
+        self.tasks = collections.deque()
+        self.running = False
+
+    def submit(self, fn, *args):
+        with self.lock:
+            self.tasks.append((fn, args))
+            if self.running:  # the running worker will pick up the task
+                return
+            self.running = True
+        self.pool.submit(self.run)
+
+    def run(self):
+        while True:
+            with self.lock:
+                if not self.tasks:
+                    self.running = False
+                    return
+                fn, args = self.tasks.popleft()
+            fn(*args)
+
+
+class ReplyWriter(object):
+    # The only writer of stdout, which is a binary channel only carrying the lines read by
+    # PIMELauncher ("PIME_MSG|..." and "PIME_TRACE|..."). Diagnostic output is sent to stderr.
+    # Lines queued while the previous write is in progress are coalesced into one write.
+    def __init__(self, fd):
+        self.fd = fd
+        self.lines = queue.Queue()
+        self.thread = threading.Thread(target=self.run, daemon=True)
+        self.thread.start()
+
+    def write_line(self, line):
+        self.lines.put(line.encode("utf-8", "ignore") + b"\n")
+
+    def run(self):
+        done = False
+        while not done:
+            batch = [self.lines.get()]
+            # take all pending lines without blocking
+            try:
+                while True:
+                    batch.append(self.lines.get_nowait())
+            except queue.Empty:
+                pass
+            if batch[-1] is None:  # closed
+                batch.pop()
+                done = True
+            data = memoryview(b"".join(batch))
+            while data:
+                written = os.write(self.fd, data)
+                data = data[written:]
+
+    def close(self):
+        self.lines.put(None)
+        self.thread.join()
+
+
 class Server(object):
     def __init__(self):
         self.clients = {}
+        self.executors = {}  # client => SerialExecutor
+        self.pool = None
+        self.output = None
+        self.stopping = False
+        self.stopLock = threading.Lock()
 
     def run(self):
+        sys.stdout.flush()
+        self.output = ReplyWriter(sys.stdout.fileno())
+        # print() of the text services and the server is diagnostic output, which goes to stderr
+        sys.stdout = sys.stderr
+        self.pool = concurrent.futures.ThreadPoolExecutor(max_workers=MAX_WORKER_THREADS)
+        # input methods to load in advance are passed by PIMELauncher in a comma separated list
+        preloadGuids = [guid for guid in os.environ.get("PIME_PRELOAD", "").split(",") if guid]
+        if preloadGuids:
+            textServiceMgr.preload(preloadGuids, self.report_ready)
+        # this thread only reads the requests and dispatches them to the executors of the clients
         while True:
             line = ""
             client_id = ""
@@ -73,42 +165,109 @@ class Server(object):
                 # parse PIME requests (one request per line):
                 # request format: "<client_id>|<JSON string>\n"
                 # response format: "PIME_MSG|<client_id>|<JSON string>\n"
+                decodeBegin = time.perf_counter()
                 client_id, msg_text = line.split('|', maxsplit=1)
                 msg = json.loads(msg_text)
+                decodeEnd = time.perf_counter()
                 client = self.clients.get(client_id)
                 if not client:
                     # create a Client instance for the client
                     client = Client(self)
                     self.clients[client_id] = client
+                    self.executors[client] = SerialExecutor(self.pool)
                     print("new client:", client_id)
                 if msg.get("method") == "close":  # special handling for closing a client
                     self.remove_client(client_id)
+                elif self.stopping:
+                    # the server is exiting after an error, and the pool does not take new requests
+                    self.write_error(client_id)
                 else:
-                    ret = client.handleRequest(msg)
-                    # Send the response to the client via stdout
-                    # one response per line in the format "PIME_MSG|<client_id>|<json reply>"
-                    reply_line = '|'.join(["PIME_MSG", client_id, json.dumps(ret, ensure_ascii=False)])
-                    print(reply_line)
+                    self.executors[client].submit(self.handle_request, client, client_id, msg, decodeBegin, decodeEnd)
             except EOFError:
                 # stop the server
                 break
             except Exception as e:
                 print("ERROR:", e, line)
-                # print the exception traceback for ease of debugging
                 traceback.print_exc()
-                # generate an empty output containing {success: False} to prevent the client from being blocked
-                reply_line = '|'.join(["PIME_MSG", client_id, '{"success":false}'])
-                print(reply_line)
-                # Just terminate the python server process if any unknown error happens.
-                # The python server will be restarted later by PIMELauncher.
-                sys.exit(1)
+                self.reply_error(client_id)
+        self.pool.shutdown(wait=True)
+        self.output.close()
+
+    # called in the threads of the pool
+    def handle_request(self, client, client_id, msg, decodeBegin, decodeEnd):
+        try:
+            handleBegin = time.perf_counter()
+            ret = client.handleRequest(msg)
+            # Send the response to the client via stdout
+            # one response per line in the format "PIME_MSG|<client_id>|<json reply>"
+            encodeBegin = time.perf_counter()
+            reply_line = '|'.join(["PIME_MSG", client_id, json.dumps(ret, ensure_ascii=False)])
+            self.output.write_line(reply_line)
+            if msg.get("trace"):  # request tracing is enabled by PIMELauncher
+                self.print_trace(client_id, msg.get("seqNum", 0), decodeBegin, decodeEnd, handleBegin, encodeBegin, time.perf_counter())
+        except Exception as e:
+            print("ERROR:", e, msg)
+            # print the exception traceback for ease of debugging
+            traceback.print_exc()
+            self.reply_error(client_id)
+
+    def reply_error(self, client_id):
+        self.write_error(client_id)
+        # Just terminate the python server process if any unknown error happens.
+        # The python server will be restarted later by PIMELauncher.
+        self.stop(1)
+
+    def write_error(self, client_id):
+        # generate an empty output containing {success: False} to prevent the client from being blocked
+        reply_line = '|'.join(["PIME_MSG", client_id, '{"success":false}'])
+        self.output.write_line(reply_line)
+
+    # called in any thread, including the threads of the pool
+    def stop(self, status):
+        with self.stopLock:
+            if self.stopping:
+                return
+            self.stopping = True
+        # the pool cannot be shut down by its own threads
+        threading.Thread(target=self.exit, args=(status,)).start()
+
+    def exit(self, status):
+        # the requests already dispatched to the pool are still handled and replied
+        self.pool.shutdown(wait=True)
+        self.output.close()
+        # The main thread is blocked in reading stdin and cannot be interrupted, so the process
+        # is terminated with os._exit(), which skips the atexit handlers. Run them first, so the
+        # data kept in memory by the input methods, such as the selection counts of cinbase, is
+        # written.
+        atexit._run_exitfuncs()
+        os._exit(status)
+
+    def print_trace(self, client_id, seqNum, decodeBegin, decodeEnd, handleBegin, encodeBegin, encodeEnd):
+        # trace events of the request in the format
+        # "PIME_TRACE|<client_id>|[[threadId, "name", seqNum, begin, end], ...]" with times in microseconds
+        threadId = threading.get_ident() & 0xffffffff
+        def event(name, begin, end):
+            return [threadId, name, seqNum, int(begin * 1000000), int(end * 1000000)]
+        events = [
+            event("backend.decode", decodeBegin, decodeEnd),
+            event("backend.queue", decodeEnd, handleBegin),
+            event("backend.handle", handleBegin, encodeBegin),
+            event("backend.encode", encodeBegin, encodeEnd)
+        ]
+        self.output.write_line('|'.join(["PIME_TRACE", client_id, json.dumps(events)]))
+
+    # called in the preload thread
+    def report_ready(self, guid, success, milliseconds):
+        # "PIME_READY|<guid>|{"success":<bool>,"time":<ms>}"
+        status = json.dumps({"success": success, "time": milliseconds})
+        self.output.write_line('|'.join(["PIME_READY", guid, status]))
 
     def remove_client(self, client_id):
         print("client disconnected:", client_id)
-        try:
-            del self.clients[client_id]
-        except KeyError:
-            pass
+        client = self.clients.pop(client_id, None)
+        if client:
+            # requests of the client which are still queued are handled by the executor before it's released
+            del self.executors[client]
 
 
 def main():
@@ -17,6 +17,7 @@
 
 import os
 import threading
+import time
 import json
 import importlib
 
@@ -61,6 +62,26 @@ class TextServiceInfo:
                 return None
         return self.textServiceClass(client) # create a new instance for this text service
 
+    # import the module of the text service and load its data before it's used by any client
+    def preload(self):
+        service = self.createInstance(PreloadClient(self.guid))
+        if not service:
+            return False
+        # wait for the data loaded in the background, such as the tables of cinbase
+        service.waitUntilReady()
+        return True
+
+
+# client of the text service instances created only for preloading
+class PreloadClient:
+    def __init__(self, guid):
+        self.guid = guid
+        self.isWindows8Above = True
+        self.isMetroApp = False
+        self.isUiLess = False
+        self.isConsole = False
+        self.candidateSection = ""
+
 
 class TextServiceManager:
     def __init__(self):
@@ -81,6 +102,25 @@ class TextServiceManager:
                 if info.guid:
                     self.services[info.guid] = info
 
+    # Preload the text services in a background thread so the first keystroke of a client
+    # does not wait for importing modules and loading tables.
+    # callback(guid, success, milliseconds) is called in the thread after each text service is loaded.
+    def preload(self, guids, callback):
+        def run():
+            for guid in guids:
+                info = self.services.get(guid.lower())
+                begin = time.perf_counter()
+                success = False
+                if info:
+                    try:
+                        success = info.preload()
+                    except Exception as e:
+                        print("failed to preload", guid, e)
+                callback(guid, success, int((time.perf_counter() - begin) * 1000))
+        thread = threading.Thread(target=run, daemon=True)
+        thread.start()
+        return thread
+
     def createService(self, client, guid):
         guid = guid.lower()
         if guid in self.services:
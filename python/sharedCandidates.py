@@ -0,0 +1,79 @@
+#! python3
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the
+# Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+
+# Writer of the shared memory section used to pass the candidate list to the client.
+# See PIMETextService/PIMECandidatePage.h for the layout.
+
+import mmap
+import struct
+from itertools import accumulate
+
+MAGIC = 0x47504350  # "PCPG"
+VERSION = 1
+HEADER_SIZE = 24
+SECTION_SIZE = 64 * 1024
+
+GENERATION_OFFSET = 8
+COUNT_OFFSET = 12
+
+
+class SharedCandidatePage(object):
+    # buf is a writable buffer of the section, already initialized by the client
+    def __init__(self, buf):
+        self.buf = buf
+        self.generation = struct.unpack_from("<I", buf, GENERATION_OFFSET)[0] & ~1
+
+    # open the section created by the client, returns None if it's not available
+    @classmethod
+    def open(cls, name):
+        try:
+            buf = mmap.mmap(-1, SECTION_SIZE, tagname=name)
+        except (OSError, TypeError):  # tagname is only supported on Windows
+            return None
+        magic, version = struct.unpack_from("<II", buf, 0)
+        if magic != MAGIC or version != VERSION:
+            # we created a new section instead of opening the one of the client
+            buf.close()
+            return None
+        return cls(buf)
+
+    def close(self):
+        self.buf.close()
+
+    # Write the candidate list to the section and return its generation.
+    # Returns 0 if the list does not fit so the caller should send it in JSON.
+    def write(self, candidates):
+        text = "".join(candidates).encode("utf-16-le")
+        ends = list(accumulate(map(len, candidates)))
+        end = len(text) // 2
+        if ends and ends[-1] != end:
+            # characters outside of the BMP take two UTF-16 code units
+            ends = list(accumulate(len(cand.encode("utf-16-le")) // 2 for cand in candidates))
+        endsSize = 4 * len(ends)
+        if HEADER_SIZE + endsSize + len(text) > len(self.buf):
+            return 0
+
+        buf = self.buf
+        # an odd generation tells the reader that we are writing the page
+        struct.pack_into("<I", buf, GENERATION_OFFSET, (self.generation + 1) & 0xffffffff)
+        struct.pack_into("<%dI" % len(ends), buf, HEADER_SIZE, *ends)
+        offset = HEADER_SIZE + endsSize
+        buf[offset:offset + len(text)] = text
+        struct.pack_into("<II", buf, COUNT_OFFSET, len(ends), end)
+        self.generation = (self.generation + 2) & 0xffffffff
+        if self.generation == 0:  # 0 is the generation of the empty page created by the client
+            self.generation = 2
+        struct.pack_into("<I", buf, GENERATION_OFFSET, self.generation)
+        return self.generation
@@ -15,6 +15,8 @@
 # License along with this library; if not, write to the Free Software
 # Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 
+from sharedCandidates import SharedCandidatePage
+
 # keyboard modifiers used by TSF (from msctf.h of Windows SDK)
 TF_MOD_ALT                       = 0x0001
 TF_MOD_CONTROL                   = 0x0002
@@ -73,6 +75,17 @@ class TextService:
         self.compositionCursor = 0
         self.candidateCursor = 0
 
+        # the candidate list last sent to the client and its page id,
+        # used to send only the changes of the candidate list.
+        self.sentCandidateList = []
+        self.candidatePage = 0
+
+        # shared memory section used to pass the candidate list, see enableSharedCandidates()
+        self.sharedCandidates = None
+
+        # keys the client may show in the composition string by itself, see setLocalEchoKeys()
+        self.localEchoKeys = None
+
     def updateStatus(self, msg):
         pass
 
@@ -95,7 +108,16 @@ class TextService:
             ret = self.filterKeyDown(keyEvent)
         elif method == "onKeyDown":
             keyEvent = KeyEvent(msg)
-            ret = self.onKeyDown(keyEvent)
+            if msg.get("localEcho", False):
+                # the client did not send filterKeyDown for this key, do it now.
+                if self.filterKeyDown(keyEvent):
+                    ret = self.onKeyDown(keyEvent)
+                else:
+                    # the client has eaten a key we do not want, give the character back.
+                    self.setCommitString(chr(keyEvent.charCode))
+                    ret = True
+            else:
+                ret = self.onKeyDown(keyEvent)
         elif method == "filterKeyUp":
             keyEvent = KeyEvent(msg)
             ret = self.filterKeyUp(keyEvent)
@@ -134,13 +156,64 @@ class TextService:
         # fetch the current reply of the method
         reply = self.currentReply
         self.currentReply = {}
+        if "candidateList" in reply:
+            self.encodeCandidateList(reply, msg.get("candidatePage", 0))
         if ret is not None:
             reply["return"] = ret
+        if self.localEchoKeys:
+            reply["localEcho"] = bool(self.canEchoLocally())
         reply["success"] = success
         reply["seqNum"] = seqNum  # reply with sequence number added
         return reply
 
+    # Replace the full candidate list in the reply with the changes since the
+    # list the client currently has, which is identified by clientPage.
+    def encodeCandidateList(self, reply, clientPage):
+        cand = reply["candidateList"]
+        old = self.sentCandidateList
+        clientHasList = (clientPage != 0 and clientPage == self.candidatePage)
+        if clientHasList and cand == old:  # nothing changed, only the candidate cursor is sent if needed
+            del reply["candidateList"]
+            return
+        generation = self.sharedCandidates.write(cand) if self.sharedCandidates else 0
+        if generation:
+            # the client reads the list from the shared memory section
+            del reply["candidateList"]
+            reply["candidateGeneration"] = generation
+        elif clientHasList:
+            del reply["candidateList"]
+            # find ranges of the list which are different from the old one
+            changes = []
+            i = 0
+            n = len(cand)
+            oldLen = len(old)
+            while i < n:
+                if i < oldLen and cand[i] == old[i]:
+                    i += 1
+                    continue
+                start = i
+                while i < n and not (i < oldLen and cand[i] == old[i]):
+                    i += 1
+                changes.append([start] + cand[start:i])
+            reply["candidateCount"] = n
+            reply["candidateChanges"] = changes
+        self.candidatePage += 1
+        reply["candidatePage"] = self.candidatePage
+        self.sentCandidateList = list(cand)
+
+    # Pass candidate lists through the shared memory section offered by the client
+    # instead of JSON. This is useful for input methods showing long candidate lists.
+    # The list is sent in JSON as before if the client does not support it.
+    def enableSharedCandidates(self):
+        name = getattr(self.client, "candidateSection", "")
+        if name and self.sharedCandidates is None:
+            self.sharedCandidates = SharedCandidatePage.open(name)
+
     # methods that should be implemented by derived classes
+    # block until the data loaded in the background is ready, called when the text service is preloaded
+    def waitUntilReady(self):
+        pass
+
     def onActivate(self):
         pass
 
@@ -252,6 +325,18 @@ class TextService:
     def setSelKeys(self, keys):
         self.currentReply["setSelKeys"] = keys
 
+    # Publish the key names the client may append to the composition string by itself.
+    # keys is a dict mapping lower case characters to their key names, or None to disable it.
+    # After each request, canEchoLocally() tells the client whether the next such keystroke
+    # only appends its key name, so the client can skip filterKeyDown for it.
+    def setLocalEchoKeys(self, keys):
+        self.localEchoKeys = keys
+        self.currentReply["localEchoKeys"] = keys if keys else {}
+
+    # This should be implemented in the derived class
+    def canEchoLocally(self):
+        return False
+
     def setKeyboardOpen(self, opened):
         self.currentReply["openKeyboard"] = opened
 
@@ -0,0 +1,24 @@
+# python3
+# coding=utf8
+#
+# Shared setup of the tests of cinbase (cintable_test.py, phrase_test.py, ...).
+
+import os
+import sys
+import types
+
+PYTHON_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "python")
+
+
+def import_cinbase():
+    # imports the modules of cinbase without running cinbase/__init__.py, which needs the
+    # keycodes and the TextService of the server
+    if PYTHON_DIR not in sys.path:
+        sys.path.insert(0, PYTHON_DIR)
+    if "cinbase" not in sys.modules:
+        package = types.ModuleType("cinbase")
+        package.__path__ = [os.path.join(PYTHON_DIR, "cinbase")]
+        sys.modules["cinbase"] = package
+
+
+__all__ = ["PYTHON_DIR", "import_cinbase"]
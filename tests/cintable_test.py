@@ -0,0 +1,232 @@
+# python3
+# coding=utf8
+#
+# Checks that the compiled tables read by PIMECinTable (NativeCin, NativeRCin, NativeHCin) give
+# the same results as the json tables (Cin, RCin, HCin) for some of the bundled tables.
+#
+# The compiled tables are built by PIMECinCompiler (PIMECinTable/CinCompilerMain.cpp), and the native
+# library (PIMECinTable.dll, or libPIMECinTable.so on other systems) should be in python/cinbase.
+#
+# Usage:
+#   python3 tests/cintable_test.py
+#   python3 tests/cintable_test.py CinTableTest.test_wildcard
+
+import io
+import os
+import random
+import unittest
+
+from cinbase_helper import PYTHON_DIR, import_cinbase
+
+TABLES = ("array30", "cj5", "bpmf")
+SAMPLES = 200
+
+
+import_cinbase()
+from cinbase import cintable, tableregistry
+from cinbase.cin import Cin
+from cinbase.extendtable import extendtable
+from cinbase.rcin import RCin
+from cinbase.hcin import HCin
+
+
+def jsonPath(name):
+    return os.path.join(PYTHON_DIR, "cinbase", "json", name + ".json")
+
+
+def loadJson(cls, name, *args):
+    with io.open(jsonPath(name), encoding="utf8") as fs:
+        return cls(fs, name, *args)
+
+
+def loadNative(cls, name, variant, *args):
+    handle = tableregistry.registry.open(cintable.getBinFile(jsonPath(name)), variant)
+    table = cls(handle.shared, name, *args)
+    table.handle = handle  # released with the table
+    return table
+
+
+def call(func, *args):
+    # the result of the call, or the type of the exception raised
+    try:
+        return func(*args)
+    except Exception as e:
+        return type(e)
+
+
+# the extend table inserted into a copy of the chardefs, as Cin.updateCinTable() did before the
+# chardefs were merged by ExtendedCharDefs
+def mutatedCharDefs(table, extend, priority):
+    chardefs = {key: list(table.basechardefs[key]) for key in table.basechardefs}
+    for key in extend.chardefs:
+        for root in extend.chardefs[key]:
+            if priority:
+                i = extend.chardefs[key].index(root)
+                try:
+                    chardefs[key.lower()].insert(i, root)
+                except KeyError:
+                    chardefs[key.lower()] = [root]
+            else:
+                try:
+                    chardefs[key.lower()].append(root)
+                except KeyError:
+                    chardefs[key.lower()] = [root]
+    return chardefs
+
+
+def cursorState(cursor):
+    return (cursor.isKey(), cursor.hasContinuation(), cursor.continuationCount(),
+            cursor.getKeys(2), cursor.getKeys(10))
+
+
+def missingTables():
+    if not cintable.isAvailable():
+        return "PIMECinTable is not available"
+    missing = [name for name in TABLES if not os.path.exists(cintable.getBinFile(jsonPath(name)))]
+    if missing:
+        return "the compiled tables are not found: " + " ".join(missing)
+    return None
+
+
+@unittest.skipIf(missingTables(), missingTables())
+class CinTableTest(unittest.TestCase):
+
+    def eachTable(self, cls, nativeCls, *args):
+        for name in TABLES:
+            yield name, loadJson(cls, name, *args), loadNative(nativeCls, name, tableregistry.VARIANT_ALL, *args)
+
+
+    def sampleKeys(self, table, rand):
+        keys = sorted(table.chardefs)
+        return rand.sample(keys, min(SAMPLES, len(keys)))
+
+
+    def sampleValues(self, table, rand):
+        values = sorted({value for values in table.chardefs.values() for value in values})
+        return rand.sample(values, min(SAMPLES, len(values))) + ["不存在"]
+
+
+    # keys typed one by one and deleted one by one with the same cursor, as in a composition
+    def checkKeyCursor(self, expected, actual, keys):
+        cursor = actual.keyCursor()
+        typed = [keys[:i] for i in range(len(keys) + 1)]
+        for prefix in typed + typed[-2::-1]:
+            self.assertEqual(cursorState(expected.keyCursor().moveTo(prefix)),
+                             cursorState(cursor.moveTo(prefix)), prefix)
+
+
+    def test_meta(self):
+        for name, expected, actual in self.eachTable(Cin, cintable.NativeCin, False):
+            with self.subTest(table=name):
+                self.assertEqual((expected.ename, expected.cname, expected.selkey),
+                                 (actual.ename, actual.cname, actual.selkey))
+                self.assertEqual(expected.cincount, actual.cincount)
+                for key in expected.keynames:
+                    self.assertTrue(actual.isInKeyName(key))
+                    self.assertEqual(expected.getKeyName(key), actual.getKeyName(key))
+
+
+    def test_chardef(self):
+        for pua in (False, True):
+            variant = tableregistry.VARIANT_SKIP_PRIVATE_USE if pua else tableregistry.VARIANT_ALL
+            for name in TABLES:
+                with self.subTest(table=name, ignorePrivateUseArea=pua):
+                    expected = loadJson(Cin, name, pua)
+                    actual = loadNative(cintable.NativeCin, name, variant, pua)
+                    self.assertEqual(list(expected.chardefs), list(actual.chardefs))
+                    for key in expected.chardefs:
+                        self.assertEqual(expected.getCharDef(key), actual.getCharDef(key), key)
+                    self.assertFalse(actual.isInCharDef("不存在"))
+
+
+    def test_reverse(self):
+        rand = random.Random(0)
+        for cls, nativeCls, args in ((Cin, cintable.NativeCin, (False,)), (RCin, cintable.NativeRCin, ())):
+            for name, expected, actual in self.eachTable(cls, nativeCls, *args):
+                with self.subTest(table=name, cls=cls.__name__):
+                    for value in self.sampleValues(expected, rand):
+                        self.assertEqual(expected.isHaveKey(value), actual.isHaveKey(value), value)
+                        self.assertEqual(call(expected.getKey, value), call(actual.getKey, value), value)
+                        self.assertEqual(call(expected.getCharEncode, value), call(actual.getCharEncode, value), value)
+
+
+    def test_homophone(self):
+        rand = random.Random(0)
+        for name, expected, actual in self.eachTable(HCin, cintable.NativeHCin):
+            with self.subTest(table=name):
+                for value in self.sampleValues(expected, rand):
+                    self.assertEqual(call(expected.getKey, value), call(actual.getKey, value), value)
+                    keyList = expected.getKeyList(value)
+                    self.assertEqual(keyList, actual.getKeyList(value), value)
+                    self.assertEqual(call(expected.getKeyNameList, keyList), call(actual.getKeyNameList, keyList), value)
+
+
+    def test_wildcard(self):
+        rand = random.Random(0)
+        for pua in (False, True):
+            variant = tableregistry.VARIANT_SKIP_PRIVATE_USE if pua else tableregistry.VARIANT_ALL
+            for name in TABLES:
+                with self.subTest(table=name, ignorePrivateUseArea=pua):
+                    expected = loadJson(Cin, name, pua)
+                    actual = loadNative(cintable.NativeCin, name, variant, pua)
+                    for key in self.sampleKeys(expected, rand)[:50]:
+                        # the first key character followed by wildcards, and every other character replaced
+                        patterns = (key[0] + "?" * (len(key) - 1),
+                                    "".join(c if i % 2 == 0 else "?" for i, c in enumerate(key)))
+                        for pattern in patterns:
+                            self.assertEqual(call(expected.getWildcardCharDefs, pattern, "?", 100),
+                                             call(actual.getWildcardCharDefs, pattern, "?", 100), pattern)
+
+
+    def test_keyCursor(self):
+        rand = random.Random(0)
+        for name, expected, actual in self.eachTable(Cin, cintable.NativeCin, False):
+            with self.subTest(table=name):
+                self.assertIsInstance(actual.keyCursor(), cintable.NativeKeyCursor)
+                for key in self.sampleKeys(expected, rand)[:50]:
+                    self.checkKeyCursor(expected, actual, key)
+                    self.checkKeyCursor(expected, actual, key + "~")
+
+                # one key of the table extended, and keys added under an existing prefix and a new one
+                key = self.sampleKeys(expected, rand)[0]
+                extend = extendtable(io.StringIO("%s 甲\n%s~ 乙\n%s~~ 丙\n~~ 丁\n" % (key, key[0], key[0])))
+                for table in (expected, actual):
+                    table.updateCinTable(True, False, extend, False)
+                for keys in (key, key[0] + "~~", "~~~"):
+                    self.checkKeyCursor(expected, actual, keys)
+                # the cursor follows the table when the extend table is turned off
+                for table in (expected, actual):
+                    table.updateCinTable(False, False, extend, False)
+                self.checkKeyCursor(expected, actual, key[0] + "~~")
+
+
+    def test_extendTable(self):
+        rand = random.Random(0)
+        for name, expected, actual in self.eachTable(Cin, cintable.NativeCin, False):
+            with self.subTest(table=name):
+                keys = self.sampleKeys(expected, rand)[:3]
+                # roots added to existing keys (one of them already there, one repeated), and new keys
+                lines = ["%s 甲" % keys[0], "%s 乙" % keys[0], "%s %s" % (keys[1], expected.chardefs[keys[1]][0]),
+                         "%s 丙" % keys[2], "%s 丙" % keys[2], "%s~ 丁" % keys[0][0], "~~ 戊", "~~ 己"]
+                extend = extendtable(io.StringIO("\n".join(lines) + "\n"))
+                base = {key: list(expected.chardefs[key]) for key in keys}
+                for priority in (False, True):
+                    mutated = mutatedCharDefs(expected, extend, priority)
+                    for table in (expected, actual):
+                        table.updateCinTable(True, priority, extend, False)
+                        self.assertEqual(list(mutated), list(table.chardefs), priority)
+                        for key in list(extend.chardefs) + keys:
+                            self.assertTrue(table.isInCharDef(key))
+                            self.assertEqual(mutated[key], table.getCharDef(key), (key, priority))
+                    self.assertEqual(mutated[keys[0]], actual.getMutableCharDef(keys[0]))
+
+                # the lists of the table are not modified, and are used again without the extend table
+                for table in (expected, actual):
+                    table.updateCinTable(False, False, extend, False)
+                    self.assertFalse(table.isInCharDef("~~"))
+                    for key in keys:
+                        self.assertEqual(base[key], table.getCharDef(key), key)
+
+
+if __name__ == "__main__":
+    unittest.main()
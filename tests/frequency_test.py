@@ -0,0 +1,165 @@
+# python3
+# coding=utf8
+#
+# Checks the counts of the selected candidates of cinbase (frequency.py): the candidates moved to
+# the front, the queued selections merged with the file, the growth of the file, the failed writes
+# and the files which cannot be used.
+#
+# Usage:
+#   python3 tests/frequency_test.py
+
+import os
+import tempfile
+import unittest
+
+from cinbase_helper import import_cinbase
+
+import_cinbase()
+from cinbase import frequency
+from cinbase.frequency import FrequencyStore, valueHash
+
+
+CANDIDATES = ["甲", "乙", "丙"]
+
+
+class FrequencyTest(unittest.TestCase):
+
+    def setUp(self):
+        self.dir = tempfile.TemporaryDirectory()
+        self.path = os.path.join(self.dir.name, "frequency.dat")
+        self.stores = []
+
+
+    def tearDown(self):
+        for store in self.stores:
+            store.disable()
+        self.dir.cleanup()
+
+
+    def openStore(self):
+        store = FrequencyStore(self.path)
+        self.stores.append(store)
+        return store
+
+
+    def sortCandidates(self, store, key):
+        return store.sortCandidates(key, list(CANDIDATES))
+
+
+    # the counts decay a little with the selections written after them
+    def assertCounts(self, expected, actual):
+        self.assertEqual(set(expected), set(actual))
+        for vhash, count in expected.items():
+            self.assertAlmostEqual(count, actual[vhash], places=2)
+
+
+    def test_promotion(self):
+        store = self.openStore()
+        store.record("ab", "乙")
+        self.assertEqual(self.sortCandidates(store, "ab"), ["甲", "乙", "丙"])
+        for i in range(int(frequency.MIN_COUNT) - 1):
+            store.record("ab", "乙")
+        # the queued selections already count
+        self.assertEqual(self.sortCandidates(store, "ab"), ["乙", "甲", "丙"])
+        store.flush()
+        self.assertEqual(self.sortCandidates(store, "ab"), ["乙", "甲", "丙"])
+
+        # selections of other keys decay the counts, but the candidate stays in front for a while
+        store.record("cd", "丁")
+        store.flush()
+        self.assertLess(store.getCounts("ab")[valueHash("乙")], frequency.MIN_COUNT)
+        self.assertEqual(self.sortCandidates(store, "ab"), ["乙", "甲", "丙"])
+        for i in range(frequency.RECENT - 2):
+            store.record("cd", "丁")
+        store.flush()
+        self.assertEqual(self.sortCandidates(store, "ab"), ["乙", "甲", "丙"])
+        for i in range(10):
+            store.record("cd", "丁")
+        store.flush()
+        self.assertEqual(self.sortCandidates(store, "ab"), ["甲", "乙", "丙"])
+
+
+    def test_getCounts_queued_and_written(self):
+        store = self.openStore()
+        store.record("ab", "甲")
+        store.record("ab", "乙")
+        store.flush()
+        store.record("ab", "乙")
+        store.record("ab", "丙")
+        counts = store.getCounts("ab")
+        self.assertEqual(counts, {valueHash("甲"): 1.0, valueHash("乙"): 2.0, valueHash("丙"): 1.0})
+        self.assertEqual(self.sortCandidates(store, "ab"), ["乙", "甲", "丙"])
+        store.flush()
+        self.assertCounts(counts, store.getCounts("ab"))
+        self.assertEqual(store.getCounts("cd"), {})
+
+
+    def test_grow(self):
+        store = self.openStore()
+        keyCount = int(frequency.INITIAL_SLOTS * frequency.MAX_LOAD) + 100
+        for i in range(keyCount):
+            store.record("k%d" % i, "v%d" % i)
+        store.flush()
+        self.assertEqual(store.slotCount, frequency.INITIAL_SLOTS * 2)
+        self.assertEqual(store.usedSlots, keyCount)
+        counts = {i: store.getCounts("k%d" % i) for i in range(keyCount)}
+        for i in range(keyCount):
+            self.assertEqual(list(counts[i]), [valueHash("v%d" % i)], i)
+
+        # the counts are read again from the file
+        store.disable()
+        store = self.openStore()
+        self.assertEqual((store.slotCount, store.usedSlots), (frequency.INITIAL_SLOTS * 2, keyCount))
+        self.assertEqual({i: store.getCounts("k%d" % i) for i in range(keyCount)}, counts)
+
+
+    def test_failed_flush(self):
+        store = self.openStore()
+        for key in ("ab", "cd", "ef"):
+            for i in range(3):
+                store.record(key, key + "甲")
+        before = {key: store.getCounts(key) for key in ("ab", "cd", "ef")}
+
+        addCounts = store.addCounts
+        calls = []
+        def failingAddCounts(key, values):
+            calls.append(key)
+            if len(calls) == 2:
+                raise OSError("the disk is full")
+            addCounts(key, values)
+        store.addCounts = failingAddCounts
+        with self.assertRaises(OSError):
+            store.flush()
+        # the selections not written are queued again, and the lookups still see all of them
+        self.assertEqual(store.writing, {})
+        self.assertEqual(store.pendingCount, 6)
+        self.assertEqual({key: store.getCounts(key) for key in before}, before)
+
+        store.addCounts = addCounts
+        store.flush()
+        self.assertEqual(store.pending, {})
+        store.disable()
+        store = self.openStore()
+        for key in before:
+            self.assertCounts(before[key], store.getCounts(key))
+
+
+    def test_invalid_file(self):
+        header = frequency.HEADER.pack(frequency.FILE_MAGIC, frequency.FILE_VERSION, frequency.INITIAL_SLOTS, 0, 0, 0)
+        for name, data in (("empty", b""), ("short header", header[:10]), ("wrong magic", b"X" * len(header)),
+                           ("truncated", header + b"\0" * frequency.SLOT_SIZE)):
+            with self.subTest(file=name):
+                with open(self.path, "wb") as f:
+                    f.write(data)
+                store = self.openStore()
+                self.assertEqual((store.slotCount, store.usedSlots, store.tick), (frequency.INITIAL_SLOTS, 0, 0))
+                self.assertEqual(os.path.getsize(self.path),
+                                 frequency.HEADER.size + frequency.INITIAL_SLOTS * frequency.SLOT_SIZE)
+                store.record("ab", "乙")
+                store.flush()
+                self.assertEqual(store.getCounts("ab"), {valueHash("乙"): 1.0})
+                store.disable()
+
+
+if __name__ == "__main__":
+    unittest.main()
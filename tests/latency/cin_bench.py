@@ -0,0 +1,203 @@
+# python3
+# coding=utf8
+#
+# Micro benchmarks of the cin table lookups of cinbase, comparing the json tables (Cin, RCin,
+# HCin) with the compiled tables read by PIMECinTable (NativeCin, NativeRCin, NativeHCin).
+#
+# Usage:
+#   python3 tests/latency/cin_bench.py reverse                   # all bundled tables
+#   python3 tests/latency/cin_bench.py reverse --tables checj bpmf --samples 200
+#   python3 tests/latency/cin_bench.py wildcard --tables array30 cj5 dayi4
+#   python3 tests/latency/cin_bench.py memory                    # resident memory of three input methods
+#
+# Benchmarks:
+#   reverse: isHaveKey() + getKey(), getCharEncode(), and getKeyList() of random values
+#   wildcard: getWildcardCharDefs() of patterns made from random keys, where the wildcard "*"
+#             matches one character as in cinbase: the first key character followed by
+#             wildcards ("a***"), every other character replaced ("a*b*"), and all wildcards
+#   memory: resident memory after loading the tables of checj, chephonetic, and chearray with the
+#           default tables and ignorePrivateUseArea, and with reverse lookups and homophones on:
+#           each loads its main table, checj as the table of reverse lookups, and thphonetic as
+#           the table of homophones. Each configuration runs in a new process,
+#           comparing the json and the compiled tables, shared by tableregistry or loaded
+#           separately by each input method as before.
+#
+# The compiled tables are built by PIMECinCompiler (PIMECinTable/CinCompilerMain.cpp), and the native
+# library (PIMECinTable.dll, or libPIMECinTable.so on other systems) should be in python/cinbase.
+
+import argparse
+import ctypes
+import io
+import os
+import random
+import subprocess
+import sys
+import time
+import types
+
+
+TOP_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+CINBASE_DIR = os.path.join(TOP_DIR, "python", "cinbase")
+JSON_DIR = os.path.join(CINBASE_DIR, "json")
+
+
+def import_cinbase():
+    # import the table modules without cinbase/__init__.py, which only runs on Windows
+    package = types.ModuleType("cinbase")
+    package.__path__ = [CINBASE_DIR]
+    sys.modules["cinbase"] = package
+    sys.path.insert(0, os.path.join(TOP_DIR, "python"))
+    from cinbase import cin, rcin, hcin, cintable, tableregistry
+    return cin, rcin, hcin, cintable, tableregistry
+
+
+cin, rcin, hcin, cintable, tableregistry = import_cinbase()
+
+
+def table_names(args):
+    names = sorted(os.path.splitext(name)[0] for name in os.listdir(JSON_DIR) if name.endswith(".json"))
+    if args.tables:
+        names = [name for name in names if name in args.tables]
+    return [name for name in names if os.path.exists(cintable.getBinFile(name + ".json"))]
+
+
+def load_json(cls, name, *args):
+    with io.open(os.path.join(JSON_DIR, name + ".json"), encoding="utf-8") as fs:
+        return cls(fs, *args)
+
+
+def load_native(cls, name, variant, *args):
+    handle = tableregistry.registry.open(cintable.getBinFile(name + ".json"), variant)
+    return cls(handle.shared, *args)
+
+
+def measure(func, inputs):
+    # returns microseconds per call
+    begin = time.perf_counter()
+    for value in inputs:
+        func(value)
+    return (time.perf_counter() - begin) * 1000000 / max(len(inputs), 1)
+
+
+def print_row(name, method, jsonTime, nativeTime):
+    print("%-12s %-22s json %10.1f us  native %8.1f us  x%.0f" % (
+        name, method, jsonTime, nativeTime, jsonTime / nativeTime if nativeTime else 0))
+
+
+def bench_reverse(args):
+    for name in table_names(args):
+        jsonCin = load_json(cin.Cin, name, "bench", True)
+        nativeCin = load_native(cintable.NativeCin, name, tableregistry.VARIANT_SKIP_PRIVATE_USE, "bench", True)
+        jsonHCin = load_json(hcin.HCin, name, "bench")
+        nativeHCin = load_native(cintable.NativeHCin, name, tableregistry.VARIANT_ALL, "bench")
+        values = sorted({value for values in jsonCin.chardefs.values() for value in values})
+        samples = random.Random(name).sample(values, min(args.samples, len(values)))
+
+        def haveKey(table):
+            return lambda value: table.isHaveKey(value) and table.getKey(value)
+
+        def charEncode(table):
+            def encode(value):
+                try:
+                    table.getCharEncode(value)
+                except KeyError:  # keys without %keyname
+                    pass
+            return encode
+
+        print_row(name, "isHaveKey+getKey", measure(haveKey(jsonCin), samples), measure(haveKey(nativeCin), samples))
+        print_row(name, "getCharEncode", measure(charEncode(jsonCin), samples), measure(charEncode(nativeCin), samples))
+        print_row(name, "HCin.getKeyList", measure(jsonHCin.getKeyList, samples), measure(nativeHCin.getKeyList, samples))
+
+
+def bench_wildcard(args):
+    candMaxItems = 100  # default of cinbase
+    for name in table_names(args):
+        jsonCin = load_json(cin.Cin, name, "bench", True)
+        nativeCin = load_native(cintable.NativeCin, name, tableregistry.VARIANT_SKIP_PRIVATE_USE, "bench", True)
+        keys = sorted(key for key in jsonCin.chardefs if len(key) >= 2 and "*" not in key)
+        samples = random.Random(name).sample(keys, min(args.samples, len(keys)))
+        patterns = {
+            "a***": [key[0] + "*" * (len(key) - 1) for key in samples],
+            "a*b*": ["".join("*" if i % 2 else c for i, c in enumerate(key)) for key in samples],
+            "****": ["*" * len(key) for key in samples[:5]],
+        }
+
+        def wildcard(table):
+            return lambda pattern: table.getWildcardCharDefs(pattern, "*", candMaxItems)
+
+        for kind, inputs in patterns.items():
+            print_row(name, "wildcard " + kind, measure(wildcard(jsonCin), inputs), measure(wildcard(nativeCin), inputs))
+
+
+# main tables of the input methods of the memory benchmark, and their defaults of selRCinType
+# and selHCinType
+MEMORY_MAIN_TABLES = ["checj", "thphonetic", "tharray"]
+MEMORY_REVERSE_TABLE = "checj"
+MEMORY_HOMOPHONE_TABLE = "thphonetic"
+
+
+def resident_memory():
+    # resident set size of this process in bytes
+    if sys.platform == "win32":
+        class PROCESS_MEMORY_COUNTERS(ctypes.Structure):
+            _fields_ = [("cb", ctypes.c_ulong), ("PageFaultCount", ctypes.c_ulong)] + [
+                (name, ctypes.c_size_t) for name in ("PeakWorkingSetSize", "WorkingSetSize", "QuotaPeakPagedPoolUsage",
+                                                     "QuotaPagedPoolUsage", "QuotaPeakNonPagedPoolUsage",
+                                                     "QuotaNonPagedPoolUsage", "PagefileUsage", "PeakPagefileUsage")]
+        counters = PROCESS_MEMORY_COUNTERS()
+        counters.cb = ctypes.sizeof(counters)
+        ctypes.windll.psapi.GetProcessMemoryInfo(ctypes.windll.kernel32.GetCurrentProcess(), ctypes.byref(counters), counters.cb)
+        return counters.WorkingSetSize
+    with open("/proc/self/statm") as f:
+        return int(f.read().split()[1]) * os.sysconf("SC_PAGE_SIZE")
+
+
+def load_input_methods(native, shared):
+    # the tables loaded by LoadCinTable, LoadRCinTable, and LoadHCinTable of each input method
+    if not native:
+        cintable._lib = None  # tableregistry falls back to the json tables
+    tables = []
+    for name in MEMORY_MAIN_TABLES:
+        registry = tableregistry.registry if shared else tableregistry.TableRegistry()
+        loads = [(cin.Cin, cintable.NativeCin, name, tableregistry.VARIANT_SKIP_PRIVATE_USE, ("bench", True)),
+                 (rcin.RCin, cintable.NativeRCin, MEMORY_REVERSE_TABLE, tableregistry.VARIANT_ALL, ("bench",)),
+                 (hcin.HCin, cintable.NativeHCin, MEMORY_HOMOPHONE_TABLE, tableregistry.VARIANT_ALL, ("bench",))]
+        for cls, nativeCls, table, variant, args in loads:
+            if not shared:  # each table of each input method was loaded separately
+                registry = tableregistry.TableRegistry()
+            handle = registry.open(tableregistry.getTablePath(os.path.join(JSON_DIR, table + ".json")), variant)
+            tables.append((nativeCls if handle.shared.table is not None else cls)(handle.shared, *args))
+    return tables
+
+
+def bench_memory(args):
+    if args.child:
+        before = resident_memory()
+        tables = load_input_methods(args.child[0] == "native", args.child[1] == "shared")
+        # touch the values as typing does, so the pages of the compiled tables are resident
+        for table in tables:
+            for key in list(table.chardefs)[::50]:
+                table.getCharDef(key)
+        print(resident_memory() - before)
+        return
+    for native in ("json", "native"):
+        for shared in ("separate", "shared"):
+            output = subprocess.check_output([sys.executable, __file__, "memory", "--child", native, shared])
+            print("%-8s %-9s %8.1f MB" % (native, shared, int(output.decode().split()[-1]) / 1048576))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark the cin table lookups of cinbase")
+    parser.add_argument("benchmark", choices=("reverse", "wildcard", "memory"))
+    parser.add_argument("--tables", nargs="*", help="names of the tables (default: all bundled tables)")
+    parser.add_argument("--samples", type=int, default=100, help="number of random inputs per table")
+    parser.add_argument("--child", nargs=2, help=argparse.SUPPRESS)
+    args = parser.parse_args()
+    if not cintable.isAvailable():
+        print("PIMECinTable library is not found in %s" % CINBASE_DIR)
+        sys.exit(1)
+    {"reverse": bench_reverse, "wildcard": bench_wildcard, "memory": bench_memory}[args.benchmark](args)
+
+
+if __name__ == "__main__":
+    main()
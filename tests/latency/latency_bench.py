@@ -0,0 +1,650 @@
+# python3
+# coding=utf8
+#
+# Headless keystroke latency benchmark for PIME backends.
+#
+# The real typing path is: PIMETextService (PIME::Client) => named pipe => PIMELauncher
+# (PipeClient/BackendServer) => stdin of the backend => stdout "PIME_MSG|..." lines => back to
+# the text service. This script reproduces that path without Windows:
+#   * LauncherEmulator routes messages exactly like PIMELauncher does (session framing
+#     "<session id>|<json>", client IDs "<pipe id>#<session id>", "close" handling, "init"
+#     based backend selection, lazy backend startup, and log lines ignored on stdout).
+#     The named pipe is replaced by an AF_UNIX SOCK_SEQPACKET socket which keeps message
+#     boundaries like a message mode pipe.
+#   * SyntheticClient writes requests like PIME::Client (key order, fields, keyStates,
+#     candidatePage) and replays typing corpora key by key: filterKeyDown, onKeyDown if the
+#     key is filtered, then filterKeyUp and onKeyUp.
+#
+# The backends are the real python/server.py and node/server.js, started from backends.json.
+#
+# Usage:
+#   python3 tests/latency/latency_bench.py                      # run all corpora on all backends
+#   python3 tests/latency/latency_bench.py --corpus meow --backend node
+#   python3 tests/latency/latency_bench.py --clients 4       # several text services typing at once
+#   python3 tests/latency/latency_bench.py --save-baseline tests/latency/baseline.json
+#   python3 tests/latency/latency_bench.py --compare tests/latency/baseline.json
+#   python3 tests/latency/latency_bench.py --record <dir>    # write captures for replay.py
+#
+# Corpora are in tests/latency/corpora/<name>.txt. The "# ime: <dir>" line selects the input
+# method directory under <backend>/input_methods. Each other non-comment line is typed as a
+# sequence of keys. Characters are typed as is, and {space} {enter} {esc} {bs} {tab} {left}
+# {right} {up} {down} {home} {end} {pgup} {pgdn} {del} are special keys.
+
+import argparse
+import json
+import os
+import platform
+import selectors
+import socket
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+import uuid
+
+from pimecap import CaptureWriter
+
+
+TOP_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+CORPORA_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "corpora")
+
+# reply sent by the launcher when a session is closed
+SESSION_CLOSED_REPLY = b'{"success":true}'
+# reply sent by the launcher when no backend is available for a session
+NO_BACKEND_REPLY = b'{"success":false}'
+
+# same limit as the read buffer of the text service
+MAX_MESSAGE_SIZE = 1024 * 1024
+
+VK_SHIFT = 0x10
+
+# minimal number of samples of a method to be compared with the baseline
+MIN_COMPARED_COUNT = 100
+
+# special keys: name => (virtual key code, char code)
+SPECIAL_KEYS = {
+    "space": (0x20, 0x20),
+    "enter": (0x0D, 0x0D),
+    "esc": (0x1B, 0x1B),
+    "bs": (0x08, 0x08),
+    "tab": (0x09, 0x09),
+    "left": (0x25, 0),
+    "up": (0x26, 0),
+    "right": (0x27, 0),
+    "down": (0x28, 0),
+    "home": (0x24, 0),
+    "end": (0x23, 0),
+    "pgup": (0x21, 0),
+    "pgdn": (0x22, 0),
+    "del": (0x2E, 0),
+}
+
+# virtual key codes of punctuation keys on the US keyboard: char => (vk, shifted)
+OEM_KEYS = {
+    ';': (0xBA, False), ':': (0xBA, True),
+    '=': (0xBB, False), '+': (0xBB, True),
+    ',': (0xBC, False), '<': (0xBC, True),
+    '-': (0xBD, False), '_': (0xBD, True),
+    '.': (0xBE, False), '>': (0xBE, True),
+    '/': (0xBF, False), '?': (0xBF, True),
+    '`': (0xC0, False), '~': (0xC0, True),
+    '[': (0xDB, False), '{': (0xDB, True),
+    '\\': (0xDC, False), '|': (0xDC, True),
+    ']': (0xDD, False), '}': (0xDD, True),
+    "'": (0xDE, False), '"': (0xDE, True),
+}
+SHIFTED_DIGITS = ")!@#$%^&*("
+
+
+class Key:
+    def __init__(self, keyCode, charCode, shift=False):
+        self.keyCode = keyCode
+        self.charCode = charCode
+        self.shift = shift
+
+
+def key_from_char(ch):
+    if 'a' <= ch <= 'z':
+        return Key(ord(ch.upper()), ord(ch))
+    if 'A' <= ch <= 'Z':
+        return Key(ord(ch), ord(ch), shift=True)
+    if '0' <= ch <= '9':
+        return Key(ord(ch), ord(ch))
+    if ch in SHIFTED_DIGITS:
+        return Key(ord('0') + SHIFTED_DIGITS.index(ch), ord(ch), shift=True)
+    if ch == ' ':
+        return Key(0x20, 0x20)
+    if ch in OEM_KEYS:
+        vk, shift = OEM_KEYS[ch]
+        return Key(vk, ord(ch), shift)
+    raise ValueError("unsupported key: %r" % ch)
+
+
+def parse_keys(line):
+    keys = []
+    i = 0
+    while i < len(line):
+        ch = line[i]
+        if ch == '{':
+            end = line.find('}', i)
+            name = line[i + 1:end] if end > i + 1 else ""
+            if name in SPECIAL_KEYS:
+                keyCode, charCode = SPECIAL_KEYS[name]
+                keys.append(Key(keyCode, charCode))
+                i = end + 1
+                continue
+        keys.append(key_from_char(ch))
+        i += 1
+    return keys
+
+
+class Corpus:
+    def __init__(self, name, ime, lines):
+        self.name = name
+        self.ime = ime
+        self.lines = lines  # list of key lists
+
+    @classmethod
+    def load(cls, filename):
+        name = os.path.splitext(os.path.basename(filename))[0]
+        ime = name
+        lines = []
+        with open(filename, "r", encoding="utf-8") as f:
+            for line in f:
+                line = line.rstrip("\r\n")
+                if line.startswith("#"):
+                    directive = line[1:].strip()
+                    if directive.startswith("ime:"):
+                        ime = directive[4:].strip()
+                    continue
+                if line:
+                    lines.append(parse_keys(line))
+        return cls(name, ime, lines)
+
+
+class Backend:
+    # A backend process, like BackendServer of PIMELauncher
+    def __init__(self, info, command):
+        self.name = info["name"]
+        self.workingDir = os.path.join(TOP_DIR, info["workingDir"])
+        self.command = command
+        self.process = None
+        self.readBuf = b""
+
+    def find_ime(self, ime):
+        # return the guid of the input method in the input_methods dir of the backend
+        filename = os.path.join(self.workingDir, "input_methods", ime, "ime.json")
+        if not os.path.exists(filename):
+            return None
+        with open(filename, "r", encoding="utf-8-sig") as f:
+            return json.load(f)["guid"]
+
+    def is_running(self):
+        return self.process is not None and self.process.poll() is None
+
+    def start(self, launcher):
+        self.process = subprocess.Popen(self.command, cwd=self.workingDir, bufsize=0,
+                                        stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+        os.set_blocking(self.process.stdout.fileno(), False)
+        self.readBuf = b""
+        launcher.selector.register(self.process.stdout, selectors.EVENT_READ, (launcher.on_backend_output, self))
+
+    def stop(self, launcher):
+        if self.process:
+            try:
+                launcher.selector.unregister(self.process.stdout)
+            except (KeyError, ValueError):
+                pass
+            try:
+                self.process.stdin.close()
+                self.process.wait(5)
+            except (OSError, subprocess.TimeoutExpired):
+                self.process.kill()
+            self.process = None
+
+    def write(self, data):
+        self.process.stdin.write(data)
+
+
+class PipeClient:
+    # A connection from a text service process, like PipeClient of PIMELauncher
+    def __init__(self, sock):
+        self.sock = sock
+        self.id = "{%s}" % uuid.uuid4()
+        self.sessions = {}  # session id => [backend, client id]
+
+
+class LauncherEmulator:
+    def __init__(self, backend, guid, socketPath, recorder=None):
+        self.backend = backend
+        self.guid = guid.lower()
+        self.socketPath = socketPath
+        self.recorder = recorder  # CaptureWriter recording the traffic like PIMELauncher
+        self.selector = selectors.DefaultSelector()
+        self.clients = {}  # pipe id => PipeClient
+        self.listener = socket.socket(socket.AF_UNIX, socket.SOCK_SEQPACKET)
+        self.listener.bind(socketPath)
+        self.listener.listen(8)
+        self.selector.register(self.listener, selectors.EVENT_READ, (self.on_new_client, None))
+        self.quitReader, self.quitWriter = socket.socketpair()
+        self.selector.register(self.quitReader, selectors.EVENT_READ, (None, None))
+        self.thread = threading.Thread(target=self.run, daemon=True)
+
+    def start(self):
+        self.thread.start()
+
+    def quit(self):
+        self.quitWriter.send(b"q")
+        self.thread.join()
+        self.backend.stop(self)
+        for client in self.clients.values():
+            client.sock.close()
+        self.listener.close()
+        self.selector.close()
+
+    def run(self):
+        while True:
+            for key, mask in self.selector.select():
+                callback, data = key.data
+                if callback is None:  # quit
+                    return
+                callback(key.fileobj, data)
+
+    def on_new_client(self, listener, data):
+        sock, addr = listener.accept()
+        client = PipeClient(sock)
+        self.clients[client.id] = client
+        self.selector.register(sock, selectors.EVENT_READ, (self.on_client_data, client))
+
+    def on_client_data(self, sock, client):
+        msg = sock.recv(MAX_MESSAGE_SIZE)
+        if not msg:
+            self.disconnect(client)
+            return
+        # message format: "<session id>|<json string>" or "<json string>" for session 0
+        sessionId = 0
+        if msg[:1].isdigit():
+            sep = msg.index(b"|")
+            sessionId = int(msg[:sep])
+            msg = msg[sep + 1:]
+        session = client.sessions.get(sessionId)
+        if session is None:
+            clientId = client.id if sessionId == 0 else "%s#%d" % (client.id, sessionId)
+            session = [None, clientId]
+            client.sessions[sessionId] = session
+
+        if msg.startswith(b'{"method":"close"'):
+            if session[0]:
+                if self.recorder:
+                    self.recorder.record_request(session[0].name, session[1], msg)
+                session[0].write(session[1].encode() + b"|" + msg + b"\n")
+            del client.sessions[sessionId]
+            self.write_reply(client, sessionId, SESSION_CLOSED_REPLY)
+            return
+
+        if session[0] is None:
+            # the backend is selected by the "id" of the "init" request
+            try:
+                params = json.loads(msg)
+            except ValueError:
+                params = {}
+            if params.get("method") == "init" and params.get("id", "").lower() == self.guid:
+                session[0] = self.backend
+
+        backend = session[0]
+        if backend:
+            if not backend.is_running():
+                backend.start(self)
+                if self.recorder:
+                    self.recorder.record_restart(backend.name)
+            if self.recorder:
+                self.recorder.record_request(backend.name, session[1], msg)
+            backend.write(session[1].encode() + b"|" + msg + b"\n")
+        else:
+            self.write_reply(client, sessionId, NO_BACKEND_REPLY)
+
+    def on_backend_output(self, stdout, backend):
+        try:
+            data = stdout.read()
+        except BlockingIOError:
+            return
+        if not data:  # the backend is terminated
+            self.selector.unregister(stdout)
+            return
+        backend.readBuf += data
+        lines = backend.readBuf.split(b"\n")
+        backend.readBuf = lines.pop()
+        for line in lines:
+            # only handle lines prefixed with "PIME_MSG|" since others are logs
+            if not line.startswith(b"PIME_MSG|"):
+                continue
+            clientId, sep, reply = line[9:].rstrip(b"\r").partition(b"|")
+            clientId = clientId.decode()
+            if self.recorder:
+                self.recorder.record_reply(backend.name, clientId, reply)
+            pipeId, sep, sessionId = clientId.partition("#")
+            client = self.clients.get(pipeId)
+            if client:
+                self.write_reply(client, int(sessionId) if sessionId else 0, reply)
+
+    def write_reply(self, client, sessionId, reply):
+        prefix = b"%d|" % sessionId if sessionId else b""
+        try:
+            client.sock.send(prefix + reply)
+        except OSError:
+            self.disconnect(client)
+
+    def disconnect(self, client):
+        msg = b'{"method":"close"}'
+        for backend, clientId in client.sessions.values():
+            if backend and backend.is_running():
+                backend.write(clientId.encode() + b"|" + msg + b"\n")
+        client.sessions.clear()
+        self.selector.unregister(client.sock)
+        client.sock.close()
+        del self.clients[client.id]
+
+
+class SyntheticClient:
+    # Sends requests the same way as PIME::Client does
+    def __init__(self, socketPath, guid, sessionId=1):
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_SEQPACKET)
+        self.sock.connect(socketPath)
+        self.guid = guid
+        self.sessionId = sessionId
+        self.seqNum = 0
+        self.candidatePage = 0
+        self.candidateList = []
+        self.keyStates = [0] * 256
+        self.latencies = {}  # method => list of latencies in ms
+
+    def close(self):
+        self.request("close")
+        self.sock.close()
+
+    def request(self, method, *fields):
+        # "method" and "seqNum" are always the first keys, like PIME::RequestWriter
+        parts = ['{"method":"%s","seqNum":%d' % (method, self.seqNum)]
+        if self.candidatePage != 0 and method != "close":
+            parts.append(',"candidatePage":%d' % self.candidatePage)
+        for name, value in fields:
+            parts.append(',"%s":%s' % (name, json.dumps(value, separators=(",", ":"))))
+        parts.append("}")
+        msg = ("%d|%s" % (self.sessionId, "".join(parts))).encode("utf-8")
+        seqNum = self.seqNum
+        self.seqNum += 1
+
+        begin = time.perf_counter()
+        self.sock.send(msg)
+        reply = self.sock.recv(MAX_MESSAGE_SIZE)
+        latency = (time.perf_counter() - begin) * 1000
+        self.latencies.setdefault(method, []).append(latency)
+
+        prefix, sep, text = reply.partition(b"|")
+        reply = json.loads(text if sep and prefix.isdigit() else reply)
+        if method != "close" and reply.get("success") and reply.get("seqNum") != seqNum:
+            raise RuntimeError("sequence number mismatch in the reply of %s: %s" % (method, reply))
+        self.update_candidates(reply)
+        return reply, latency
+
+    def update_candidates(self, reply):
+        if "candidateList" in reply:
+            self.candidateList = reply["candidateList"]
+        elif "candidateChanges" in reply:
+            cands = self.candidateList[:reply["candidateCount"]]
+            cands += [""] * (reply["candidateCount"] - len(cands))
+            for change in reply["candidateChanges"]:
+                start = change[0]
+                cands[start:start + len(change) - 1] = change[1:]
+            self.candidateList = cands
+        if "candidatePage" in reply:
+            self.candidatePage = reply["candidatePage"]
+
+    def init(self):
+        reply, latency = self.request("init",
+                                      ("id", self.guid),
+                                      ("isWindows8Above", True),
+                                      ("isMetroApp", False),
+                                      ("isUiLess", False),
+                                      ("isConsole", False))
+        if not reply.get("success"):
+            return False
+        reply, latency = self.request("onActivate", ("isKeyboardOpen", True))
+        return reply.get("success", False)
+
+    def key_fields(self, key):
+        return (("charCode", key.charCode),
+                ("keyCode", key.keyCode),
+                ("repeatCount", 1),
+                ("scanCode", 0),
+                ("isExtended", False),
+                ("keyStates", self.keyStates))
+
+    def type_key(self, key):
+        # returns the total latency of the keystroke in ms
+        self.keyStates[VK_SHIFT] = 0x80 if key.shift else 0
+        self.keyStates[key.keyCode] = 0x80
+        total = 0.0
+        reply, latency = self.request("filterKeyDown", *self.key_fields(key))
+        total += latency
+        if reply.get("return"):
+            reply, latency = self.request("onKeyDown", *self.key_fields(key))
+            total += latency
+        self.keyStates[key.keyCode] = 0
+        reply, latency = self.request("filterKeyUp", *self.key_fields(key))
+        total += latency
+        if reply.get("return"):
+            reply, latency = self.request("onKeyUp", *self.key_fields(key))
+            total += latency
+        self.keyStates[VK_SHIFT] = 0
+        self.latencies.setdefault("keystroke", []).append(total)
+        return total
+
+
+def read_syscall_counts(pid):
+    # number of read and write syscalls of the process, only available on Linux
+    try:
+        with open("/proc/%d/io" % pid, "r") as f:
+            counters = dict(line.split(":", 1) for line in f)
+        return int(counters["syscr"]), int(counters["syscw"])
+    except (OSError, KeyError, ValueError):
+        return None
+
+
+def percentile(sortedValues, p):
+    if not sortedValues:
+        return 0.0
+    index = min(len(sortedValues) - 1, int(len(sortedValues) * p / 100.0))
+    return sortedValues[index]
+
+
+def summarize(latencies):
+    result = {}
+    for method, values in sorted(latencies.items()):
+        values = sorted(values)
+        result[method] = {
+            "count": len(values),
+            "p50": round(percentile(values, 50), 4),
+            "p99": round(percentile(values, 99), 4),
+            "p99.9": round(percentile(values, 99.9), 4),
+        }
+    return result
+
+
+def type_corpus(client, corpus, iterations, errors):
+    try:
+        for i in range(iterations):
+            for line in corpus.lines:
+                for key in line:
+                    client.type_key(key)
+    except (OSError, ValueError, RuntimeError) as e:
+        errors.append(str(e))
+
+
+def run_corpus(backendInfo, command, corpus, iterations, warmup, captureFile=None, clientCount=1):
+    backend = Backend(backendInfo, command)
+    guid = backend.find_ime(corpus.ime)
+    if not guid:
+        return None, "input method %s is not found" % corpus.ime
+    with tempfile.TemporaryDirectory() as tempDir:
+        recorder = CaptureWriter(captureFile) if captureFile else None
+        launcher = LauncherEmulator(backend, guid, os.path.join(tempDir, "PIME_launcher"), recorder)
+        launcher.start()
+        # each client is a text service in a different process typing at the same time
+        clients = []
+        try:
+            for i in range(clientCount):
+                client = SyntheticClient(launcher.socketPath, guid)
+                clients.append(client)
+                if not client.init():
+                    return None, "failed to initialize %s" % corpus.ime
+                # type some keys before measuring so imports and caches of the backend are ready
+                keys = [key for line in corpus.lines for key in line]
+                for i in range(min(warmup, len(keys))):
+                    client.type_key(keys[i])
+                client.latencies = {}
+
+            syscallsBegin = read_syscall_counts(backend.process.pid)
+            errors = []
+            threads = [threading.Thread(target=type_corpus, args=(client, corpus, iterations, errors)) for client in clients]
+            for thread in threads:
+                thread.start()
+            for thread in threads:
+                thread.join()
+            syscallsEnd = read_syscall_counts(backend.process.pid)
+            if errors:
+                return None, errors[0]
+
+            latencies = {}
+            for client in clients:
+                for method, values in client.latencies.items():
+                    latencies.setdefault(method, []).extend(values)
+            stats = summarize(latencies)
+            if syscallsBegin and syscallsEnd:
+                requests = sum(len(v) for k, v in latencies.items() if k != "keystroke")
+                stats["syscalls"] = {
+                    "count": requests,
+                    "read": round((syscallsEnd[0] - syscallsBegin[0]) / requests, 2),
+                    "write": round((syscallsEnd[1] - syscallsBegin[1]) / requests, 2),
+                }
+            for client in clients:
+                client.request("onDeactivate")
+            return stats, None
+        except (OSError, ValueError, RuntimeError) as e:
+            return None, str(e)
+        finally:
+            for client in clients:
+                try:
+                    client.close()
+                except (OSError, ValueError):
+                    pass
+            launcher.quit()
+            if recorder:
+                recorder.close()
+
+
+def backend_commands(args):
+    # the commands in backends.json are Windows paths of the bundled interpreters
+    return {
+        "python": [args.python, "server.py"],
+        "node": [args.node, "server.js"],
+    }
+
+
+def compare(results, baseline, key, tolerance, minDiff):
+    # returns the descriptions of the methods whose latency percentile "key" gets worse
+    regressions = []
+    for run, methods in sorted(results.items()):
+        baseMethods = baseline.get("results", {}).get(run)
+        if not baseMethods:
+            continue
+        for method, stats in sorted(methods.items()):
+            base = baseMethods.get(method)
+            if method == "syscalls":
+                continue
+            # percentiles of methods called only a few times are too noisy to compare
+            if not base or stats["count"] < MIN_COMPARED_COUNT:
+                continue
+            old = base[key]
+            new = stats[key]
+            if new > old * (1.0 + tolerance) and new - old > minDiff:
+                regressions.append("%s %s %s: %.3f ms => %.3f ms (+%.0f%%)" % (
+                    run, method, key, old, new, (new / old - 1.0) * 100 if old else 100))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="PIME keystroke latency benchmark")
+    parser.add_argument("--corpus", action="append", help="name of the corpus in tests/latency/corpora (default: all)")
+    parser.add_argument("--backend", action="append", help="name of the backend in backends.json (default: all)")
+    parser.add_argument("--iterations", type=int, default=10, help="number of times each corpus is typed")
+    parser.add_argument("--clients", type=int, default=1, help="number of clients typing at the same time")
+    parser.add_argument("--warmup", type=int, default=20, help="number of keys typed before measuring")
+    parser.add_argument("--python", default=sys.executable, help="python interpreter running python/server.py")
+    parser.add_argument("--node", default="node", help="node.js interpreter running node/server.js")
+    parser.add_argument("--save-baseline", metavar="FILE", help="write the results to a baseline file")
+    parser.add_argument("--compare", metavar="FILE", help="compare the results with a baseline file")
+    parser.add_argument("--record", metavar="DIR", help="record the traffic of each run to a capture file for replay.py")
+    parser.add_argument("--tolerance", type=float, default=0.25, help="allowed relative slowdown of p50 (default: 0.25)")
+    parser.add_argument("--min-diff", type=float, default=0.25, help="ignore slowdowns below this in ms (default: 0.25)")
+    args = parser.parse_args()
+
+    with open(os.path.join(TOP_DIR, "backends.json"), "r", encoding="utf-8") as f:
+        backends = json.load(f)
+    if args.backend:
+        backends = [b for b in backends if b["name"] in args.backend]
+    commands = backend_commands(args)
+
+    corpusNames = args.corpus or sorted(os.path.splitext(f)[0] for f in os.listdir(CORPORA_DIR) if f.endswith(".txt"))
+    corpora = [Corpus.load(os.path.join(CORPORA_DIR, name + ".txt")) for name in corpusNames]
+    if args.record:
+        os.makedirs(args.record, exist_ok=True)
+
+    results = {}
+    for corpus in corpora:
+        for backendInfo in backends:
+            if not os.path.exists(os.path.join(TOP_DIR, backendInfo["workingDir"], "input_methods", corpus.ime)):
+                continue
+            run = "%s/%s" % (backendInfo["name"], corpus.name)
+            captureFile = os.path.join(args.record, "%s-%s.pimecap" % (backendInfo["name"], corpus.name)) if args.record else None
+            stats, error = run_corpus(backendInfo, commands[backendInfo["name"]], corpus, args.iterations, args.warmup, captureFile, args.clients)
+            if error:
+                print("%-24s skipped: %s" % (run, error))
+                continue
+            results[run] = stats
+            for method, s in stats.items():
+                if method == "syscalls":
+                    print("%-24s %-16s n=%-6d read=%.2f  write=%.2f per request" % (
+                        run, method, s["count"], s["read"], s["write"]))
+                    continue
+                print("%-24s %-16s n=%-6d p50=%8.3f ms  p99=%8.3f ms  p99.9=%8.3f ms" % (
+                    run, method, s["count"], s["p50"], s["p99"], s["p99.9"]))
+
+    if args.save_baseline:
+        baseline = {
+            "host": "%s %s, python %s" % (platform.system(), platform.machine(), platform.python_version()),
+            "iterations": args.iterations,
+            "results": results,
+        }
+        with open(args.save_baseline, "w", encoding="utf-8") as f:
+            json.dump(baseline, f, indent=4, sort_keys=True)
+            f.write("\n")
+
+    if args.compare:
+        with open(args.compare, "r", encoding="utf-8") as f:
+            baseline = json.load(f)
+        # tail latency is dominated by GC and scheduling of the machine, so it's only reported
+        for change in compare(results, baseline, "p99", args.tolerance, args.min_diff):
+            print("Tail latency change: " + change)
+        regressions = compare(results, baseline, "p50", args.tolerance, args.min_diff)
+        if regressions:
+            print("Latency regressions compared with %s:" % args.compare)
+            for r in regressions:
+                print("  " + r)
+            sys.exit(1)
+        print("No latency regression compared with %s" % args.compare)
+
+
+if __name__ == "__main__":
+    main()
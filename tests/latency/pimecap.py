@@ -0,0 +1,117 @@
+# python3
+# coding=utf8
+#
+# Reader and writer of the IPC capture files recorded by PIMELauncher (Record IPC Traffic).
+# See PIMELauncher/TrafficRecorder.h for the format.
+
+import time
+
+
+MAGIC = b"PIMECAP"
+VERSION = 1
+
+# record types
+SESSION = 1
+REQUEST = 2
+REPLY = 3
+RESTART = 4
+
+
+class Record:
+    def __init__(self, type, time, backend, clientId, data):
+        self.type = type
+        self.time = time  # microseconds since the beginning of the capture
+        self.backend = backend
+        self.clientId = clientId  # None for RESTART records
+        self.data = data  # bytes
+
+
+def read_varint(buf, pos):
+    value = 0
+    shift = 0
+    while True:
+        b = buf[pos]
+        pos += 1
+        value |= (b & 0x7f) << shift
+        if b < 0x80:
+            return value, pos
+        shift += 7
+
+
+def read_capture(filename):
+    # returns the list of REQUEST, REPLY, and RESTART records. SESSION records are resolved.
+    with open(filename, "rb") as f:
+        buf = f.read()
+    if buf[:len(MAGIC)] != MAGIC or len(buf) <= len(MAGIC) or buf[len(MAGIC)] != VERSION:
+        raise ValueError("%s is not a PIME capture file" % filename)
+    pos = len(MAGIC) + 1
+    sessions = {}
+    records = []
+    now = 0
+    try:
+        while pos < len(buf):
+            type = buf[pos]
+            delta, pos = read_varint(buf, pos + 1)
+            session, pos = read_varint(buf, pos)
+            length, pos = read_varint(buf, pos)
+            data = buf[pos:pos + length]
+            if len(data) < length:
+                break  # the capture is truncated
+            pos += length
+            now += delta
+            if type == SESSION:
+                backend, sep, clientId = data.decode("utf-8").partition("|")
+                sessions[session] = (backend, clientId)
+            elif type == RESTART:
+                records.append(Record(type, now, data.decode("utf-8"), None, data))
+            elif type in (REQUEST, REPLY) and session in sessions:
+                backend, clientId = sessions[session]
+                records.append(Record(type, now, backend, clientId, data))
+    except IndexError:  # the capture is truncated in a record header
+        pass
+    return records
+
+
+class CaptureWriter:
+    # writes captures in the same format as TrafficRecorder of PIMELauncher
+    def __init__(self, filename):
+        self.file = open(filename, "wb")
+        self.file.write(MAGIC + bytes([VERSION]))
+        self.sessions = {}
+        self.lastTime = time.perf_counter()
+
+    def close(self):
+        self.file.close()
+
+    def record_request(self, backend, clientId, data):
+        self.write_record(REQUEST, self.session_index(backend, clientId), data)
+
+    def record_reply(self, backend, clientId, data):
+        self.write_record(REPLY, self.session_index(backend, clientId), data)
+
+    def record_restart(self, backend):
+        self.write_record(RESTART, 0, backend.encode("utf-8"))
+
+    def session_index(self, backend, clientId):
+        key = "%s|%s" % (backend, clientId)
+        session = self.sessions.get(key)
+        if session is None:
+            session = len(self.sessions)
+            self.sessions[key] = session
+            self.write_record(SESSION, session, key.encode("utf-8"))
+        return session
+
+    def write_record(self, type, session, data):
+        now = time.perf_counter()
+        delta = int((now - self.lastTime) * 1000000)
+        self.lastTime = now
+        self.file.write(bytes([type]) + encode_varint(delta) + encode_varint(session) + encode_varint(len(data)) + data)
+
+
+def encode_varint(value):
+    out = bytearray()
+    while value >= 0x80:
+        out.append((value & 0x7f) | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
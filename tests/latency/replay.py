@@ -0,0 +1,222 @@
+# python3
+# coding=utf8
+#
+# Replay an IPC capture recorded by PIMELauncher (Record IPC Traffic in the tray menu) or by
+# latency_bench.py --record against the backends, and compare their replies with the recorded ones.
+#
+# Usage:
+#   python3 tests/latency/replay.py <capture file>                 # as fast as possible
+#   python3 tests/latency/replay.py --speed original <capture file>  # keep the recorded timing
+#   python3 tests/latency/replay.py --backend python --show-diff 5 <capture file>
+#
+# Requests are sent in the recorded order, and each request waits for its reply before the next
+# one is sent, so the replay is deterministic even if several clients were typing concurrently.
+# The backend process is restarted where the launcher restarted it during the recording.
+# The exit status is 1 if any reply is different from the recorded one.
+
+import argparse
+import json
+import os
+import queue
+import subprocess
+import sys
+import threading
+import time
+
+from latency_bench import TOP_DIR, backend_commands, summarize
+from pimecap import read_capture, REQUEST, REPLY, RESTART
+
+
+# same as BACKEND_REQUEST_TIMEOUT_MS of PIMELauncher
+REPLY_TIMEOUT = 30
+
+# keys of the candidate list, which is encoded differently when passed through shared memory
+CANDIDATE_KEYS = ("candidateList", "candidateGeneration", "candidatePage", "candidateCount", "candidateChanges")
+
+ICON_EXTENSIONS = (".ico", ".png", ".bmp")
+
+
+class BackendProcess:
+    def __init__(self, name, command, workingDir):
+        self.name = name
+        self.command = command
+        self.workingDir = workingDir
+        self.process = None
+        self.replies = queue.Queue()  # (client id, reply text)
+
+    def start(self):
+        self.stop()
+        self.process = subprocess.Popen(self.command, cwd=self.workingDir, bufsize=0,
+                                        stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+        self.replies = queue.Queue()
+        threading.Thread(target=self.read_output, args=(self.process.stdout, self.replies), daemon=True).start()
+
+    def stop(self):
+        if self.process:
+            try:
+                self.process.stdin.close()
+                self.process.wait(5)
+            except (OSError, subprocess.TimeoutExpired):
+                self.process.kill()
+            self.process = None
+
+    @staticmethod
+    def read_output(stdout, replies):
+        for line in stdout:
+            # only lines prefixed with "PIME_MSG|" are replies, others are logs
+            if line.startswith(b"PIME_MSG|"):
+                clientId, sep, reply = line[9:].rstrip(b"\r\n").partition(b"|")
+                replies.put((clientId.decode(), reply))
+        replies.put((None, None))  # the backend is terminated
+
+    def request(self, clientId, data):
+        self.process.stdin.write(clientId.encode() + b"|" + data + b"\n")
+
+    def wait_reply(self, clientId):
+        deadline = time.perf_counter() + REPLY_TIMEOUT
+        while True:
+            try:
+                replyClientId, reply = self.replies.get(timeout=max(0, deadline - time.perf_counter()))
+            except queue.Empty:
+                return None
+            if replyClientId is None:  # terminated
+                return None
+            if replyClientId == clientId:
+                return reply
+
+
+def normalize(value):
+    # remove differences which do not depend on the behavior of the input method
+    if isinstance(value, dict):
+        return {k: normalize(v) for k, v in value.items() if k != "trace"}
+    if isinstance(value, list):
+        return [normalize(v) for v in value]
+    if isinstance(value, str) and value.lower().endswith(ICON_EXTENSIONS):
+        # icon paths depend on the install dir
+        return value.replace("\\", "/").rsplit("/", 1)[-1]
+    return value
+
+
+def same_reply(recorded, replayed):
+    try:
+        recorded = normalize(json.loads(recorded))
+        replayed = normalize(json.loads(replayed))
+    except ValueError:
+        return recorded == replayed
+    if "candidateGeneration" in recorded or "candidateGeneration" in replayed:
+        # the candidates were in the shared memory section of the client, which is not recorded
+        for key in CANDIDATE_KEYS:
+            recorded.pop(key, None)
+            replayed.pop(key, None)
+    return recorded == replayed
+
+
+def prepare_request(data):
+    # returns the method and the request to send
+    try:
+        msg = json.loads(data)
+    except ValueError:
+        return "", data
+    method = msg.get("method", "")
+    if method == "init" and "candidateSection" in msg:
+        # the shared memory section of the client does not exist during the replay
+        del msg["candidateSection"]
+        data = json.dumps(msg, ensure_ascii=False, separators=(",", ":")).encode("utf-8")
+    return method, data
+
+
+def replay(records, backend, originalSpeed, showDiff):
+    latencies = {}
+    mismatches = 0
+    compared = 0
+    pendingReplies = {}  # client id => recorded replies not yet compared
+    for record in records:
+        if record.type == REPLY:
+            pendingReplies.setdefault(record.clientId, []).append(record.data)
+
+    backend.start()
+    begin = time.perf_counter()
+    firstTime = records[0].time if records else 0
+    for record in records:
+        if record.type == RESTART:
+            if record is not records[0]:
+                backend.start()
+            continue
+        if record.type != REQUEST:
+            continue
+        if originalSpeed:
+            delay = (record.time - firstTime) / 1000000 - (time.perf_counter() - begin)
+            if delay > 0:
+                time.sleep(delay)
+        method, data = prepare_request(record.data)
+        sent = time.perf_counter()
+        backend.request(record.clientId, data)
+        if method == "close":  # the backends do not reply to "close"
+            continue
+        reply = backend.wait_reply(record.clientId)
+        latencies.setdefault(method, []).append((time.perf_counter() - sent) * 1000)
+        if reply is None:
+            print("%s: no reply to %s of %s" % (backend.name, method, record.clientId))
+            backend.start()
+            mismatches += 1
+            continue
+        expected = pendingReplies.get(record.clientId)
+        if not expected:
+            continue
+        compared += 1
+        recorded = expected.pop(0)
+        if not same_reply(recorded, reply):
+            mismatches += 1
+            if mismatches <= showDiff:
+                print("%s: different reply to %s of %s" % (backend.name, method, record.clientId))
+                print("  request:  %s" % data.decode("utf-8", "replace"))
+                print("  recorded: %s" % recorded.decode("utf-8", "replace"))
+                print("  replayed: %s" % reply.decode("utf-8", "replace"))
+    elapsed = time.perf_counter() - begin
+    backend.stop()
+    return latencies, compared, mismatches, elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Replay a PIME IPC capture against the backends")
+    parser.add_argument("capture", help="capture file (.pimecap)")
+    parser.add_argument("--backend", action="append", help="only replay the traffic of these backends")
+    parser.add_argument("--speed", choices=("fast", "original"), default="fast",
+                        help="send requests as fast as possible or with the recorded timing")
+    parser.add_argument("--show-diff", type=int, default=3, help="number of different replies to print")
+    parser.add_argument("--python", default=sys.executable, help="python interpreter running python/server.py")
+    parser.add_argument("--node", default="node", help="node.js interpreter running node/server.js")
+    args = parser.parse_args()
+
+    records = read_capture(args.capture)
+    with open(os.path.join(TOP_DIR, "backends.json"), "r", encoding="utf-8") as f:
+        backendInfos = {info["name"]: info for info in json.load(f)}
+    commands = backend_commands(args)
+
+    failed = False
+    names = []
+    for record in records:
+        if record.backend not in names:
+            names.append(record.backend)
+    for name in names:
+        if args.backend and name not in args.backend:
+            continue
+        if name not in backendInfos or name not in commands:
+            print("%s: unknown backend, skipped" % name)
+            continue
+        backend = BackendProcess(name, commands[name], os.path.join(TOP_DIR, backendInfos[name]["workingDir"]))
+        backendRecords = [r for r in records if r.backend == name]
+        latencies, compared, mismatches, elapsed = replay(backendRecords, backend, args.speed == "original", args.show_diff)
+        count = sum(len(values) for values in latencies.values())
+        print("%s: %d requests in %.3f s (%.0f requests/s), %d of %d replies are different" % (
+            name, count, elapsed, count / elapsed if elapsed else 0, mismatches, compared))
+        for method, s in summarize(latencies).items():
+            print("  %-24s n=%-6d p50=%8.3f ms  p99=%8.3f ms  p99.9=%8.3f ms" % (
+                method, s["count"], s["p50"], s["p99"], s["p99.9"]))
+        if mismatches:
+            failed = True
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,71 @@
+# python3
+# coding=utf8
+#
+# Checks the associated phrases of cinbase: the order of getPhrases() with the user phrases, and
+# sortCandidates() with duplicated phrases in the user phrase file (userphrase.dat), which is
+# edited by the users.
+#
+# Usage:
+#   python3 tests/phrase_test.py
+
+import io
+import unittest
+
+from cinbase_helper import import_cinbase
+
+import_cinbase()
+from cinbase.cin import moveToFront
+from cinbase.phrase import phrase
+from cinbase.userphrase import userphrase
+
+
+PHRASE_CIN = """%gen_inp
+%chardef begin
+好 人
+好 像
+好 乙
+天 氣
+%chardef end
+"""
+
+USER_PHRASE = "好=人,人,甲,人\n天=空,空\n"
+
+
+class PhraseTest(unittest.TestCase):
+
+    def setUp(self):
+        self.phrase = phrase(io.StringIO(PHRASE_CIN))
+        self.userphrase = userphrase(io.StringIO(USER_PHRASE))
+
+
+    def test_getPhrases(self):
+        self.assertEqual(self.phrase.getPhrases("好", None), ["人", "像", "乙"])
+        self.assertEqual(self.phrase.getPhrases("好", self.userphrase), ["人", "甲", "像", "乙"])
+        self.assertEqual(self.phrase.getPhrases("好", self.userphrase, True), ["人", "甲"])
+        self.assertEqual(self.phrase.getPhrases("天", self.userphrase, True), ["空"])
+        self.assertEqual(self.phrase.getPhrases("天", self.userphrase), ["空", "氣"])
+        self.assertEqual(self.phrase.getPhrases("無", self.userphrase), [])
+
+
+    def test_sortCandidates_duplicated_user_phrases(self):
+        candidates = ["甲", "人", "乙"]
+        result = self.phrase.sortCandidates("好", candidates, self.userphrase)
+        self.assertIs(result, candidates)
+        self.assertEqual(result, ["人", "甲", "乙"])
+        self.assertEqual(self.phrase.sortCandidates("天", ["雨", "空", "氣"], self.userphrase), ["空", "氣", "雨"])
+        # the user phrases are not modified
+        self.assertEqual(self.userphrase.getCharDef("好"), ["人", "人", "甲", "人"])
+
+
+    def test_moveToFront(self):
+        self.assertEqual(moveToFront(["a", "b", "c", "d"], ["c", "a"]), ["c", "a", "b", "d"])
+        # only the first occurrence of the candidates is moved
+        self.assertEqual(moveToFront(["a", "b", "a", "c"], ["c", "a"]), ["c", "a", "b", "a"])
+        # duplicated phrases count once, and the ones not in the candidates are skipped
+        self.assertEqual(moveToFront(["甲", "人", "乙"], ["人", "人", "丙", "乙"]), ["人", "乙", "甲"])
+        self.assertEqual(moveToFront(["甲", "乙"], ["丙"]), ["甲", "乙"])
+        self.assertEqual(moveToFront([], ["丙"]), [])
+
+
+if __name__ == "__main__":
+    unittest.main()
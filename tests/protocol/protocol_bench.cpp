@@ -0,0 +1,119 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+// Micro benchmarks of PIME::RequestWriter and PIME::Reply, comparing them with building and
+// parsing the same messages with jsoncpp as PIME::Client did before.
+// PIMEProtocol.cpp does not depend on Windows, so the benchmark is built with the system jsoncpp:
+//
+//   g++ -std=c++11 -O2 -I PIMETextService -I /usr/include/jsoncpp -o protocol_bench
+//       tests/protocol/protocol_bench.cpp PIMETextService/PIMEProtocol.cpp -ljsoncpp
+//   ./protocol_bench [iterations]
+
+#include "PIMEProtocol.h"
+#include <json/json.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace std;
+
+typedef chrono::steady_clock Clock;
+
+// a reply to a key event with 9 candidates, as sent by the python backends
+static const char replyText[] =
+	"{\"success\": true, \"seqNum\": 7, \"return\": true, \"compositionString\": \"\xe3\x84\x85\xe3\x84\x86\", "
+	"\"compositionCursor\": 2, \"candidateList\": [\"\xe4\xb8\x80\", \"\xe4\xba\x8c\", \"\xe4\xb8\x89\", "
+	"\"\xe5\x9b\x9b\", \"\xe4\xba\x94\", \"\xe5\x85\xad\", \"\xe4\xb8\x83\", \"\xe5\x85\xab\", \"\xe4\xb9\x9d\"], "
+	"\"candidateCursor\": 0, \"showCandidates\": true, \"commitString\": \"\", \"setSelKeys\": \"123456789\"}";
+
+static double microseconds(Clock::time_point start, Clock::time_point end, int iterations) {
+	return chrono::duration<double, micro>(end - start).count() / iterations;
+}
+
+int main(int argc, char** argv) {
+	int iterations = argc > 1 ? atoi(argv[1]) : 200000;
+	if (iterations <= 0)
+		iterations = 200000;
+	unsigned char keyStates[256] = { 0 };
+	keyStates[16] = 128;
+	size_t sink = 0; // keeps the results alive
+
+	// encode a key event request
+	auto start = Clock::now();
+	for (int i = 0; i < iterations; ++i) {
+		Json::Value req;
+		req["method"] = "onKeyDown";
+		req["seqNum"] = i;
+		req["charCode"] = 97;
+		req["keyCode"] = 65;
+		req["repeatCount"] = 1;
+		req["scanCode"] = 30;
+		req["isExtended"] = false;
+		Json::Value states(Json::arrayValue);
+		for (int j = 0; j < 256; ++j)
+			states.append(keyStates[j]);
+		req["keyStates"] = states;
+		Json::FastWriter writer;
+		sink += writer.write(req).size();
+	}
+	auto jsoncppEncodeEnd = Clock::now();
+	PIME::RequestWriter writer;
+	for (int i = 0; i < iterations; ++i) {
+		writer.begin("onKeyDown", i)
+			.add("charCode", 97u)
+			.add("keyCode", 65u)
+			.add("repeatCount", 1u)
+			.add("scanCode", 30u)
+			.add("isExtended", false)
+			.addByteArray("keyStates", keyStates, 256);
+		sink += writer.end().size();
+	}
+	auto encodeEnd = Clock::now();
+	printf("encode key event request: jsoncpp %.2f us, RequestWriter %.2f us\n",
+		microseconds(start, jsoncppEncodeEnd, iterations), microseconds(jsoncppEncodeEnd, encodeEnd, iterations));
+
+	// decode the reply and read its candidates
+	const string text = replyText;
+	start = Clock::now();
+	for (int i = 0; i < iterations; ++i) {
+		Json::Reader reader;
+		Json::Value reply;
+		reader.parse(text, reply);
+		const Json::Value& candidates = reply["candidateList"];
+		for (auto it = candidates.begin(); it != candidates.end(); ++it)
+			sink += strlen(it->asCString());
+		sink += reply["compositionString"].isString() + reply["showMessage"].isObject();
+	}
+	auto jsoncppDecodeEnd = Clock::now();
+	for (int i = 0; i < iterations; ++i) {
+		PIME::Reply reply;
+		reply.text() = text;
+		reply.parse();
+		for (const auto& candidate: reply.candidateList)
+			sink += candidate.length;
+		sink += reply.has(PIME::Reply::COMPOSITION_STRING) + reply.has(PIME::Reply::SHOW_MESSAGE);
+	}
+	auto decodeEnd = Clock::now();
+	printf("decode reply with 9 candidates: jsoncpp %.2f us, Reply %.2f us\n",
+		microseconds(start, jsoncppDecodeEnd, iterations), microseconds(jsoncppDecodeEnd, decodeEnd, iterations));
+	return sink == 0;
+}
@@ -0,0 +1,230 @@
+//
+//	Copyright (C) 2018 Hong Jen Yee (PCMan) <pcman.tw@gmail.com>
+//
+//	This library is free software; you can redistribute it and/or
+//	modify it under the terms of the GNU Library General Public
+//	License as published by the Free Software Foundation; either
+//	version 2 of the License, or (at your option) any later version.
+//
+//	This library is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//	Library General Public License for more details.
+//
+//	You should have received a copy of the GNU Library General Public
+//	License along with this library; if not, write to the
+//	Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+//	Boston, MA  02110-1301, USA.
+//
+
+
+// Round-trip tests of PIME::RequestWriter and PIME::Reply against jsoncpp.
+// PIMEProtocol.cpp does not depend on Windows, so the test is built with the system jsoncpp:
+//
+//   g++ -std=c++11 -O2 -Wall -I PIMETextService -I /usr/include/jsoncpp -o protocol_test
+//       tests/protocol/protocol_test.cpp PIMETextService/PIMEProtocol.cpp -ljsoncpp
+//   ./protocol_test
+
+#include "PIMEProtocol.h"
+#include <json/json.h>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+using namespace std;
+
+static int failures = 0;
+
+#define CHECK(expr) \
+	do { \
+		if (!(expr)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #expr); \
+			++failures; \
+		} \
+	} while (0)
+
+static bool parseJson(const string& text, Json::Value& value) {
+	Json::Reader reader;
+	return reader.parse(text, value, false);
+}
+
+// strings which need escaping: quotes, backslashes, control characters, CJK and characters
+// outside the BMP (U+1F600, U+20000)
+static const char* const escapedStrings[] = {
+	"",
+	"plain",
+	"a\"b\\c/d",
+	"\b\f\n\r\t\x01\x1f",
+	"\xe4\xb8\x80\xe4\xba\x8c\xe3\x84\x85",
+	"\xf0\x9f\x98\x80x\xf0\xa0\x80\x80"
+};
+
+static void testRequestWriter() {
+	unsigned char keyStates[256] = { 0 };
+	keyStates[16] = 128;
+	keyStates[255] = 1;
+	PIME::RequestWriter writer;
+	for (int round = 0; round < 2; ++round) { // the buffer is reused by the second request
+		writer.begin("onKeyDown", 5 + round)
+			.add("charCode", 97u)
+			.add("keyCode", 4294967295u)
+			.add("isExtended", false)
+			.add("isUiLess", true)
+			.add("negative", -3)
+			.add("minimum", INT32_MIN)
+			.addByteArray("keyStates", keyStates, 256)
+			.addByteArray("empty", keyStates, 0);
+		for (size_t i = 0; i < sizeof(escapedStrings) / sizeof(escapedStrings[0]); ++i) {
+			string name = "s" + to_string(i);
+			writer.add(name.c_str(), escapedStrings[i]);
+		}
+		Json::Value request;
+		CHECK(parseJson(writer.end(), request));
+		CHECK(request["method"].asString() == "onKeyDown");
+		CHECK(request["seqNum"].asUInt() == 5u + round);
+		CHECK(request["charCode"].asUInt() == 97u);
+		CHECK(request["keyCode"].asUInt() == 4294967295u);
+		CHECK(request["isExtended"].isBool() && !request["isExtended"].asBool());
+		CHECK(request["isUiLess"].isBool() && request["isUiLess"].asBool());
+		CHECK(request["negative"].asInt() == -3);
+		CHECK(request["minimum"].asInt() == INT32_MIN);
+		CHECK(request["keyStates"].size() == 256 && request["keyStates"][16].asUInt() == 128 &&
+			request["keyStates"][255].asUInt() == 1 && request["keyStates"][0].asUInt() == 0);
+		CHECK(request["empty"].isArray() && request["empty"].empty());
+		for (size_t i = 0; i < sizeof(escapedStrings) / sizeof(escapedStrings[0]); ++i)
+			CHECK(request["s" + to_string(i)].asString() == escapedStrings[i]);
+		CHECK(request.size() == 10 + sizeof(escapedStrings) / sizeof(escapedStrings[0]));
+	}
+}
+
+static bool parseReply(PIME::Reply& reply, const string& text) {
+	reply.text() = text;
+	return reply.parse();
+}
+
+// decode the reply written by jsoncpp from the value, with non-ASCII characters escaped as
+// \uXXXX and surrogate pairs
+static void testReplyRoundTrip() {
+	Json::Value root;
+	root["success"] = true;
+	root["seqNum"] = 7;
+	root["return"] = true;
+	root["compositionString"] = escapedStrings[2];
+	root["compositionCursor"] = 2;
+	root["commitString"] = escapedStrings[5];
+	root["setSelKeys"] = "1234567890";
+	Json::Value candidates(Json::arrayValue);
+	for (const char* str: escapedStrings)
+		candidates.append(str);
+	root["candidateList"] = candidates;
+	root["candidateCursor"] = 3;
+	root["showCandidates"] = true;
+	root["showMessage"]["message"] = escapedStrings[3];
+	root["showMessage"]["duration"] = 3;
+	root["addButton"][0]["id"] = "switch-lang";
+	root["addButton"][0]["icon"] = "c:\\x.ico";
+	root["customizeUI"]["candFontSize"] = 16;
+	root["localEchoKeys"]["A"] = "a";
+	root["unknown"][0] = 1;
+	root["unknown"][1]["nested"] = Json::Value::null;
+	root["unknownString"] = "\"}]";
+
+	for (int styled = 0; styled < 2; ++styled) {
+		string text = styled ? Json::StyledWriter().write(root) : Json::FastWriter().write(root);
+		PIME::Reply reply;
+		CHECK(parseReply(reply, text));
+		CHECK(reply.text() == text); // the text is not modified
+		CHECK(reply.has(PIME::Reply::SUCCESS) && reply.success);
+		CHECK(reply.seqNum == 7);
+		CHECK(reply.has(PIME::Reply::RETURN) && reply.returnValue && reply.returnJson.str() == "true");
+		CHECK(reply.compositionString.str() == escapedStrings[2]);
+		CHECK(reply.compositionCursor == 2);
+		CHECK(reply.commitString.str() == escapedStrings[5]);
+		CHECK(reply.selKeys.str() == "1234567890");
+		CHECK(reply.candidateList.size() == candidates.size());
+		for (size_t i = 0; i < reply.candidateList.size(); ++i) {
+			CHECK(reply.candidateList[i].str() == escapedStrings[i]);
+			CHECK(reply.candidateList[i].data[reply.candidateList[i].length] == '\0');
+		}
+		CHECK(reply.candidateCursor == 3);
+		CHECK(reply.has(PIME::Reply::SHOW_CANDIDATES) && reply.showCandidates);
+		CHECK(reply.has(PIME::Reply::SHOW_MESSAGE) && reply.message.str() == escapedStrings[3] &&
+			reply.messageDuration == 3);
+
+		// raw values are decoded by jsoncpp later
+		Json::Value buttons, ui, keys;
+		CHECK(parseJson(reply.addButton.str(), buttons) && buttons == root["addButton"]);
+		CHECK(parseJson(reply.customizeUI.str(), ui) && ui == root["customizeUI"]);
+		CHECK(parseJson(reply.localEchoKeys.str(), keys) && keys == root["localEchoKeys"]);
+		CHECK(!reply.has(PIME::Reply::REMOVE_BUTTON) && !reply.has(PIME::Reply::CANDIDATE_CHANGES) &&
+			!reply.has(PIME::Reply::TRACE));
+	}
+}
+
+static void testReplyTypes() {
+	PIME::Reply reply;
+	// values with unexpected types are skipped
+	CHECK(parseReply(reply, "{\"success\": 1, \"seqNum\": \"3\", \"showCandidates\": 1, "
+		"\"candidateList\": [\"a\", 2, null, \"b\"], \"commitString\": 5, \"showMessage\": {\"message\": \"m\"}}"));
+	CHECK(reply.success);
+	CHECK(!reply.has(PIME::Reply::SEQ_NUM) && reply.seqNum == 0);
+	CHECK(!reply.has(PIME::Reply::SHOW_CANDIDATES));
+	CHECK(reply.candidateList.size() == 4 && reply.candidateList[0].str() == "a" &&
+		reply.candidateList[1].empty() && reply.candidateList[3].str() == "b");
+	CHECK(!reply.has(PIME::Reply::COMMIT_STRING));
+	CHECK(!reply.has(PIME::Reply::SHOW_MESSAGE)); // the duration is missing
+
+	CHECK(parseReply(reply, "{\"candidatePage\": 2, \"candidateCount\": 5, \"candidateGeneration\": 4294967295, "
+		"\"candidateChanges\": [[0, \"x\"], [3, \"\\u4e00\", \"\\ud83d\\ude00\"]]}"));
+	CHECK(reply.candidatePage == 2 && reply.candidateCount == 5);
+	CHECK(reply.candidateGeneration == 4294967295u);
+	CHECK(reply.candidateRanges.size() == 2 && reply.candidateChanges.size() == 3);
+	CHECK(reply.candidateRanges[1].start == 3 && reply.candidateRanges[1].first == 1 &&
+		reply.candidateRanges[1].count == 2);
+	CHECK(reply.candidateChanges[1].str() == "\xe4\xb8\x80" && reply.candidateChanges[2].str() == "\xf0\x9f\x98\x80");
+
+	// a lone high surrogate is encoded as is
+	CHECK(parseReply(reply, "{\"commitString\": \"\\ud83dx\"}"));
+	CHECK(reply.commitString.str() == "\xed\xa0\xbdx");
+
+	CHECK(parseReply(reply, "{}") && !reply.has(PIME::Reply::SUCCESS));
+}
+
+static void testReplyFallback() {
+	PIME::Reply reply;
+	// comments are not accepted by the one-pass parser, but jsoncpp parses them
+	const string commented = "{\"success\": true, \"commitString\": \"a\\\"b\", // comment\n \"seqNum\": 9, /* \"seqNum\": 1 */ "
+		"\"candidateList\": [\"\\u4e00\", \"\\ud83d\\ude00\"]}";
+	CHECK(parseReply(reply, commented));
+	CHECK(reply.success && reply.seqNum == 9);
+	CHECK(reply.commitString.str() == "a\"b");
+	CHECK(reply.candidateList.size() == 2 && reply.candidateList[0].str() == "\xe4\xb8\x80" &&
+		reply.candidateList[1].str() == "\xf0\x9f\x98\x80");
+
+	// invalid replies are rejected by both parsers and leave nothing behind
+	const char* const invalid[] = {
+		"",
+		"[]",
+		"{\"success\": tru",
+		"{\"success\": true",
+		"{\"commitString\": \"abc}",
+		"{\"commitString\": \"\\x\"}"
+	};
+	for (const char* text: invalid) {
+		CHECK(!parseReply(reply, text));
+		CHECK(!reply.has(PIME::Reply::SUCCESS) && !reply.success && reply.commitString.empty());
+	}
+}
+
+int main() {
+	testRequestWriter();
+	testReplyRoundTrip();
+	testReplyTypes();
+	testReplyFallback();
+	if (failures != 0) {
+		fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	printf("all checks passed\n");
+	return 0;
+}